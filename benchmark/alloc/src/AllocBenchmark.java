@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+public class AllocBenchmark {
+    public void timeNewObject(int count) {
+        Object o = null;
+        for (int i = 0; i < count; ++i) {
+            o = new Object();
+        }
+        result = o;
+    }
+
+    public void timeNewPoint(int count) {
+        Point p = null;
+        for (int i = 0; i < count; ++i) {
+            p = new Point(i, i + 1);
+        }
+        result = p;
+    }
+
+    public void timeBoxing(int count) {
+        Long sum = 0L;
+        for (int i = 0; i < count; ++i) {
+            // outside of the Long cache
+            sum = Long.valueOf(sum.longValue() + 1000);
+        }
+        result = sum;
+    }
+
+    public void timeStringBuilder(int count) {
+        StringBuilder sb = null;
+        for (int i = 0; i < count; ++i) {
+            sb = new StringBuilder(16);
+        }
+        result = sb;
+    }
+
+    public void timeNewIntArray4(int count) {
+        int[] arr = null;
+        for (int i = 0; i < count; ++i) {
+            arr = new int[4];
+        }
+        result = arr;
+    }
+
+    public void timeNewIntArray64(int count) {
+        int[] arr = null;
+        for (int i = 0; i < count; ++i) {
+            arr = new int[64];
+        }
+        result = arr;
+    }
+
+    public void timeNewLongArray4(int count) {
+        long[] arr = null;
+        for (int i = 0; i < count; ++i) {
+            arr = new long[4];
+        }
+        result = arr;
+    }
+
+    public void timeNewObjectArray8(int count) {
+        Object[] arr = null;
+        for (int i = 0; i < count; ++i) {
+            arr = new Object[8];
+        }
+        result = arr;
+    }
+
+    public void timeNewByteArrayVariable(int count) {
+        byte[] arr = null;
+        for (int i = 0; i < count; ++i) {
+            arr = new byte[i & 63];
+        }
+        result = arr;
+    }
+
+    static class Point {
+        int x;
+        int y;
+
+        Point(int x, int y) {
+            this.x = x;
+            this.y = y;
+        }
+    }
+
+    public static Object result;
+}
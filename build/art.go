@@ -434,12 +434,16 @@ func mcrDefaults(ctx android.LoadHookContext) {
 			Android struct {
 				Cflags []string
 			}
+			Linux_glibc_x86_64 struct {
+				Cflags []string
+			}
 		}
 		Cflags   []string
 	}
 
 	p := &props{}
 	p.Target.Android.Cflags = mcrFlags(ctx)
+	p.Target.Linux_glibc_x86_64.Cflags = mcrFlags(ctx)
 
 	ctx.AppendProperties(p)
 }
@@ -81,6 +81,15 @@ class Compiler {
     return false;
   }
 
+#ifdef ART_MCR
+  // The LLVM JIT tier: returns the LLVM entrypoint of the method, or nullptr
+  virtual void* JitCompileLLVM(Thread* self ATTRIBUTE_UNUSED,
+                               ArtMethod* method ATTRIBUTE_UNUSED)
+      REQUIRES_SHARED(Locks::mutator_lock_) {
+    return nullptr;
+  }
+#endif
+
   virtual uintptr_t GetEntryPointOf(ArtMethod* method) const
      REQUIRES_SHARED(Locks::mutator_lock_) = 0;
 
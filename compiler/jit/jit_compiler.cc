@@ -33,6 +33,10 @@
 #include "jit/jit.h"
 #include "jit/jit_code_cache.h"
 #include "jit/jit_logger.h"
+#ifdef ART_MCR
+#include <mutex>
+#include "mcr_cc/llvm/debug.h"
+#endif
 
 namespace art {
 namespace jit {
@@ -136,6 +140,15 @@ extern "C" bool jit_compile_method(
   return jit_compiler->CompileMethod(self, method, baseline, osr);
 }
 
+#ifdef ART_MCR
+extern "C" void* jit_compile_method_llvm(void* handle, ArtMethod* method, Thread* self)
+    REQUIRES_SHARED(Locks::mutator_lock_) {
+  auto* jit_compiler = reinterpret_cast<JitCompiler*>(handle);
+  DCHECK(jit_compiler != nullptr);
+  return jit_compiler->CompileMethodLLVM(self, method);
+}
+#endif
+
 extern "C" void jit_types_loaded(void* handle, mirror::Class** types, size_t count)
     REQUIRES_SHARED(Locks::mutator_lock_) {
   auto* jit_compiler = reinterpret_cast<JitCompiler*>(handle);
@@ -217,5 +230,34 @@ bool JitCompiler::CompileMethod(Thread* self, ArtMethod* method, bool baseline,
   return success;
 }
 
+#ifdef ART_MCR
+/**
+ * @brief The LLVM JIT tier (mcr::McrRT::IsLlvmJit). The compiler options
+ *        of dex2oat (McrDebug) are read once, in the app process.
+ *        Options that need the hf.so side files (hf.stackmaps, hf.faults)
+ *        can not be used.
+ */
+void* JitCompiler::CompileMethodLLVM(Thread* self, ArtMethod* method) {
+  SCOPED_TRACE << "LLVM JIT compiling " << method->PrettyMethod();
+  static std::once_flag options_read;
+  std::call_once(options_read, McrDebug::ReadOptions);
+  if (McrDebug::GcStackMaps() || McrDebug::ImplicitChecks()) {
+    DLOG(WARNING) << "LlvmJit: not compiling: opt.gc_stackmaps and "
+      << "opt.implicit_checks need an hf.so: " << method->PrettyMethod();
+    return nullptr;
+  }
+
+  self->AssertNoPendingException();
+  uint64_t start_ns = NanoTime();
+  void* code = compiler_->JitCompileLLVM(self, method);
+  VLOG(jit) << "LLVM compilation of "
+            << method->PrettyMethod()
+            << " took "
+            << PrettyDuration(NanoTime() - start_ns);
+  Runtime::Current()->GetJitArenaPool()->TrimMaps();
+  return code;
+}
+#endif
+
 }  // namespace jit
 }  // namespace art
@@ -40,6 +40,12 @@ class JitCompiler {
   bool CompileMethod(Thread* self, ArtMethod* method, bool baseline, bool osr)
       REQUIRES_SHARED(Locks::mutator_lock_);
 
+#ifdef ART_MCR
+  // LLVM JIT tier. Returns the LLVM entrypoint of the method, or nullptr.
+  void* CompileMethodLLVM(Thread* self, ArtMethod* method)
+      REQUIRES_SHARED(Locks::mutator_lock_);
+#endif
+
   const CompilerOptions& GetCompilerOptions() const {
     return *compiler_options_.get();
   }
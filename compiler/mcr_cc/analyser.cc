@@ -37,6 +37,7 @@
 #include "dex/class_reference.h"
 #include "dex/dex_file_loader.h"
 #include "dex/dex_instruction-inl.h"
+#include "mcr_cc/compilation_cache.h"
 #include "mcr_cc/llvm/llvm_compiler.h"
 #include "mcr_cc/os_comp.h"
 #include "mcr_cc/linker.h"
@@ -54,12 +55,8 @@ namespace mcr {
 
 uint32_t methods_num_ = 0;
 std::set<std::string> Analyser::dbg_methods_;
-std::set<std::string> Analyser::cold_methods_;
-std::set<std::string> Analyser::cold_methods_internal_;
 std::set<std::string> Analyser::cant_compile_;
-std::set<std::string> Analyser::llvm_compiled_;
 std::set<std::string> Analyser::not_found_;
-std::set<std::string> Analyser::histogram_additions_;
 std::vector<const DexFile*> Analyser::dex_files_;
 
 bool Analyser::HasDebugMethodsProfile() { return (dbg_methods_.size() > 0); }
@@ -98,13 +95,44 @@ void Analyser::ReadDebugMethodsProfile() {
   }
 }
 
+/**
+ * @brief Regions of a compiled method. Methods that are not in the profile
+ *        (e.g. OS methods) are reported with the first region.
+ */
+static std::vector<HotRegion*> GetReportRegions(std::string pretty_method) {
+  std::vector<HotRegion*> regions(McrCC::GetRegionsOf(pretty_method));
+  if (regions.empty() && !McrCC::GetRegions().empty()) {
+    regions.push_back(McrCC::GetRegions().front().get());
+  }
+  return regions;
+}
+
 void Analyser::AddToLlvmCompiled(std::string pretty_method) {
-  llvm_compiled_.insert(pretty_method);
+  for (HotRegion* region : GetReportRegions(pretty_method)) {
+    region->AddLlvmCompiled(pretty_method);
+  }
 }
 
-void Analyser::AddColdMethod(std::string m) {
+void Analyser::AddColdMethod(std::string caller, std::string m) {
   D2LOG(INFO) << __func__ << ": "  << m;
-  cold_methods_.insert(m);
+  CompilationCache::RecordReport(caller, "cold", m);
+  for (HotRegion* region : GetReportRegions(caller)) {
+    region->AddColdMethod(m, false);
+  }
+}
+
+void Analyser::AddColdMethodInternal(std::string caller, std::string m) {
+  CompilationCache::RecordReport(caller, "cold_internal", m);
+  for (HotRegion* region : GetReportRegions(caller)) {
+    region->AddColdMethod(m, true);
+  }
+}
+
+void Analyser::AddHistogramAddition(std::string caller, std::string m) {
+  CompilationCache::RecordReport(caller, "histogram", m);
+  for (HotRegion* region : GetReportRegions(caller)) {
+    region->AddHistogramAddition(m);
+  }
 }
 
 bool Analyser::IsHotMethod(std::string hf) {
@@ -131,6 +159,26 @@ void Analyser::PrintCompilationReport() {
     }
   }
 
+  CompilationCache::PrintReport();
+
+  // The remaining report is for all regions
+  std::set<std::string> cold_methods;
+  std::set<std::string> cold_methods_internal;
+  std::set<std::string> histogram_additions;
+  for (const std::unique_ptr<HotRegion>& region : McrCC::GetRegions()) {
+    std::set<std::string> cold(region->GetColdMethods(false));
+    std::set<std::string> cold_internal(region->GetColdMethods(true));
+    std::set<std::string> additions(region->GetHistogramAdditions());
+    DLOG(INFO) << "|- Region: " << region->GetEntrypoint()
+      << "\n|   hot: " << region->GetMethods().size()
+      << " llvm: " << region->GetLlvmCompiled().size()
+      << " cold: " << cold.size() << "/" << cold_internal.size() << " (internal)"
+      << " histogram additions: " << additions.size();
+    cold_methods.insert(cold.begin(), cold.end());
+    cold_methods_internal.insert(cold_internal.begin(), cold_internal.end());
+    histogram_additions.insert(additions.begin(), additions.end());
+  }
+
   // Split cold (not compiled) methods to:
   // .ones that were already added to a profile, and still failed to compile
   // .constructors
@@ -140,10 +188,10 @@ void Analyser::PrintCompilationReport() {
   std::set<std::string> method_toadd;
   std::set<std::string> method_osblocklist;
   std::set<std::string> method_osfailed;
-  if (cold_methods_.size()> 0) {
-    DLOG(WARNING) << "| Methods: cold" << cold_methods_.size()
+  if (cold_methods.size()> 0) {
+    DLOG(WARNING) << "| Methods: cold" << cold_methods.size()
       << " (total)";
-    for (std::string method : cold_methods_) {
+    for (std::string method : cold_methods) {
       if (method.find(MATCH_CTOR) != std::string::npos) {
         method_ctors.insert(method);
       } else if (IsHotMethod(method)) {
@@ -153,7 +201,7 @@ void Analyser::PrintCompilationReport() {
       } else {
         // check that method is not in histogram
         bool in_hist=false;
-        for(std::string histmethod: histogram_additions_) {
+        for(std::string histmethod: histogram_additions) {
           if(histmethod.compare(method) == 0) {
             in_hist = true;
             break;
@@ -189,10 +237,10 @@ void Analyser::PrintCompilationReport() {
     }
   }
 
-  if (cold_methods_internal_.size() > 0) {
+  if (cold_methods_internal.size() > 0) {
     DLOG(ERROR) << "|- Methods: COLD: Internal: "
-      << cold_methods_internal_.size();
-    for (std::string method : cold_methods_internal_) {
+      << cold_methods_internal.size();
+    for (std::string method : cold_methods_internal) {
       DLOG(WARNING) << "| " << method;
     }
   }
@@ -243,9 +291,9 @@ void Analyser::PrintCompilationReport() {
     }
   }
 
-  if (histogram_additions_.size() > 0) {
-    DLOG(WARNING) << "|- Histogram: new additions:" << histogram_additions_.size();
-    for (std::string pretty_method : histogram_additions_) {
+  if (histogram_additions.size() > 0) {
+    DLOG(WARNING) << "|- Histogram: new additions:" << histogram_additions.size();
+    for (std::string pretty_method : histogram_additions) {
       DLOG(WARNING) << pretty_method;
     }
   } else {
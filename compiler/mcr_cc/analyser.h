@@ -38,17 +38,15 @@ class Analyser final {
                               const std::vector<const DexFile*>& dex_files)
       REQUIRES(!Locks::mutator_lock_);
 
-  static void AddColdMethod(std::string m);
-
-  static void AddColdMethodInternal(std::string m) {
-    cold_methods_internal_.insert(m);
-  }
+  // Recorded on the hot regions of the caller (see HotRegion)
+  static void AddColdMethod(std::string caller, std::string m);
+  static void AddColdMethodInternal(std::string caller, std::string m);
+  static void AddHistogramAddition(std::string caller, std::string m);
 
   static void PrintCompilationReport();
   static void AddToLlvmCompiled(std::string pretty_method);
   static void AddToDontCompileInUse(std::string method);
   static std::set<std::string> not_found_;
-  static std::set<std::string> histogram_additions_;
   static bool IsInDebugMethodsProfile(std::string pretty_method);
   static bool HasDebugMethodsProfile();
 
@@ -58,12 +56,9 @@ class Analyser final {
   static void ReadDebugMethodsProfile();
   
   static std::set<std::string> dbg_methods_;
-  static std::set<std::string> cold_methods_;
-  static std::set<std::string> cold_methods_internal_;
   static std::vector<const DexFile*> dex_files_;
 
   static std::set<std::string> cant_compile_;
-  static std::set<std::string> llvm_compiled_;
 
   Analyser();
   ~Analyser();
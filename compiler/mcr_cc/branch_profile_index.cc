@@ -0,0 +1,117 @@
+/**
+ * A process-wide index of the branch profile that LLVM code collects with
+ * opt.profile_branches, used for the branch weights of HIf and
+ * HPackedSwitch, and for the entry counts of the methods.
+ *
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "mcr_cc/branch_profile_index.h"
+
+#include <mutex>
+#include <sstream>
+
+#include "base/os.h"
+#include "base/time_utils.h"
+#include "mcr_rt/branch_profile.h"
+#include "mcr_rt/mcr_rt.h"
+#include "mcr_rt/utils.h"
+
+namespace art {
+namespace mcr {
+
+BranchProfileIndex* BranchProfileIndex::Current() {
+  static std::once_flag once;
+  static BranchProfileIndex* index = nullptr;
+  std::call_once(once, []() { index = new BranchProfileIndex(); });
+  return index;
+}
+
+BranchProfileIndex::BranchProfileIndex() {
+  uint64_t s = NanoTime();
+  std::string filename = BranchProfile::GetDeltaFilename();
+  if (!OS::FileExists(filename.c_str())) return;
+
+  std::vector<BranchProfile::Record> records;
+  BranchProfile::ReadDeltas(filename, &records);
+  for (const BranchProfile::Record& r : records) {
+    uint64_t& count = methods_[GetMethodKey(r.dex_location_, r.method_idx_)]
+      [SiteKey(r.site_.block_id_, r.site_.dex_pc_, r.site_.successor_)];
+    if (count == 0) size_++;
+    count += r.count_;
+  }
+
+  D1LOG(INFO) << "BranchProfileIndex: " << size_ << " counters of "
+    << methods_.size() << " methods in " << PrettyDuration(NanoTime() - s);
+}
+
+std::string BranchProfileIndex::GetMethodKey(const std::string& dex_location,
+                                             uint32_t method_idx) {
+  return dex_location + ":" + std::to_string(method_idx);
+}
+
+const BranchProfileIndex::MethodCounts* BranchProfileIndex::GetMethod(
+    const std::string& dex_location, uint32_t method_idx) const {
+  auto it = methods_.find(GetMethodKey(dex_location, method_idx));
+  return it == methods_.end() ? nullptr : &it->second;
+}
+
+std::vector<uint64_t> BranchProfileIndex::Lookup(
+    const std::string& dex_location, uint32_t method_idx,
+    uint32_t block_id, uint32_t dex_pc, uint32_t num_successors) const {
+  const MethodCounts* counts = GetMethod(dex_location, method_idx);
+  if (counts == nullptr) return {};
+
+  std::vector<uint64_t> successors(num_successors, 0);
+  uint64_t total = 0;
+  for (auto it = counts->lower_bound(SiteKey(block_id, dex_pc, 0));
+       it != counts->end() && std::get<0>(it->first) == block_id &&
+       std::get<1>(it->first) == dex_pc; it++) {
+    const uint32_t successor = std::get<2>(it->first);
+    if (successor >= num_successors) {
+      // a different HGraph: the counts do not apply
+      D2LOG(WARNING) << "BranchProfileIndex: mismatch: block" << block_id
+        << ": successor: " << successor << "/" << num_successors;
+      return {};
+    }
+    successors[successor] = it->second;
+    total += it->second;
+  }
+  if (total == 0) return {};
+  return successors;
+}
+
+uint64_t BranchProfileIndex::GetEntryCount(const std::string& dex_location,
+                                           uint32_t method_idx) const {
+  const MethodCounts* counts = GetMethod(dex_location, method_idx);
+  if (counts == nullptr) return 0;
+  auto it = counts->find(SiteKey(BranchProfile::kMethodEntry, 0, 0));
+  return it == counts->end() ? 0 : it->second;
+}
+
+std::string BranchProfileIndex::GetMethodCounts(
+    const std::string& dex_location, uint32_t method_idx) const {
+  const MethodCounts* counts = GetMethod(dex_location, method_idx);
+  if (counts == nullptr) return "";
+  std::stringstream ss;
+  for (const auto& it : *counts) {
+    ss << std::get<0>(it.first) << ":" << std::get<1>(it.first) << ":"
+       << std::get<2>(it.first) << "=" << it.second << ";";
+  }
+  return ss.str();
+}
+
+}  // namespace mcr
+}  // namespace art
@@ -0,0 +1,77 @@
+/**
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef ART_COMPILER_MCR_BRANCH_PROFILE_INDEX_H_
+#define ART_COMPILER_MCR_BRANCH_PROFILE_INDEX_H_
+
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "base/macros.h"
+
+namespace art {
+namespace mcr {
+
+/**
+ * @brief Read-only index over the branch profile (mcr::BranchProfile),
+ *        built once per dex2oat run from branch.prof.delta, and keyed by:
+ *        (dex location, method idx) and then (block id, dex_pc, successor)
+ *
+ * The deltas of all runs are summed.
+ */
+class BranchProfileIndex final {
+ public:
+  static BranchProfileIndex* Current();
+
+  // Counts of the successors of a branch. Empty when it was never executed.
+  std::vector<uint64_t> Lookup(const std::string& dex_location,
+                               uint32_t method_idx, uint32_t block_id,
+                               uint32_t dex_pc, uint32_t num_successors) const;
+
+  // 0 when the method was not profiled
+  uint64_t GetEntryCount(const std::string& dex_location,
+                         uint32_t method_idx) const;
+
+  // All counts of a method, as text (for mcr::CompilationCache)
+  std::string GetMethodCounts(const std::string& dex_location,
+                              uint32_t method_idx) const;
+
+  size_t GetSize() const { return size_; }
+
+ private:
+  // block id, dex_pc, successor
+  typedef std::tuple<uint32_t, uint32_t, uint32_t> SiteKey;
+  typedef std::map<SiteKey, uint64_t> MethodCounts;
+
+  BranchProfileIndex();
+
+  const MethodCounts* GetMethod(const std::string& dex_location,
+                                uint32_t method_idx) const;
+  static std::string GetMethodKey(const std::string& dex_location,
+                                  uint32_t method_idx);
+
+  std::map<std::string, MethodCounts> methods_;
+  size_t size_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(BranchProfileIndex);
+};
+
+}  // namespace mcr
+}  // namespace art
+
+#endif  // ART_COMPILER_MCR_BRANCH_PROFILE_INDEX_H_
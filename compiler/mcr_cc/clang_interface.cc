@@ -23,6 +23,7 @@
 #include "mcr_cc/clang_interface.h"
 #include "mcr_rt/mcr_rt.h"
 
+#include <mutex>
 #include "base/os.h"
 #include "mcr_cc/mcr_cc.h"
 #include "mcr_cc/pass_manager.h"
@@ -38,21 +39,29 @@ const std::string ClangInterface::CC = "clang ";
 const std::string ClangInterface::LD = "ld ";
 #endif
 
-bool ClangInterface::GenerateSharedObject() {
-  cdSrcDir();
+bool ClangInterface::GenerateSharedObject(std::string entrypoint,
+                                          InstructionSet instruction_set) {
   std::string ldflags=LDFLAGS;
   std::string cflags;
   const std::string debug_flags = mcr::PassManager::GetDebugFlags();
   cflags+=spaced(debug_flags);
 #ifdef ART_MCR_ANDROID_6
-  setupEnvironment();
+  // it appends to the environment: once, as regions link concurrently
+  static std::once_flag env_once;
+  std::call_once(env_once, setupEnvironment);
+  UNUSED(instruction_set);
 #elif defined(ART_MCR_ANDROID_10)
-  ldflags+=LDFLAGS_ANDROID_10;
-  cflags+=ARCH_FLAGS_ANDROID_10;
+  if (instruction_set == InstructionSet::kX86_64) {
+    ldflags+=LDFLAGS_X86_64;
+  } else {
+    ldflags+=LDFLAGS_ANDROID_10;
+    cflags+=ARCH_FLAGS_ANDROID_10;
+  }
 #endif
   
   std::string cmd = CC + cflags + ldflags +
-          " -Wl,-soname," HFso " -o " HFso " " HFo " ";
+          " -Wl,-soname," HFso " -o " + GetFileSrc(entrypoint, HFso) +
+          spaced(GetFileSrc(entrypoint, HFo));
   cmd = McrCC::remove_extra_whitespaces(cmd);
   D2LOG(INFO) << "LD: " << cmd;
   bool r = EXE(cmd);
@@ -17,6 +17,7 @@
 #ifndef ART_COMPILER_MCR_CLANG_INTERFACE_H_
 #define ART_COMPILER_MCR_CLANG_INTERFACE_H_
 
+#include "arch/instruction_set.h"
 #include "mcr_cc/compiler_interface.h"
 
 // NOTES on flags:
@@ -40,6 +41,8 @@
 #define NDK_SYSROOT "/system/usr/lib"
 #define ARCH_FLAGS_ANDROID_10 " -ffixed-x19 -ffixed-x20 "
 #define LDFLAGS_ANDROID_10 " --target=aarch64-linux-android -nodefaultlibs " 
+// Linux host: the Thread is in gs, so there are no registers to reserve
+#define LDFLAGS_X86_64 " --target=x86_64-linux-gnu -nodefaultlibs "
 #endif
 
 namespace art {
@@ -48,7 +51,9 @@ namespace mcr {
 class ClangInterface : public CompilerInterface {
  public:
   static bool Compile(bool emit_llvm, bool emit_asm);
-  static bool GenerateSharedObject();
+  // Links the object file of a region to its hf.so
+  static bool GenerateSharedObject(std::string entrypoint,
+      InstructionSet instruction_set = kRuntimeISA);
  private:
 #ifdef ART_MCR_ANDROID_6
   static std::string GetIncludeDirClang();
@@ -0,0 +1,295 @@
+/**
+ * Content-addressed caches for the two dex2oat runs of the LLVM backend:
+ * the bitcode of each method (llvm-gen-bitcode), and the optimized object
+ * of each hot region (llvm-base).
+ *
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "mcr_cc/compilation_cache.h"
+
+#include <stdio.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <llvm/ADT/StringExtras.h>
+#include "arch/instruction_set_features.h"
+#include "base/os.h"
+#include "dex/code_item_accessors-inl.h"
+#include "driver/compiler_options.h"
+#include "mcr_cc/analyser.h"
+#include "mcr_cc/branch_profile_index.h"
+#include "mcr_cc/invoke_histogram_index.h"
+#include "mcr_cc/llvm/debug.h"
+#include "mcr_cc/llvm/llvm_pipeline.h"
+#include "mcr_cc/mcr_cc.h"
+#include "mcr_rt/mcr_rt.h"
+#include "mcr_rt/utils.h"
+
+#define FILE_CACHE_COMPLETE "complete"
+#define FILE_CACHE_REPORT "report.lst"
+
+namespace art {
+namespace mcr {
+
+std::atomic<uint32_t> CompilationCache::method_hits_(0);
+std::atomic<uint32_t> CompilationCache::method_misses_(0);
+std::atomic<uint32_t> CompilationCache::object_hits_(0);
+std::atomic<uint32_t> CompilationCache::object_misses_(0);
+
+// Analyser report entries of the methods being generated,
+// stored with their bitcode and replayed on a hit.
+static std::mutex report_lock_;
+static std::map<std::string, std::vector<std::string>> report_;
+
+CompilationCache::Key::Key() {
+  Add(MCR_CC_VERSION);
+}
+
+void CompilationCache::Key::Add(const std::string& str) {
+  sha1_.update(StringRef(str.data(), str.size() + 1));
+}
+
+void CompilationCache::Key::Add(uint64_t value) {
+  Add(&value, sizeof(value));
+}
+
+void CompilationCache::Key::Add(const void* data, size_t size) {
+  sha1_.update(ArrayRef<uint8_t>(static_cast<const uint8_t*>(data), size));
+}
+
+std::string CompilationCache::Key::Final() {
+  return toHex(sha1_.final(), true);
+}
+
+bool CompilationCache::IsEnabled() {
+  return McrDebug::UseCompilationCache();
+}
+
+std::string CompilationCache::GetDir(std::string subdir) {
+  std::string dir = GetFileApp(DIR_COMPILATION_CACHE);
+  CheckDirExists(dir);
+  dir += "/" + subdir;
+  CheckDirExists(dir);
+  return dir;
+}
+
+bool CompilationCache::CopyFile(std::string from, std::string to) {
+  std::ifstream in(from, std::ios::binary);
+  if (!in.good()) return false;
+  std::string tmp = to + ".tmp";
+  {
+    std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+    out << in.rdbuf();
+    if (!out.good()) return false;
+  }
+  chmod(tmp.c_str(), 0644);
+  return rename(tmp.c_str(), to.c_str()) == 0;
+}
+
+/**
+ * @brief Everything that the bitcode of a method depends on:
+ *        its dex code, the speculations of its call sites (including the
+ *        inlined ones, as they keep the caller's method idx), its branch
+ *        profile, the hot
+ *        methods (what is called directly, and what goes through the
+ *        runtime), and the options of the compiler and of the backend.
+ */
+std::string CompilationCache::GetMethodKey(const DexFile& dex_file,
+    uint32_t method_idx, const dex::CodeItem* code_item,
+    const CompilerOptions& compiler_options) {
+  std::string pretty_method = dex_file.PrettyMethod(method_idx);
+  Key key;
+  key.Add(McrDebug::GetOptionsFingerprint());
+  key.Add(GetInstructionSetString(compiler_options.GetInstructionSet()));
+  key.Add(compiler_options.GetInstructionSetFeatures()->GetFeatureString());
+  key.Add(compiler_options.GetDebuggable());
+  key.Add(compiler_options.GetImplicitNullChecks());
+  key.Add(compiler_options.GetImplicitStackOverflowChecks());
+
+  // sorted: std::set
+  for (const std::string& hf : McrRT::hot_functions_) key.Add(hf);
+  key.Add(McrCC::IsLlvmEntrypoint(pretty_method));
+  key.Add(Analyser::IsInDebugMethodsProfile(pretty_method));
+
+  key.Add(dex_file.GetLocation());
+  key.Add(dex_file.GetLocationChecksum());
+  key.Add(pretty_method);
+  CodeItemDataAccessor accessor(dex_file, code_item);
+  key.Add(accessor.RegistersSize());
+  key.Add(accessor.InsSize());
+  key.Add(accessor.Insns(),
+          accessor.InsnsSizeInCodeUnits() * sizeof(uint16_t));
+
+  InvokeHistogramIndex* index = InvokeHistogramIndex::Current();
+  if (index != nullptr) {
+    for (const InvokeInfo& ii : index->LookupMethod(dex_file.GetLocation(), method_idx)) {
+      key.Add(ii.str());
+      // the call counts of the inline hints (HGraphToLLVM::GetCallCount)
+      if (McrDebug::RegionInline()) key.Add(ii.GetInvokeTimes());
+    }
+  }
+  key.Add(BranchProfileIndex::Current()->GetMethodCounts(
+        dex_file.GetLocation(), method_idx));
+  return key.Final();
+}
+
+/**
+ * @brief On a hit the bitcode and the link dependencies are copied to
+ *        the src dir of the method, where llvm-base expects them.
+ */
+bool CompilationCache::LoadMethod(const std::string& key, std::string pretty_method) {
+  std::string dir = GetDir("bc") + "/" + key;
+  if (!OS::FileExists((dir + "/" FILE_CACHE_COMPLETE).c_str())) {
+    method_misses_++;
+    D2LOG(INFO) << "CompilationCache: miss: " << pretty_method;
+    return false;
+  }
+
+  for (std::string file : { McrCC::GetInnerBitcodeFilename(),
+                            McrCC::GetOuterBitcodeFilename(),
+                            std::string(FILE_DEPS_LINK) }) {
+    std::string cached = dir + "/" + file;
+    std::string src = GetFileSrc(pretty_method, file);
+    if (OS::FileExists(cached.c_str())) {
+      if (!CopyFile(cached, src)) {
+        DLOG(ERROR) << "CompilationCache: failed to load: " << cached;
+        method_misses_++;
+        return false;
+      }
+    } else if (OS::FileExists(src.c_str())) {
+      // stale, from a previous compilation
+      unlink(src.c_str());
+    }
+  }
+
+  std::ifstream in(dir + "/" FILE_CACHE_REPORT);
+  std::string type, method;
+  while (in >> type && std::getline(in >> std::ws, method)) {
+    if (type == "cold") {
+      Analyser::AddColdMethod(pretty_method, method);
+    } else if (type == "cold_internal") {
+      Analyser::AddColdMethodInternal(pretty_method, method);
+    } else if (type == "histogram") {
+      Analyser::AddHistogramAddition(pretty_method, method);
+    }
+  }
+  {
+    std::lock_guard<std::mutex> lock(report_lock_);
+    report_.erase(pretty_method);
+  }
+
+  method_hits_++;
+  D1LOG(INFO) << "CompilationCache: hit: " << pretty_method;
+  return true;
+}
+
+void CompilationCache::RecordReport(std::string caller, std::string type,
+                                    std::string method) {
+  if (!IsEnabled()) return;
+  std::lock_guard<std::mutex> lock(report_lock_);
+  report_[caller].push_back(type + " " + method);
+}
+
+void CompilationCache::StoreMethod(const std::string& key, std::string pretty_method) {
+  std::vector<std::string> report;
+  {
+    std::lock_guard<std::mutex> lock(report_lock_);
+    auto it = report_.find(pretty_method);
+    if (it != report_.end()) {
+      report.swap(it->second);
+      report_.erase(it);
+    }
+  }
+
+  std::string dir = GetDir("bc") + "/" + key;
+  CheckDirExists(dir);
+  for (std::string file : { McrCC::GetInnerBitcodeFilename(),
+                            McrCC::GetOuterBitcodeFilename(),
+                            std::string(FILE_DEPS_LINK) }) {
+    std::string src = GetFileSrc(pretty_method, file);
+    if (!OS::FileExists(src.c_str())) continue;
+    if (!CopyFile(src, dir + "/" + file)) {
+      DLOG(ERROR) << "CompilationCache: failed to store: " << src;
+      return;
+    }
+  }
+
+  {
+    std::ofstream out(dir + "/" FILE_CACHE_REPORT, std::ios::trunc);
+    for (const std::string& line : report) out << line << "\n";
+  }
+  // last: marks the entry as usable
+  std::ofstream complete(dir + "/" FILE_CACHE_COMPLETE);
+  complete << pretty_method << "\n";
+}
+
+std::string CompilationCache::GetObjectKey(const SmallVectorImpl<char>& bitcode,
+    std::string isa, std::string baseline,
+    std::string opt_flags, std::string llc_flags) {
+  Key key;
+  key.Add(isa);
+  key.Add(baseline);
+  key.Add(opt_flags);
+  key.Add(llc_flags);
+  key.Add(bitcode.data(), bitcode.size());
+  return key.Final();
+}
+
+bool CompilationCache::LoadObject(const std::string& key,
+                                  SmallVectorImpl<char>* object) {
+  std::string filename = GetDir("obj") + "/" + key + ".o";
+  std::ifstream in(filename, std::ios::binary);
+  if (!in.good()) {
+    object_misses_++;
+    return false;
+  }
+  std::string data((std::istreambuf_iterator<char>(in)),
+                   std::istreambuf_iterator<char>());
+  object->assign(data.begin(), data.end());
+  object_hits_++;
+  return true;
+}
+
+void CompilationCache::StoreObject(const std::string& key,
+                                   const SmallVectorImpl<char>& object) {
+  std::string filename = GetDir("obj") + "/" + key + ".o";
+  std::string tmp = filename + ".tmp";
+  if (!LLVM::LlvmPipeline::WriteFile(tmp, object)) return;
+  chmod(tmp.c_str(), 0644);
+  rename(tmp.c_str(), filename.c_str());
+}
+
+void CompilationCache::PrintReport() {
+  if (!IsEnabled()) return;
+  uint32_t mh = method_hits_, mm = method_misses_;
+  uint32_t oh = object_hits_, om = object_misses_;
+  if (mh + mm > 0) {
+    DLOG(INFO) << "CompilationCache: bitcode: " << mh << " hits, "
+      << mm << " misses";
+  }
+  if (oh + om > 0) {
+    DLOG(INFO) << "CompilationCache: objects: " << oh << " hits, "
+      << om << " misses";
+  }
+}
+
+}  // namespace mcr
+}  // namespace art
@@ -0,0 +1,103 @@
+/**
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef ART_COMPILER_MCR_COMPILATION_CACHE_H_
+#define ART_COMPILER_MCR_COMPILATION_CACHE_H_
+
+#include <atomic>
+#include <string>
+
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/Support/SHA1.h>
+#include "base/macros.h"
+#include "dex/dex_file.h"
+
+#define DIR_COMPILATION_CACHE "llvm.cache"
+// Bump whenever the generated code changes for the same inputs
+#define MCR_CC_VERSION "mcr_cc-12"
+
+namespace art {
+
+class CompilerOptions;
+
+namespace mcr {
+
+/**
+ * @brief On-disk caches of the LLVM compilation (option: opt.compilation_cache)
+ *
+ * Iterative compilation recompiles the same hot regions with different
+ * flags, so each stage is keyed only by the inputs it depends on:
+ * - method cache (llvm-gen-bitcode): the inner/outer bitcode and deps.lnk
+ *   of a method. Key: dex method bytes, the histogram entries of the
+ *   method, the hot methods, compiler options, McrDebug options and version.
+ * - object cache (llvm-base): the optimized object of a region.
+ *   Key: the linked bitcode, baseline, opt/llc flags, ISA and version.
+ *
+ * Entries are never evicted: remove the llvm.cache dir of the app.
+ */
+class CompilationCache final {
+ public:
+  class Key {
+   public:
+    Key();
+    void Add(const std::string& str);
+    void Add(uint64_t value);
+    void Add(const void* data, size_t size);
+    std::string Final();
+
+   private:
+    ::llvm::SHA1 sha1_;
+  };
+
+  static bool IsEnabled();
+
+  static std::string GetMethodKey(const DexFile& dex_file, uint32_t method_idx,
+                                  const dex::CodeItem* code_item,
+                                  const CompilerOptions& compiler_options);
+  // Copies the cached bitcode of a method to its src dir
+  static bool LoadMethod(const std::string& key, std::string pretty_method);
+  static void StoreMethod(const std::string& key, std::string pretty_method);
+  // Analyser entries (cold methods, histogram additions) of a method,
+  // kept with its bitcode so the report is the same on a hit
+  static void RecordReport(std::string caller, std::string type,
+                           std::string method);
+
+  static std::string GetObjectKey(const ::llvm::SmallVectorImpl<char>& bitcode,
+                                  std::string isa, std::string baseline,
+                                  std::string opt_flags, std::string llc_flags);
+  static bool LoadObject(const std::string& key,
+                         ::llvm::SmallVectorImpl<char>* object);
+  static void StoreObject(const std::string& key,
+                          const ::llvm::SmallVectorImpl<char>& object);
+
+  static void PrintReport();
+
+ private:
+  static std::string GetDir(std::string subdir);
+  static bool CopyFile(std::string from, std::string to);
+
+  static std::atomic<uint32_t> method_hits_;
+  static std::atomic<uint32_t> method_misses_;
+  static std::atomic<uint32_t> object_hits_;
+  static std::atomic<uint32_t> object_misses_;
+
+  DISALLOW_IMPLICIT_CONSTRUCTORS(CompilationCache);
+};
+
+}  // namespace mcr
+}  // namespace art
+
+#endif  // ART_COMPILER_MCR_COMPILATION_CACHE_H_
@@ -32,8 +32,8 @@
 namespace art {
 namespace mcr {
 
-void CompilerInterface::cdSrcDir() {
-  std::string dir_src = GetDirAppHfSrc(McrCC::GetLlvmEntrypointStripped());
+void CompilerInterface::cdSrcDir(std::string entrypoint) {
+  std::string dir_src = GetDirAppHfSrc(StripHf(entrypoint));
   D2LOG(INFO) << "chdir(" << dir_src << ")";
   if (chdir(dir_src.c_str()) == -1) {
     DLOG(FATAL) << __func__ << ": Failed to chdir:" << dir_src
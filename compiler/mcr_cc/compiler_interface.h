@@ -27,7 +27,8 @@ namespace mcr {
 
 class CompilerInterface {
  protected:
-  static void cdSrcDir();
+  // Only the external tools work in the src dir of the region (not thread-safe)
+  static void cdSrcDir(std::string entrypoint);
   static bool CHMOD(std::string file, std::string perms);
   static bool EXE(std::string cmd, bool print_output = false,
       bool increased_timeout = false);
@@ -0,0 +1,78 @@
+/**
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "mcr_cc/hot_region.h"
+
+#include "mcr_rt/utils.h"
+
+namespace art {
+namespace mcr {
+
+HotRegion::HotRegion(std::string entrypoint)
+    : entrypoint_(entrypoint) {
+  methods_.insert(entrypoint);
+}
+
+std::string HotRegion::GetEntrypointStripped() const {
+  return StripHf(entrypoint_);
+}
+
+void HotRegion::AddLlvmCompiled(std::string pretty_method) {
+  std::lock_guard<std::mutex> lock(lock_);
+  llvm_compiled_.insert(pretty_method);
+}
+
+void HotRegion::AddColdMethod(std::string pretty_method, bool internal) {
+  std::lock_guard<std::mutex> lock(lock_);
+  if (internal) {
+    cold_methods_internal_.insert(pretty_method);
+  } else {
+    cold_methods_.insert(pretty_method);
+  }
+}
+
+void HotRegion::AddHistogramAddition(std::string pretty_method) {
+  std::lock_guard<std::mutex> lock(lock_);
+  histogram_additions_.insert(pretty_method);
+}
+
+void HotRegion::AddRecompilationReason(std::string reason) {
+  std::lock_guard<std::mutex> lock(lock_);
+  recompile_reasons_.insert(reason);
+}
+
+std::set<std::string> HotRegion::GetLlvmCompiled() {
+  std::lock_guard<std::mutex> lock(lock_);
+  return llvm_compiled_;
+}
+
+std::set<std::string> HotRegion::GetColdMethods(bool internal) {
+  std::lock_guard<std::mutex> lock(lock_);
+  return internal ? cold_methods_internal_ : cold_methods_;
+}
+
+std::set<std::string> HotRegion::GetHistogramAdditions() {
+  std::lock_guard<std::mutex> lock(lock_);
+  return histogram_additions_;
+}
+
+std::set<std::string> HotRegion::GetRecompilationReasons() {
+  std::lock_guard<std::mutex> lock(lock_);
+  return recompile_reasons_;
+}
+
+}  // namespace mcr
+}  // namespace art
@@ -0,0 +1,83 @@
+/**
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef ART_COMPILER_MCR_HOT_REGION_H_
+#define ART_COMPILER_MCR_HOT_REGION_H_
+
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "base/macros.h"
+
+namespace art {
+namespace mcr {
+
+/**
+ * @brief A hot region: an LLVM entrypoint (its outermost method) and
+ *        the hot methods it was profiled with.
+ *
+ * Methods are compiled on the threads of the compiler driver, so all the
+ * state that is collected during a compilation, and used to be static,
+ * is kept per region and guarded by its lock.
+ *
+ * A method that is hot in several regions is still compiled once:
+ * its bitcode is linked into every region that reaches it (deps.lnk).
+ */
+class HotRegion final {
+ public:
+  explicit HotRegion(std::string entrypoint);
+
+  const std::string& GetEntrypoint() const { return entrypoint_; }
+  std::string GetEntrypointStripped() const;
+  const std::set<std::string>& GetMethods() const { return methods_; }
+  bool Contains(const std::string& pretty_method) const {
+    return methods_.find(pretty_method) != methods_.end();
+  }
+
+  // Only while reading the profile (before any compilation)
+  void AddMethod(std::string pretty_method) { methods_.insert(pretty_method); }
+
+  void AddLlvmCompiled(std::string pretty_method);
+  void AddColdMethod(std::string pretty_method, bool internal);
+  void AddHistogramAddition(std::string pretty_method);
+  void AddRecompilationReason(std::string reason);
+
+  std::set<std::string> GetLlvmCompiled();
+  std::set<std::string> GetColdMethods(bool internal);
+  std::set<std::string> GetHistogramAdditions();
+  std::set<std::string> GetRecompilationReasons();
+
+ private:
+  const std::string entrypoint_;
+  std::set<std::string> methods_;
+
+  std::mutex lock_;
+  std::set<std::string> llvm_compiled_;
+  std::set<std::string> cold_methods_;
+  std::set<std::string> cold_methods_internal_;
+  std::set<std::string> histogram_additions_;
+  std::set<std::string> recompile_reasons_;
+
+  DISALLOW_COPY_AND_ASSIGN(HotRegion);
+};
+
+}  // namespace mcr
+}  // namespace art
+
+#endif  // ART_COMPILER_MCR_HOT_REGION_H_
@@ -28,7 +28,8 @@
 
 #include <algorithm>
 #include <string>
-#include "mcr_rt/filereader.h"
+#include <vector>
+#include "mcr_cc/invoke_histogram_index.h"
 #include "mcr_rt/mcr_rt.h"
 #include "mcr_rt/utils.h"
 
@@ -57,37 +58,29 @@ InvokeHistogram::InvokeHistogram(uint32_t caller_method_idx, uint32_t dex_pc, co
   GenerateSpeculationMap();
 }
 
+/**
+ * @brief Queries the process-wide index instead of re-reading the text
+ *        histogram. The OS to app calls were already filtered at import.
+ */
 void InvokeHistogram::Load() {
-  std::string filename = InvokeInfo::GetFilename();
-  FileReader fr(__func__, filename, false, true, true);
   D4LOG(INFO) << __PRETTY_FUNCTION__;
+  InvokeHistogramIndex* index = InvokeHistogramIndex::Current();
 
-  if (fr.exists()) {
-    for (std::string line : fr.GetData()) {
-      InvokeInfo info = mcr::InvokeInfo::ParseLine(line);
-      if (!filter_callee_dexfile_ ||  // dex2oat doesn't need this filter!
-          info.GetDexLocationCaller().compare(dex_location_) == 0) {
-        // the current method
-        if (load_all_ || info.GetCallerMethodIdx() == caller_method_idx_) {
-          if (McrRT::IsFrameworkDexLocation(info.GetDexLocationCaller()) &&
-              !McrRT::IsFrameworkDexLocation(info.GetDexLocation())) {
-            D1LOG(WARNING) << "Histogram:: IGNORING: " << line
-              << " | OS to app call";
-          } else {
-            histogram_.insert(info);
-          }
-        }
-      }
-    }
+  std::vector<InvokeInfo> entries;
+  if (!load_all_) {
+    entries = index->Lookup(dex_location_, caller_method_idx_, dex_pc_);
+  } else {
+    // dex2oat doesn't need the callee dexfile filter!
+    entries = index->GetAll(filter_callee_dexfile_ ? dex_location_ : nullptr);
   }
+  histogram_.insert(entries.begin(), entries.end());
 }
 
 void InvokeHistogram::GenerateSpeculationMap() {
   D3LOG(INFO) << "GenerateSpeculationMap: dex_pc:" << dex_pc_;
+  // Load already narrowed the histogram down to this call site
   for (mcr::InvokeInfo ii : histogram_) {
-    if (load_all_ || ii.GetDexPC() == dex_pc_) {
-      speculations_.insert(ii);
-    }
+    speculations_.insert(ii);
   }
 
   int s = speculations_.size();
@@ -0,0 +1,412 @@
+/**
+ * A process-wide index of the InvokeHistogram. Previously every virtual
+ * or interface call site re-read and re-parsed the whole text histogram.
+ *
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "mcr_cc/invoke_histogram_index.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+
+#include "base/os.h"
+#include "base/time_utils.h"
+#include "base/unix_file/fd_file.h"
+#include "mcr_rt/filereader.h"
+#include "mcr_rt/invoke_profile.h"
+#include "mcr_rt/mcr_rt.h"
+#include "mcr_rt/utils.h"
+
+namespace art {
+namespace mcr {
+
+constexpr uint8_t InvokeHistogramIndex::kMagic[];
+
+namespace {
+
+inline bool GetModificationInfo(const std::string& filename,
+                                uint64_t* size, uint64_t* mtime_ns) {
+  struct stat st;
+  if (stat(filename.c_str(), &st) != 0) return false;
+  *size = static_cast<uint64_t>(st.st_size);
+  *mtime_ns = static_cast<uint64_t>(st.st_mtim.tv_sec) * 1000000000u +
+    static_cast<uint64_t>(st.st_mtim.tv_nsec);
+  return true;
+}
+
+template <typename T>
+inline void Append(std::vector<uint8_t>* data, const T* src, size_t count) {
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(src);
+  data->insert(data->end(), bytes, bytes + sizeof(T) * count);
+}
+
+}  // namespace
+
+InvokeHistogramIndex* InvokeHistogramIndex::Current() {
+  static std::once_flag once;
+  static InvokeHistogramIndex* index = nullptr;
+  std::call_once(once, []() { index = new InvokeHistogramIndex(); });
+  return index;
+}
+
+std::string InvokeHistogramIndex::GetBinaryFilename() {
+  return GetFileApp(FILE_INVOKE_HISTOGRAM_BIN);
+}
+
+InvokeHistogramIndex::InvokeHistogramIndex() {
+  uint64_t s = NanoTime();
+  std::string text_filename = InvokeInfo::GetFilename();
+  std::string delta_filename = InvokeProfile::GetDeltaFilename();
+  std::string bin_filename = GetBinaryFilename();
+
+  // The binary is valid only when it was generated from the current text
+  // file, and the runtime appended no deltas since. Without a text file it
+  // is never used: a deleted profile must not steer the speculation.
+  bool loaded = false;
+  uint64_t text_size, text_mtime;
+  const bool has_text =
+    GetModificationInfo(text_filename, &text_size, &text_mtime);
+  if (has_text && OS::FileExists(bin_filename.c_str()) &&
+      MapBinary(bin_filename)) {
+    uint64_t delta_size, delta_mtime;
+    if (!GetModificationInfo(delta_filename, &delta_size, &delta_mtime)) {
+      delta_size = 0;
+    }
+    if (header_->delta_size_ == delta_size &&
+        header_->text_size_ == text_size && header_->text_mtime_ == text_mtime) {
+      loaded = true;
+      D2LOG(INFO) << "InvokeHistogramIndex: mapped: " << bin_filename;
+    } else {
+      D2LOG(INFO) << "InvokeHistogramIndex: outdated: " << bin_filename;
+      map_.Reset();
+      header_ = nullptr;
+    }
+  }
+
+  if (!loaded && (has_text || OS::FileExists(delta_filename.c_str()))) {
+    // Only deltas: parsed on every run, as the binary needs a text file
+    if (Import(text_filename, delta_filename) && has_text) {
+      WriteBinary(bin_filename);
+    }
+  }
+  if (!has_text && OS::FileExists(bin_filename.c_str())) {
+    D2LOG(INFO) << "InvokeHistogramIndex: no text histogram: removing: "
+      << bin_filename;
+    unlink(bin_filename.c_str());
+  }
+
+  D1LOG(INFO) << "InvokeHistogramIndex: " << GetSize() << " entries in "
+    << PrettyDuration(NanoTime() - s);
+}
+
+bool InvokeHistogramIndex::MapBinary(const std::string& filename) {
+  std::unique_ptr<File> file(OS::OpenFileForReading(filename.c_str()));
+  if (file == nullptr) {
+    DLOG(ERROR) << "InvokeHistogramIndex: can't open: " << filename;
+    return false;
+  }
+
+  int64_t length = file->GetLength();
+  if (length < static_cast<int64_t>(sizeof(Header))) {
+    DLOG(ERROR) << "InvokeHistogramIndex: truncated: " << filename;
+    return false;
+  }
+
+  std::string error_msg;
+  map_ = MemMap::MapFile(length, PROT_READ, MAP_PRIVATE, file->Fd(),
+      /* start= */ 0, /* low_4gb= */ false, filename.c_str(), &error_msg);
+  if (!map_.IsValid()) {
+    DLOG(ERROR) << "InvokeHistogramIndex: mmap failed: " << error_msg;
+    return false;
+  }
+  return SetupPointers(map_.Begin(), map_.Size());
+}
+
+bool InvokeHistogramIndex::SetupPointers(const uint8_t* begin, size_t size) {
+  header_ = reinterpret_cast<const Header*>(begin);
+  if (memcmp(header_->magic_, kMagic, sizeof(kMagic)) != 0 ||
+      header_->version_ != kVersion) {
+    DLOG(ERROR) << "InvokeHistogramIndex: wrong magic/version";
+    header_ = nullptr;
+    return false;
+  }
+
+  const size_t expected = sizeof(Header) +
+    sizeof(uint32_t) * header_->num_strings_ +
+    sizeof(Entry) * header_->num_entries_ +
+    header_->strings_size_;
+  if (expected != size) {
+    DLOG(ERROR) << "InvokeHistogramIndex: size mismatch: " << size
+      << " expected: " << expected;
+    header_ = nullptr;
+    return false;
+  }
+
+  const uint8_t* ptr = begin + sizeof(Header);
+  string_offsets_ = reinterpret_cast<const uint32_t*>(ptr);
+  ptr += sizeof(uint32_t) * header_->num_strings_;
+  entries_ = reinterpret_cast<const Entry*>(ptr);
+  ptr += sizeof(Entry) * header_->num_entries_;
+  strings_ = reinterpret_cast<const char*>(ptr);
+  size_ = size;
+
+  string_ids_.clear();
+  for (uint32_t id = 0; id < header_->num_strings_; id++) {
+    if (string_offsets_[id] >= header_->strings_size_) {
+      DLOG(ERROR) << "InvokeHistogramIndex: corrupted string table";
+      header_ = nullptr;
+      return false;
+    }
+    string_ids_.emplace(GetString(id), id);
+  }
+  return true;
+}
+
+/**
+ * @brief Parses the text histogram once, adds the runtime deltas
+ *        (InvokeProfile), and lays it out like the binary.
+ */
+bool InvokeHistogramIndex::Import(const std::string& filename,
+                                  const std::string& delta_filename) {
+  std::vector<std::string> strings;
+  std::unordered_map<std::string, uint32_t> ids;
+  auto intern = [&](const std::string& str) -> uint32_t {
+    auto it = ids.find(str);
+    if (it != ids.end()) return it->second;
+    uint32_t id = strings.size();
+    strings.push_back(str);
+    ids.emplace(str, id);
+    return id;
+  };
+
+  std::vector<InvokeInfo> infos;
+  if (OS::FileExists(filename.c_str())) {
+    FileReader fr(__func__, filename, false, false, true);
+    for (const std::string& line : fr.GetData()) {
+      if (line.empty()) continue;
+      infos.push_back(InvokeInfo::ParseLine(line));
+    }
+  }
+  if (OS::FileExists(delta_filename.c_str())) {
+    InvokeProfile::ReadDeltas(delta_filename, &infos);
+  }
+
+  std::vector<Entry> entries;
+  std::unordered_map<std::string, size_t> entry_ids;
+  for (const InvokeInfo& info : infos) {
+    if (McrRT::IsFrameworkDexLocation(info.GetDexLocationCaller()) &&
+        !McrRT::IsFrameworkDexLocation(info.GetDexLocation())) {
+      D1LOG(WARNING) << "Histogram:: IGNORING: " << info
+        << " | OS to app call";
+      continue;
+    }
+
+    // same speculation: from the text and from (several) deltas
+    std::string key = info.str();
+    auto it = entry_ids.find(key);
+    if (it != entry_ids.end()) {
+      uint32_t& times = entries[it->second].invoke_times_;
+      times = (times > UINT32_MAX - info.GetInvokeTimes()) ?
+        UINT32_MAX : times + info.GetInvokeTimes();
+      continue;
+    }
+    entry_ids.emplace(key, entries.size());
+
+    Entry entry;
+    entry.dex_location_caller_ = intern(info.GetDexLocationCaller());
+    entry.dex_filename_ = intern(info.GetDexFilename());
+    entry.dex_location_ = intern(info.GetDexLocation());
+    entry.dex_location_class_ = intern(info.GetSpecClassDexLocation());
+    entry.caller_method_idx_ = info.GetCallerMethodIdx();
+    entry.dex_pc_ = info.GetDexPC();
+    entry.spec_class_idx_ = info.GetSpecClassIdx();
+    entry.spec_method_idx_ = info.GetSpecMethodIdx();
+    entry.spec_invoke_type_ = info.GetSpecInvokeTypeInt();
+    entry.invoke_times_ = info.GetInvokeTimes();
+    entries.push_back(entry);
+  }
+  std::sort(entries.begin(), entries.end(), IsEntryLess);
+
+  std::vector<uint32_t> offsets;
+  std::string string_data;
+  for (const std::string& str : strings) {
+    offsets.push_back(string_data.size());
+    string_data.append(str);
+    string_data.push_back('\0');
+  }
+
+  Header header = {};
+  memcpy(header.magic_, kMagic, sizeof(kMagic));
+  header.version_ = kVersion;
+  header.num_strings_ = strings.size();
+  header.num_entries_ = entries.size();
+  header.strings_size_ = string_data.size();
+  if (!GetModificationInfo(filename, &header.text_size_, &header.text_mtime_)) {
+    header.text_size_ = header.text_mtime_ = 0;
+  }
+  uint64_t delta_mtime;
+  if (!GetModificationInfo(delta_filename, &header.delta_size_, &delta_mtime)) {
+    header.delta_size_ = 0;
+  }
+
+  data_.clear();
+  Append(&data_, &header, 1);
+  Append(&data_, offsets.data(), offsets.size());
+  Append(&data_, entries.data(), entries.size());
+  Append(&data_, string_data.data(), string_data.size());
+
+  return SetupPointers(data_.data(), data_.size());
+}
+
+bool InvokeHistogramIndex::WriteBinary(const std::string& filename) const {
+  if (header_ == nullptr) return false;
+  std::ofstream out(filename, std::ofstream::binary | std::ofstream::trunc);
+  if (!out) {
+    DLOG(ERROR) << "InvokeHistogramIndex: can't write: " << filename;
+    return false;
+  }
+  out.write(reinterpret_cast<const char*>(header_), size_);
+  out.close();
+  chmod(filename.c_str(), 0666);
+  D2LOG(INFO) << "InvokeHistogramIndex: stored: " << filename;
+  return true;
+}
+
+bool InvokeHistogramIndex::ExportText(std::string filename) const {
+  std::ofstream out(filename);
+  if (!out) return false;
+  for (InvokeInfo ii : GetAll()) {
+    out << ii.str() << InvokeInfo::sep_
+      << std::to_string(ii.GetInvokeTimes()) << std::endl;
+  }
+  out.close();
+  chmod(filename.c_str(), 0666);
+  return true;
+}
+
+bool InvokeHistogramIndex::IsEntryLess(const Entry& lhs, const Entry& rhs) {
+  if (lhs.dex_location_caller_ != rhs.dex_location_caller_) {
+    return lhs.dex_location_caller_ < rhs.dex_location_caller_;
+  }
+  if (lhs.caller_method_idx_ != rhs.caller_method_idx_) {
+    return lhs.caller_method_idx_ < rhs.caller_method_idx_;
+  }
+  if (lhs.dex_pc_ != rhs.dex_pc_) {
+    return lhs.dex_pc_ < rhs.dex_pc_;
+  }
+  // most frequent speculation first
+  return lhs.invoke_times_ > rhs.invoke_times_;
+}
+
+const char* InvokeHistogramIndex::GetString(uint32_t id) const {
+  return strings_ + string_offsets_[id];
+}
+
+InvokeInfo InvokeHistogramIndex::ToInvokeInfo(const Entry& entry) const {
+  return InvokeInfo(entry.caller_method_idx_, entry.dex_pc_,
+                    entry.spec_class_idx_, entry.spec_method_idx_,
+                    static_cast<InvokeType>(entry.spec_invoke_type_),
+                    GetString(entry.dex_location_caller_),
+                    GetString(entry.dex_filename_),
+                    GetString(entry.dex_location_),
+                    entry.invoke_times_,
+                    GetString(entry.dex_location_class_));
+}
+
+std::vector<InvokeInfo> InvokeHistogramIndex::Lookup(
+    const std::string& dex_location_caller,
+    uint32_t caller_method_idx, uint32_t dex_pc) const {
+  std::vector<InvokeInfo> result;
+  if (header_ == nullptr) return result;
+  auto it = string_ids_.find(dex_location_caller);
+  if (it == string_ids_.end()) return result;
+
+  auto key_less = [](const Entry& lhs, const Entry& rhs) {
+    if (lhs.dex_location_caller_ != rhs.dex_location_caller_) {
+      return lhs.dex_location_caller_ < rhs.dex_location_caller_;
+    }
+    if (lhs.caller_method_idx_ != rhs.caller_method_idx_) {
+      return lhs.caller_method_idx_ < rhs.caller_method_idx_;
+    }
+    return lhs.dex_pc_ < rhs.dex_pc_;
+  };
+
+  Entry key;
+  key.dex_location_caller_ = it->second;
+  key.caller_method_idx_ = caller_method_idx;
+  key.dex_pc_ = dex_pc;
+  const Entry* end = entries_ + header_->num_entries_;
+  auto range = std::equal_range(entries_, end, key, key_less);
+  for (const Entry* e = range.first; e != range.second; e++) {
+    result.push_back(ToInvokeInfo(*e));
+  }
+  return result;
+}
+
+std::vector<InvokeInfo> InvokeHistogramIndex::LookupMethod(
+    const std::string& dex_location_caller, uint32_t caller_method_idx) const {
+  std::vector<InvokeInfo> result;
+  if (header_ == nullptr) return result;
+  auto it = string_ids_.find(dex_location_caller);
+  if (it == string_ids_.end()) return result;
+
+  auto key_less = [](const Entry& lhs, const Entry& rhs) {
+    if (lhs.dex_location_caller_ != rhs.dex_location_caller_) {
+      return lhs.dex_location_caller_ < rhs.dex_location_caller_;
+    }
+    return lhs.caller_method_idx_ < rhs.caller_method_idx_;
+  };
+
+  Entry key;
+  key.dex_location_caller_ = it->second;
+  key.caller_method_idx_ = caller_method_idx;
+  const Entry* end = entries_ + header_->num_entries_;
+  auto range = std::equal_range(entries_, end, key, key_less);
+  for (const Entry* e = range.first; e != range.second; e++) {
+    result.push_back(ToInvokeInfo(*e));
+  }
+  return result;
+}
+
+std::vector<InvokeInfo> InvokeHistogramIndex::GetAll(
+    const char* dex_location_caller) const {
+  std::vector<InvokeInfo> result;
+  if (header_ == nullptr) return result;
+
+  uint32_t caller_id = 0;
+  if (dex_location_caller != nullptr) {
+    auto it = string_ids_.find(dex_location_caller);
+    if (it == string_ids_.end()) return result;
+    caller_id = it->second;
+  }
+
+  for (uint32_t i = 0; i < header_->num_entries_; i++) {
+    const Entry& entry = entries_[i];
+    if (dex_location_caller == nullptr ||
+        entry.dex_location_caller_ == caller_id) {
+      result.push_back(ToInvokeInfo(entry));
+    }
+  }
+  return result;
+}
+
+}  // namespace mcr
+}  // namespace art
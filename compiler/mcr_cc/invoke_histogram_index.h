@@ -0,0 +1,139 @@
+/**
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef ART_COMPILER_MCR_INVOKE_HISTOGRAM_INDEX_H_
+#define ART_COMPILER_MCR_INVOKE_HISTOGRAM_INDEX_H_
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/mem_map.h"
+#include "mcr_rt/invoke_info.h"
+
+#define FILE_INVOKE_HISTOGRAM_BIN "invoke.hist.bin"
+
+namespace art {
+namespace mcr {
+
+/**
+ * @brief Read-only index over the invoke histogram, built once per
+ *        dex2oat run, and keyed by:
+ *        (caller dex location, caller method idx, dex_pc)
+ *
+ * Backed by a binary file that is mmapped. When the text histogram
+ * (the import/export format) has changed since the binary was generated,
+ * or the runtime appended more deltas (InvokeProfile), both are parsed
+ * once and the binary file is regenerated. Without the text histogram the
+ * binary file is removed (the deltas alone are parsed on every run).
+ *
+ * Binary layout (native endianness):
+ *   Header
+ *   uint32_t string_offsets[num_strings]  (relative to the string data)
+ *   Entry entries[num_entries]            (sorted by IsEntryLess)
+ *   char strings[]                        (NUL terminated)
+ */
+class InvokeHistogramIndex final {
+ public:
+  static InvokeHistogramIndex* Current();
+
+  // Speculations of a call site, most frequent first.
+  std::vector<InvokeInfo> Lookup(const std::string& dex_location_caller,
+                                 uint32_t caller_method_idx,
+                                 uint32_t dex_pc) const;
+
+  // All call sites of a method (including those of inlined code).
+  std::vector<InvokeInfo> LookupMethod(const std::string& dex_location_caller,
+                                       uint32_t caller_method_idx) const;
+
+  // All entries, or only those of the callers in a dex location.
+  std::vector<InvokeInfo> GetAll(const char* dex_location_caller = nullptr) const;
+
+  uint32_t GetSize() const {
+    return header_ == nullptr ? 0 : header_->num_entries_;
+  }
+
+  bool ExportText(std::string filename) const;
+
+  static std::string GetBinaryFilename();
+
+ private:
+  static constexpr uint8_t kMagic[] = { 'h', 'i', 's', 't' };
+  static constexpr uint32_t kVersion = 3;
+
+  struct Header {
+    uint8_t magic_[4];
+    uint32_t version_;
+    uint32_t num_strings_;
+    uint32_t num_entries_;
+    uint32_t strings_size_;
+    // explicit, so the file has no uninitialized bytes
+    uint32_t padding_;
+    // stat of the text histogram this was generated from
+    uint64_t text_size_;
+    uint64_t text_mtime_;
+    // size of the runtime deltas that were folded in (append only)
+    uint64_t delta_size_;
+  };
+  static_assert(sizeof(Header) == 48, "Header has implicit padding");
+
+  struct Entry {
+    // string ids
+    uint32_t dex_location_caller_;
+    uint32_t dex_filename_;
+    uint32_t dex_location_;
+    uint32_t dex_location_class_;
+
+    uint32_t caller_method_idx_;
+    uint32_t dex_pc_;
+    uint32_t spec_class_idx_;
+    uint32_t spec_method_idx_;
+    uint32_t spec_invoke_type_;
+    uint32_t invoke_times_;
+  };
+
+  InvokeHistogramIndex();
+
+  bool MapBinary(const std::string& filename);
+  bool Import(const std::string& filename, const std::string& delta_filename);
+  bool WriteBinary(const std::string& filename) const;
+  bool SetupPointers(const uint8_t* begin, size_t size);
+
+  const char* GetString(uint32_t id) const;
+  InvokeInfo ToInvokeInfo(const Entry& entry) const;
+
+  static bool IsEntryLess(const Entry& lhs, const Entry& rhs);
+
+  // Only one of them holds the data
+  MemMap map_;
+  std::vector<uint8_t> data_;
+
+  const Header* header_ = nullptr;
+  const uint32_t* string_offsets_ = nullptr;
+  const Entry* entries_ = nullptr;
+  const char* strings_ = nullptr;
+  size_t size_ = 0;
+
+  std::unordered_map<std::string, uint32_t> string_ids_;
+
+  DISALLOW_COPY_AND_ASSIGN(InvokeHistogramIndex);
+};
+
+}  // namespace mcr
+}  // namespace art
+
+#endif  // ART_COMPILER_MCR_INVOKE_HISTOGRAM_INDEX_H_
@@ -0,0 +1,450 @@
+/**
+ * Iterative compilation of the hot regions: searches the opt/llc flags of
+ * each region with the compilation plans of the PassManager
+ * (see iterative_search.h).
+ *
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "mcr_cc/iterative_search.h"
+
+#include <stdio.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <functional>
+#include <set>
+#include <thread>
+#include "base/os.h"
+#include "mcr_cc/compilation_cache.h"
+#include "mcr_cc/llc_interface.h"
+#include "mcr_cc/llvm/debug.h"
+#include "mcr_cc/mcr_cc.h"
+#include "mcr_cc/pass_manager.h"
+#include "mcr_rt/mcr_rt.h"
+#include "mcr_rt/utils.h"
+
+namespace art {
+namespace mcr {
+
+static std::string Trim(std::string str) {
+  const size_t start = str.find_first_not_of(" \t\r\n");
+  if (start == std::string::npos) return "";
+  return str.substr(start, str.find_last_not_of(" \t\r\n") - start + 1);
+}
+
+static void ReplaceAll(std::string* str, std::string from, std::string to) {
+  for (size_t pos = str->find(from); pos != std::string::npos;
+       pos = str->find(from, pos + to.size())) {
+    str->replace(pos, from.size(), to);
+  }
+}
+
+bool IterativeSearch::IsEnabled() {
+  return OS::FileExists(GetFileApp(FILE_SEARCH_CONFIG).c_str());
+}
+
+IterativeSearch::IterativeSearch(InstructionSet instruction_set,
+    bool emit_llvm, bool emit_asm, std::string extraOptFlags)
+  : instruction_set_(instruction_set), emit_llvm_(emit_llvm),
+    emit_asm_(emit_asm), extra_opt_flags_(extraOptFlags) {}
+
+bool IterativeSearch::Run(InstructionSet instruction_set, bool emit_llvm,
+    bool emit_asm, std::string extraOptFlags, size_t thread_count) {
+  IterativeSearch search(instruction_set, emit_llvm, emit_asm, extraOptFlags);
+  if (!search.ReadConfig()) return false;
+  search.ReadDatabase();
+
+  const std::vector<std::unique_ptr<HotRegion>>& regions = McrCC::GetRegions();
+  if (McrDebug::LlvmExternalTools()) thread_count = 1;
+  thread_count = std::max<size_t>(1, std::min(thread_count, regions.size()));
+  DLOG(INFO) << "IterativeSearch: " << regions.size() << " regions on "
+    << thread_count << " threads: " << search.flags_.size()
+    << " flags, budget: " << search.budget_;
+
+  // the candidates of a region share its src dir: they are compiled in order
+  std::atomic<size_t> next(0);
+  std::atomic<uint32_t> failed(0);
+  auto worker = [&]() {
+    for (size_t i = next++; i < regions.size(); i = next++) {
+      const std::string& entrypoint = regions[i]->GetEntrypoint();
+      if (!search.SearchRegion(entrypoint)) {
+        DLOG(ERROR) << "IterativeSearch: failed: region: " << entrypoint;
+        failed++;
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < thread_count; i++) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  search.WriteReport();
+  CompilationCache::PrintReport();
+  return failed == 0;
+}
+
+bool IterativeSearch::ReadConfig() {
+  std::string filename = GetFileApp(FILE_SEARCH_CONFIG);
+  std::ifstream in(filename);
+  if (!in) {
+    DLOG(ERROR) << "IterativeSearch: can't read: " << filename;
+    return false;
+  }
+  std::string line;
+  while (std::getline(in, line)) {
+    line = Trim(line);
+    const size_t colon = line.find(':');
+    if (line.empty() || line[0] == '#' || colon == std::string::npos) continue;
+    const std::string key = Trim(line.substr(0, colon));
+    const std::string value = Trim(line.substr(colon + 1));
+    if (key == "strategy") {
+      if (value == "random") {
+        strategy_ = Strategy::kRandom;
+      } else if (value == "genetic") {
+        strategy_ = Strategy::kGenetic;
+      } else if (value == "ablation") {
+        strategy_ = Strategy::kAblation;
+      } else {
+        DLOG(ERROR) << "IterativeSearch: unknown strategy: " << value;
+        return false;
+      }
+    } else if (key == "budget") {
+      budget_ = std::max(1, atoi(value.c_str()));
+    } else if (key == "seed") {
+      seed_ = static_cast<uint32_t>(strtoul(value.c_str(), nullptr, 10));
+    } else if (key == "evaluator") {
+      evaluator_ = value;
+    } else if ((key == "opt" || key == "llc") && !value.empty()) {
+      flags_.push_back(Flag { key == "llc", value });
+    } else {
+      DLOG(WARNING) << "IterativeSearch: ignoring: " << line;
+    }
+  }
+
+  if (flags_.empty()) {
+    DLOG(ERROR) << "IterativeSearch: no flags to search: " << filename;
+    return false;
+  }
+  if (evaluator_.empty()) {
+    DLOG(WARNING) << "IterativeSearch: no evaluator: scoring the code size"
+      << " (the metric in " << FILE_SEARCH_BEST << ")";
+  }
+  return true;
+}
+
+void IterativeSearch::ReadDatabase() {
+  std::ifstream in(GetFileApp(FILE_SEARCH_DB));
+  std::string line;
+  while (std::getline(in, line)) {
+    // the flags may be empty
+    std::vector<std::string> fields;
+    size_t start = 0;
+    for (size_t tab = line.find('\t'); tab != std::string::npos;
+         start = tab + 1, tab = line.find('\t', start)) {
+      fields.push_back(line.substr(start, tab - start));
+    }
+    fields.push_back(line.substr(start));
+    // older rows have no metric: their scores are not comparable
+    if (fields.size() != 5) continue;
+    // entrypoint, metric, opt, llc: as in GetKey
+    results_[fields[0] + "\t" + fields[4] + "\t" + fields[2] + "\t" +
+             fields[3]] = atof(fields[1].c_str());
+  }
+  D2LOG(INFO) << "IterativeSearch: " << results_.size()
+    << " known configurations";
+}
+
+/**
+ * @brief Evaluates up to budget_ configurations of the region, and leaves
+ *        it compiled with the best one.
+ */
+bool IterativeSearch::SearchRegion(std::string entrypoint) {
+  std::mt19937 rng(seed_ + std::hash<std::string>()(entrypoint));
+  std::vector<Config> candidates = GetInitialConfigs(&rng);
+  std::vector<std::pair<double, Config>> ranked;
+  std::set<Config> seen;
+  size_t evaluations = 0;
+
+  while (evaluations < budget_ && !candidates.empty()) {
+    const size_t prev_evaluations = evaluations;
+    for (const Config& config : candidates) {
+      if (evaluations >= budget_) break;
+      if (!seen.insert(config).second) continue;
+      ranked.emplace_back(Evaluate(entrypoint, config), config);
+      evaluations++;
+    }
+    candidates.clear();
+    // the space is (nearly) exhausted
+    if (evaluations == prev_evaluations) break;
+    if (strategy_ == Strategy::kGenetic && evaluations < budget_) {
+      std::stable_sort(ranked.begin(), ranked.end(),
+          [](const std::pair<double, Config>& a,
+             const std::pair<double, Config>& b) {
+            return a.first < b.first;
+          });
+      candidates = GetNextGeneration(ranked, &rng);
+    } else if (strategy_ == Strategy::kRandom && evaluations < budget_) {
+      candidates = GetInitialConfigs(&rng);
+    }
+  }
+
+  auto best = std::min_element(ranked.begin(), ranked.end(),
+      [](const std::pair<double, Config>& a,
+         const std::pair<double, Config>& b) {
+        return a.first < b.first;
+      });
+  if (best == ranked.end() || best->first == kFailed) {
+    DLOG(ERROR) << "IterativeSearch: no valid configuration: " << entrypoint;
+    return false;
+  }
+  {
+    std::lock_guard<std::mutex> lock(lock_);
+    best_[entrypoint] = *best;
+  }
+  D1LOG(INFO) << "IterativeSearch: best: " << best->first
+    << ": opt: " << GetFlags(best->second, false)
+    << " llc: " << GetFlags(best->second, true) << ": " << entrypoint;
+  return Compile(entrypoint, best->second);
+}
+
+/**
+ * @brief random: each flag with a probability of 0.5.
+ *        genetic: a random population, with the empty configuration.
+ *        ablation: the empty configuration, and each flag alone.
+ */
+std::vector<IterativeSearch::Config> IterativeSearch::GetInitialConfigs(
+    std::mt19937* rng) {
+  std::vector<Config> configs;
+  configs.emplace_back(flags_.size(), false);
+  if (strategy_ == Strategy::kAblation) {
+    for (size_t i = 0; i < flags_.size(); i++) {
+      configs.emplace_back(flags_.size(), false);
+      configs.back()[i] = true;
+    }
+    return configs;
+  }
+  std::bernoulli_distribution coin(0.5);
+  const size_t num = strategy_ == Strategy::kGenetic ? kPopulation : budget_;
+  while (configs.size() < num) {
+    Config config(flags_.size());
+    for (size_t i = 0; i < config.size(); i++) {
+      config[i] = coin(*rng);
+    }
+    configs.push_back(config);
+  }
+  return configs;
+}
+
+/**
+ * @brief The fittest half survives (ranked: best first). The rest of the
+ *        population are their children, with uniform crossover and a
+ *        mutation rate of one flag per child.
+ */
+std::vector<IterativeSearch::Config> IterativeSearch::GetNextGeneration(
+    const std::vector<std::pair<double, Config>>& ranked,
+    std::mt19937* rng) {
+  const size_t num_parents = std::max<size_t>(1,
+      std::min(kPopulation / 2, ranked.size()));
+  std::uniform_int_distribution<size_t> pick(0, num_parents - 1);
+  std::bernoulli_distribution coin(0.5);
+  std::bernoulli_distribution mutate(1.0 / flags_.size());
+
+  std::vector<Config> configs;
+  for (size_t c = 0; c < kPopulation; c++) {
+    const Config& a = ranked[pick(*rng)].second;
+    const Config& b = ranked[pick(*rng)].second;
+    Config child(flags_.size());
+    for (size_t i = 0; i < child.size(); i++) {
+      child[i] = coin(*rng) ? a[i] : b[i];
+      if (mutate(*rng)) child[i] = !child[i];
+    }
+    configs.push_back(child);
+  }
+  return configs;
+}
+
+double IterativeSearch::Evaluate(std::string entrypoint,
+                                 const Config& config) {
+  const std::string key = GetKey(entrypoint, config);
+  {
+    std::lock_guard<std::mutex> lock(lock_);
+    auto it = results_.find(key);
+    if (it != results_.end()) {
+      D3LOG(INFO) << "IterativeSearch: known: " << it->second << ": " << key;
+      return it->second;
+    }
+  }
+
+  double score = kFailed;
+  if (Compile(entrypoint, config)) {
+    score = RunEvaluator(entrypoint);
+  }
+  D2LOG(INFO) << "IterativeSearch: " << score << ": " << key;
+  AddResult(entrypoint, config, score);
+  return score;
+}
+
+/**
+ * @brief The plan of the region carries the configuration to the compiler.
+ *        Its cl options are in effect only while the candidate compiles
+ *        (LlvmPipeline), so they are not left to the next candidates, or to
+ *        the regions that compile meanwhile.
+ */
+bool IterativeSearch::Compile(std::string entrypoint, const Config& config) {
+  if (!PassManager::WritePlan(GetFileSrc(entrypoint, FILE_COMPILE_PLAN),
+        GetFlags(config, false), GetFlags(config, true))) {
+    return false;
+  }
+  return LlcInterface::Compile(entrypoint, instruction_set_, emit_llvm_,
+      emit_asm_, extra_opt_flags_);
+}
+
+/**
+ * @brief Lower is better. Without an evaluator, it is the size of hf.so.
+ */
+double IterativeSearch::RunEvaluator(std::string entrypoint) {
+  std::string file_so = GetFileSrc(entrypoint, HFso);
+  if (evaluator_.empty()) {
+    struct stat st;
+    if (stat(file_so.c_str(), &st) != 0) return kFailed;
+    return static_cast<double>(st.st_size);
+  }
+
+  std::string cmd = evaluator_;
+  ReplaceAll(&cmd, "{so}", file_so);
+  ReplaceAll(&cmd, "{entrypoint}", entrypoint);
+  ReplaceAll(&cmd, "{dir}", GetFileSrc(entrypoint, ""));
+  cmd = "timeout 600s " + cmd + " 2>/dev/null";
+  D4LOG(INFO) << "IterativeSearch: EXEC: " << cmd;
+
+  FILE* pp = popen(cmd.c_str(), "r");
+  if (!pp) {
+    DLOG(ERROR) << "IterativeSearch: failed to popen: " << cmd;
+    return kFailed;
+  }
+  std::string last_line;
+  char buffer[256];
+  while (fgets(buffer, sizeof(buffer), pp) != nullptr) {
+    std::string line = Trim(buffer);
+    if (!line.empty()) last_line = line;
+  }
+  const int exit_code = WEXITSTATUS(pclose(pp));
+  if (exit_code != 0) {
+    D2LOG(WARNING) << "IterativeSearch: evaluator: exit code: " << exit_code
+      << ": " << entrypoint;
+    return kFailed;
+  }
+  char* end = nullptr;
+  const double score = strtod(last_line.c_str(), &end);
+  if (end == last_line.c_str()) {
+    DLOG(ERROR) << "IterativeSearch: evaluator: not a score: '" << last_line
+      << "': " << entrypoint;
+    return kFailed;
+  }
+  return score;
+}
+
+/**
+ * @brief What RunEvaluator scores, so scores of other metrics are not reused
+ *        (search.db), and search.best says what its scores are.
+ */
+std::string IterativeSearch::GetMetric() {
+  if (evaluator_.empty()) return "hf.so size";
+  return "evaluator: " + evaluator_;
+}
+
+/**
+ * @brief The flags of the configuration, on top of the plan of the app.
+ */
+std::string IterativeSearch::GetFlags(const Config& config, bool llc) {
+  std::string flags = llc ? PassManager::GetCompilationFlagsLLC()
+                          : PassManager::GetCompilationFlagsOPT();
+  for (size_t i = 0; i < flags_.size(); i++) {
+    if (config[i] && flags_[i].llc == llc) {
+      flags += " " + flags_[i].flag;
+    }
+  }
+  return Trim(flags);
+}
+
+/**
+ * @brief The flags that the candidate is compiled with: also the baseline,
+ *        and those of every region (see LlcInterface::CompileInProcess),
+ *        so results of an earlier run with others are not reused.
+ */
+std::string IterativeSearch::GetFlagsInEffect(const Config& config, bool llc) {
+  std::string flags = PassManager::GetBaseline();
+  if (llc) {
+    flags += " " ARCH_CL_FLAGS;
+    const std::string implicit_checks = "-enable-implicit-null-checks";
+    if (McrDebug::ImplicitChecks() &&
+        flags.find(implicit_checks) == std::string::npos) {
+      flags += " " + implicit_checks;
+    }
+  } else {
+    flags += " " OPT_FLAGS " " + extra_opt_flags_;
+  }
+  return Trim(flags + " " + GetFlags(config, llc));
+}
+
+std::string IterativeSearch::GetKey(std::string entrypoint,
+                                    const Config& config) {
+  return entrypoint + "\t" + GetMetric() + "\t" +
+    GetFlagsInEffect(config, false) + "\t" + GetFlagsInEffect(config, true);
+}
+
+void IterativeSearch::AddResult(std::string entrypoint, const Config& config,
+                                double score) {
+  std::lock_guard<std::mutex> lock(lock_);
+  results_[GetKey(entrypoint, config)] = score;
+
+  std::string filename = GetFileApp(FILE_SEARCH_DB);
+  std::ofstream out(filename, std::ios::app);
+  if (!out) {
+    DLOG(ERROR) << "IterativeSearch: can't write: " << filename;
+    return;
+  }
+  out << entrypoint << "\t" << score << "\t" << GetFlagsInEffect(config, false)
+      << "\t" << GetFlagsInEffect(config, true) << "\t" << GetMetric() << "\n";
+}
+
+void IterativeSearch::WriteReport() {
+  std::string filename = GetFileApp(FILE_SEARCH_BEST);
+  std::ofstream out(filename, std::ios::trunc);
+  if (!out) {
+    DLOG(ERROR) << "IterativeSearch: can't write: " << filename;
+    return;
+  }
+  out << "# metric: " << GetMetric() << " (lower is better)\n";
+  out << "# entrypoint\tscore\topt flags\tllc flags\n";
+  for (const auto& it : best_) {
+    out << it.first << "\t" << it.second.first << "\t"
+        << GetFlags(it.second.second, false) << "\t"
+        << GetFlags(it.second.second, true) << "\n";
+  }
+  out.close();
+  chmod(filename.c_str(), 0666);
+  DLOG(INFO) << "IterativeSearch: " << best_.size() << " regions: " << filename;
+}
+
+}  // namespace mcr
+}  // namespace art
@@ -0,0 +1,129 @@
+/**
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef ART_COMPILER_MCR_ITERATIVE_SEARCH_H_
+#define ART_COMPILER_MCR_ITERATIVE_SEARCH_H_
+
+#include <map>
+#include <mutex>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "arch/instruction_set.h"
+#include "base/macros.h"
+
+// Search space and strategy (in the app dir)
+#define FILE_SEARCH_CONFIG "search.conf"
+// Every evaluated configuration: entrypoint, score, opt flags, llc flags, metric
+#define FILE_SEARCH_DB "search.db"
+// Best configuration of each region
+#define FILE_SEARCH_BEST "search.best"
+
+namespace art {
+namespace mcr {
+
+/**
+ * @brief Iterative-compilation search of opt/llc flags, per hot region,
+ *        within an llvm-base compilation (instead of one plan.comp per run).
+ *
+ * search.conf:
+ *   strategy: random | genetic | ablation
+ *   budget: <max evaluations per region>
+ *   seed: <seed>
+ *   evaluator: <command>
+ *   opt: <flag>     (one per line: the search space)
+ *   llc: <flag>
+ *
+ * A configuration is a subset of the flags, on top of plan.comp.
+ * Each candidate is compiled to the hf.so of its region (through its plan),
+ * and the evaluator command scores it: {so}, {entrypoint}, and {dir} are
+ * replaced, and the last line of its output is the score (lower is better).
+ * It is where an on-host harness that replays the region plugs in.
+ * Without an evaluator the score is the size of hf.so (deterministic).
+ * The metric is kept with each score (search.db, search.best): scores of
+ * different metrics are not compared.
+ *
+ * Regions are searched in parallel. Evaluated configurations are kept in
+ * search.db and are not evaluated again. In the end each region is
+ * compiled with its best configuration, which stays as its plan.comp.
+ */
+class IterativeSearch final {
+ public:
+  static bool IsEnabled();
+  static bool Run(InstructionSet instruction_set, bool emit_llvm,
+                  bool emit_asm, std::string extraOptFlags,
+                  size_t thread_count);
+
+ private:
+  enum class Strategy { kRandom, kGenetic, kAblation };
+
+  struct Flag {
+    bool llc;
+    std::string flag;
+  };
+
+  typedef std::vector<bool> Config;
+
+  static constexpr double kFailed = 1e300;
+  static constexpr size_t kPopulation = 8;
+
+  IterativeSearch(InstructionSet instruction_set, bool emit_llvm,
+                  bool emit_asm, std::string extraOptFlags);
+
+  bool ReadConfig();
+  void ReadDatabase();
+  bool SearchRegion(std::string entrypoint);
+  bool Compile(std::string entrypoint, const Config& config);
+  void WriteReport();
+
+  std::vector<Config> GetInitialConfigs(std::mt19937* rng);
+  std::vector<Config> GetNextGeneration(
+      const std::vector<std::pair<double, Config>>& ranked,
+      std::mt19937* rng);
+
+  double Evaluate(std::string entrypoint, const Config& config);
+  double RunEvaluator(std::string entrypoint);
+  std::string GetMetric();
+  std::string GetFlags(const Config& config, bool llc);
+  std::string GetFlagsInEffect(const Config& config, bool llc);
+  std::string GetKey(std::string entrypoint, const Config& config);
+  void AddResult(std::string entrypoint, const Config& config, double score);
+
+  const InstructionSet instruction_set_;
+  const bool emit_llvm_;
+  const bool emit_asm_;
+  const std::string extra_opt_flags_;
+
+  Strategy strategy_ = Strategy::kRandom;
+  size_t budget_ = 16;
+  uint32_t seed_ = 0;
+  std::string evaluator_;
+  std::vector<Flag> flags_;
+
+  std::mutex lock_;
+  // scores of evaluated configurations (search.db)
+  std::map<std::string, double> results_;
+  // best score and configuration of each region
+  std::map<std::string, std::pair<double, Config>> best_;
+
+  DISALLOW_COPY_AND_ASSIGN(IterativeSearch);
+};
+
+}  // namespace mcr
+}  // namespace art
+
+#endif  // ART_COMPILER_MCR_ITERATIVE_SEARCH_H_
@@ -22,6 +22,7 @@
 #include <fstream>
 #include <queue>
 #include "base/os.h"
+#include "mcr_cc/llvm/debug.h"
 #include "mcr_cc/mcr_cc.h"
 #include "mcr_rt/filereader.h"
 #include "mcr_rt/mcr_rt.h"
@@ -32,30 +33,20 @@ namespace mcr {
 
 const std::string LinkerInterface::LINK = "llvm-link ";
 
-std::set<std::string> LinkerInterface::dependencies_;
-
 bool LinkerInterface::HasDependencies(std::string hf) {
   std::string link_filename = GetFileSrc(hf, FILE_DEPS_LINK);
   return OS::FileExists(link_filename.c_str());
 }
 
-void LinkerInterface::AddDependency(std::string caller, std::string callee) {
-  if (!caller.compare(callee)) {
-    D2LOG(INFO) << "AddDependency: skipping self: " << caller;
-    return;
-  }
-  D4LOG(INFO) << "AddDependency: " << caller;
-  dependencies_.insert(callee);
-}
-
-void LinkerInterface::StoreDependencies(std::string caller) {
+void LinkerInterface::StoreDependencies(std::string caller,
+    const std::set<std::string>& dependencies) {
   D3LOG(INFO) << "StoreDependencies";
   std::string link_filename = GetFileSrc(caller, FILE_DEPS_LINK);
   unlink(link_filename.c_str());
 
-  if (dependencies_.size() > 0) {
+  if (dependencies.size() > 0) {
     std::ofstream out(link_filename, std::ofstream::out);
-    for (std::string dependency : dependencies_) {
+    for (std::string dependency : dependencies) {
       out << dependency << "\n";
     }
     out.close();
@@ -66,11 +57,24 @@ void LinkerInterface::StoreDependencies(std::string caller) {
 /**
  * INFO we are already in the src dir by the llc_interface setup.
  */
-int LinkerInterface::LinkMethods(std::string start_method) {
-  D3LOG(INFO) << __func__ << ": " << start_method;
-  std::string cmd;
-
+/**
+ * @brief The bitcode files of a hot region: the outer and inner modules of
+ *        the entrypoint, and the inner modules of all its (transitive)
+ *        link dependencies, or just the region module (opt.region_module).
+ */
+std::set<std::string> LinkerInterface::GetLinkBitcodes(std::string start_method) {
   std::set<std::string> deps;
+  if (McrDebug::RegionModule()) {
+    // The whole region was generated in a single module (LLVM::LlvmRegion)
+    std::string region_bc = GetFileSrc(start_method, HFregionbc);
+    if (OS::FileExists(region_bc.c_str())) {
+      D3LOG(INFO) << "LNK: region module: " << start_method;
+      deps.insert(region_bc);
+      return deps;
+    }
+    DLOG(WARNING) << "LNK: no region module: linking per-method bitcode";
+  }
+
   deps.insert(GetFileSrc(start_method, McrCC::GetOuterBitcodeFilename()));
   deps.insert(GetFileSrc(start_method, McrCC::GetInnerBitcodeFilename()));
 
@@ -81,6 +85,14 @@ int LinkerInterface::LinkMethods(std::string start_method) {
       deps.insert(GetFileSrc(to_link_method, McrCC::GetInnerBitcodeFilename()));
     }
   }
+  return deps;
+}
+
+int LinkerInterface::LinkMethods(std::string start_method) {
+  D3LOG(INFO) << __func__ << ": " << start_method;
+  std::string cmd;
+
+  std::set<std::string> deps(GetLinkBitcodes(start_method));
 
   D3LOG(INFO) << __func__;
   std::string link_bitcodes;
@@ -25,17 +25,17 @@ namespace mcr {
 
 class LinkerInterface : public CompilerInterface {
  public:
-  static void AddDependency(std::string caller, std::string callee);
-  static void StoreDependencies(std::string caller);
+  static void StoreDependencies(std::string caller,
+                                const std::set<std::string>& dependencies);
   static bool HasDependencies(std::string hf);
 
   static int LinkMethods(std::string start_method);
   static bool Link2Methods(std::string method1, std::string method2,
                            std::string result);
   static std::set<std::string> GetLinkMethods(std::string start_method);
+  static std::set<std::string> GetLinkBitcodes(std::string start_method);
 
  private:
-  static std::set<std::string> dependencies_;
   static const std::string LINK;
 };
 
@@ -18,12 +18,25 @@
  */
 #include "mcr_cc/llc_interface.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
 #include "base/os.h"
 #include "base/time_utils.h"
 #include "mcr_cc/clang_interface.h"  // used for linking (lld wraper)
+#include "mcr_cc/compilation_cache.h"
 #include "mcr_cc/linker_interface.h"
+#include "mcr_cc/llvm/debug.h"
+#include "mcr_cc/llvm/fault_maps.h"
+#include "mcr_cc/llvm/llvm_pipeline.h"
+#include "mcr_cc/llvm/line_table.h"
+#include "mcr_cc/llvm/region_inliner.h"
+#include "mcr_cc/llvm/stack_maps.h"
 #include "mcr_cc/mcr_cc.h"
 #include "mcr_cc/pass_manager.h"
+#include "mcr_rt/llvm_fault_handler.h"
+#include "mcr_rt/llvm_profiler.h"
+#include "mcr_rt/llvm_stack_maps.h"
 #include "mcr_rt/mcr_rt.h"
 #include "mcr_rt/utils.h"
 
@@ -33,38 +46,197 @@ namespace mcr {
 const std::string LlcInterface::LLC = "llc ";
 const std::string LlcInterface::OPT = "opt ";
 
-bool LlcInterface::CleanupBeforeCompilation() {
-  if (OS::FileExists(HFso)) {
-    if (!EXE("rm -f " HFso)) return false;
-  }
-  if (OS::FileExists(HFlnkbc)) {
-    if (!EXE("rm -f " HFlnkbc)) return false;
+bool LlcInterface::CleanupBeforeCompilation(std::string entrypoint) {
+  for (const char* file : { HFso, HFlnkbc, HFo, HFstackmaps, HFlines,
+                            HFinline, HFfaults }) {
+    std::string filename = GetFileSrc(entrypoint, file);
+    if (OS::FileExists(filename.c_str())) {
+      if (!EXE("rm -f " + filename)) return false;
+    }
   }
+  return true;
+}
 
-  if (OS::FileExists(HFo)) {
-    if (!EXE("rm -f " HFo)) return false;
+bool LlcInterface::CleanupAfterCompilation(std::string entrypoint) {
+  if (!EXE("rm -f " + GetFileSrc(entrypoint, HFo))) return false;
+  return true;
+}
+
+/**
+ * @brief Compiles each hot region to its own hf.so.
+ *
+ * The in-process pipeline has its own LLVM context per region, so up to
+ * thread_count regions are compiled concurrently. The external tools work
+ * in the src dir of a region, so in that case regions go one by one.
+ *
+ * INFO dex2oat's ThreadPool needs a Runtime, which is not created in an
+ *      llvm-base compilation, therefore plain threads are used.
+ */
+bool LlcInterface::CompileRegions(InstructionSet instruction_set,
+    bool emit_llvm, bool emit_asm, std::string extraOptFlags,
+    size_t thread_count) {
+  const std::vector<std::unique_ptr<HotRegion>>& regions = McrCC::GetRegions();
+  if (McrDebug::LlvmExternalTools()) thread_count = 1;
+  thread_count = std::max<size_t>(1, std::min(thread_count, regions.size()));
+  D1LOG(INFO) << __func__ << ": " << regions.size() << " regions on "
+    << thread_count << " threads";
+
+  std::atomic<size_t> next(0);
+  std::atomic<uint32_t> failed(0);
+  auto worker = [&]() {
+    for (size_t i = next++; i < regions.size(); i = next++) {
+      const std::string& entrypoint = regions[i]->GetEntrypoint();
+      if (!Compile(entrypoint, instruction_set, emit_llvm, emit_asm, extraOptFlags)) {
+        DLOG(ERROR) << "LLVM compilation failed: region: " << entrypoint;
+        failed++;
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < thread_count; i++) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (std::thread& thread : threads) {
+    thread.join();
   }
+  CompilationCache::PrintReport();
+  return failed == 0;
+}
 
-  return true;
+bool LlcInterface::Compile(std::string entrypoint, InstructionSet instruction_set,
+    bool emit_llvm, bool emit_asm, std::string extraOptFlags) {
+  if (McrDebug::LlvmExternalTools()) {
+    return CompileWithExternalTools(entrypoint, emit_llvm, emit_asm, extraOptFlags);
+  }
+  return CompileInProcess(entrypoint, instruction_set, emit_llvm, emit_asm,
+      extraOptFlags);
 }
 
-bool LlcInterface::CleanupAfterCompilation() {
-  if (!EXE("rm -f " HFo)) return false;
+/**
+ * @brief Links, optimizes, and compiles a hot region within dex2oat.
+ *        Only the final object file is written (for lld).
+ *        With emit_llvm it also keeps the optimized bitcode.
+ */
+bool LlcInterface::CompileInProcess(std::string entrypoint,
+    InstructionSet instruction_set,
+    bool emit_llvm, bool emit_asm, std::string extraOptFlags) {
+  D3LOG(INFO) << __func__ << " "
+    <<  (emit_llvm? "emit-llvm": "")
+    <<  (emit_asm? "emit-asm": "") << ": " << entrypoint;
+  CleanupBeforeCompilation(entrypoint);
+
+  if (emit_asm) { DLOG(WARNING) << __func__ << ": Ignoring: emit_asm"; }
+
+  std::string opt_flags = spaced(OPT_FLAGS) + spaced(extraOptFlags) +
+    spaced(PassManager::GetCompilationFlagsOPT(entrypoint));
+  LLVM::LlvmPipeline pipeline(instruction_set, PassManager::GetBaseline(),
+      opt_flags, PassManager::GetCompilationFlagsLLC(entrypoint));
+
+  int linkedMethods = pipeline.Link(
+      LinkerInterface::GetLinkBitcodes(entrypoint));
+  if (linkedMethods == 0) return false;
+  D1LOG(INFO) << "linked " << linkedMethods
+    << " methods in " << PrettyDuration(pipeline.GetTimings().link_);
+  if (McrDebug::LineTable()) pipeline.CompleteDebugInfo();
+  // Before the cache key: the hints are part of the module
+  if (McrDebug::RegionInline()) {
+    std::string report = GetFileSrc(entrypoint, HFinline);
+    if (!pipeline.InlineRegion(entrypoint, report)) return false;
+    if (!CHMOD(report, "644")) return false;
+  }
+
+  // emit_llvm needs the optimized module, so it always goes through opt
+  std::string cache_key;
+  ::llvm::SmallVector<char, 0> object;
+  if (CompilationCache::IsEnabled() && !emit_llvm) {
+    ::llvm::SmallVector<char, 0> bitcode;
+    pipeline.GetBitcode(&bitcode);
+    cache_key = CompilationCache::GetObjectKey(bitcode,
+        GetInstructionSetString(instruction_set), PassManager::GetBaseline(),
+        opt_flags, PassManager::GetCompilationFlagsLLC(entrypoint));
+  }
+
+  if (!cache_key.empty() && CompilationCache::LoadObject(cache_key, &object)) {
+    D1LOG(INFO) << "CompilationCache: object hit: " << entrypoint;
+  } else {
+    if (!pipeline.EliminateDeadCode()) return false;
+    D2LOG(INFO) << "DCE pass in " << PrettyDuration(pipeline.GetTimings().dce_);
+
+    if (!pipeline.Optimize()) return false;
+    if (McrDebug::GcStackMaps() && !pipeline.RewriteStatepoints()) return false;
+    D2LOG(INFO) << "opt pass in " << PrettyDuration(pipeline.GetTimings().opt_);
+    if (emit_llvm) {
+      std::string optbc = GetFileSrc(entrypoint, HFoptbc);
+      if (!pipeline.WriteBitcode(optbc)) return false;
+      if (!CHMOD(optbc, "644")) return false;
+    }
+
+    if (!pipeline.EmitObject(&object)) return false;
+    D2LOG(INFO) << "llc pass in " << PrettyDuration(pipeline.GetTimings().llc_);
+    if (!cache_key.empty()) CompilationCache::StoreObject(cache_key, object);
+  }
+  pipeline.ReleaseOptions();
+  if (!LLVM::LlvmPipeline::WriteFile(GetFileSrc(entrypoint, HFo), object)) {
+    return false;
+  }
+
+  uint64_t s = NanoTime();
+  if (!ClangInterface::GenerateSharedObject(entrypoint, instruction_set)) {
+    return false;
+  }
+  CleanupAfterCompilation(entrypoint);
+  if (!CHMOD(GetFileSrc(entrypoint, HFso), "644")) return false;
+  if (McrDebug::GcStackMaps()) {
+    std::string stackmaps = GetFileSrc(entrypoint, HFstackmaps);
+    if (!LLVM::StackMaps::Translate(GetFileSrc(entrypoint, HFso),
+                                    instruction_set, stackmaps)) {
+      return false;
+    }
+    if (!CHMOD(stackmaps, "644")) return false;
+  }
+  if (McrDebug::LineTable()) {
+    std::string lines = GetFileSrc(entrypoint, HFlines);
+    if (!LLVM::LineTable::Translate(GetFileSrc(entrypoint, HFso), lines)) {
+      return false;
+    }
+    if (!CHMOD(lines, "644")) return false;
+  }
+  if (McrDebug::ImplicitChecks()) {
+    std::string faults = GetFileSrc(entrypoint, HFfaults);
+    if (!LLVM::FaultMaps::Translate(GetFileSrc(entrypoint, HFso), faults)) {
+      return false;
+    }
+    if (!CHMOD(faults, "644")) return false;
+  }
+  uint64_t t_ld = NanoTime() - s;
+
+  const LLVM::LlvmPipeline::Timings& t = pipeline.GetTimings();
+  uint64_t total_time = t.link_ + t.inline_ + t.dce_ + t.opt_ + t.llc_ + t_ld;
+  DLOG(INFO) << "LLVM compilation finished in " << PrettyDuration(total_time)
+    << " (" << pipeline.PrettyTimings() << " ld: " << PrettyDuration(t_ld) << ")"
+    << ": " << entrypoint;
+
   return true;
 }
 
-bool LlcInterface::Compile(bool emit_llvm, bool emit_asm,
-    std::string extraOptFlags) {
+/**
+ * @brief Runs llvm-link, opt, and llc as separate processes,
+ *        with intermediate bitcode files between them (debug option).
+ */
+bool LlcInterface::CompileWithExternalTools(std::string entrypoint,
+    bool emit_llvm, bool emit_asm, std::string extraOptFlags) {
   std::string extraLlcFlags="";
   D3LOG(INFO) << __func__ << " "
     <<  (emit_llvm? "emit-llvm": "")
     <<  (emit_asm? "emit-asm": "");
   std::string cmd;
-  std::string opt_flags(PassManager::GetCompilationFlagsOPT());
-  std::string llc_flags(PassManager::GetCompilationFlagsLLC());
-  std::string compiling_method = McrCC::GetLlvmEntrypoint();
+  std::string opt_flags(PassManager::GetCompilationFlagsOPT(entrypoint));
+  std::string llc_flags(PassManager::GetCompilationFlagsLLC(entrypoint));
+  std::string compiling_method = entrypoint;
 
-  cdSrcDir();
+  cdSrcDir(entrypoint);
 
 #ifdef DEBUG5
   char cwd[1024];
@@ -72,7 +244,7 @@ bool LlcInterface::Compile(bool emit_llvm, bool emit_asm,
   DLOGD(INFO) << "CWD: " << cwd;
 #endif
 
-  CleanupBeforeCompilation();
+  CleanupBeforeCompilation(entrypoint);
 
   // Merge all flags w/ extra supplied flags
   const std::string baseline_optimization = mcr::PassManager::GetBaseline();
@@ -167,8 +339,8 @@ bool LlcInterface::Compile(bool emit_llvm, bool emit_asm,
   }
 
   s = NanoTime();
-  if (!ClangInterface::GenerateSharedObject()) return false;
-  CleanupAfterCompilation();
+  if (!ClangInterface::GenerateSharedObject(entrypoint)) return false;
+  CleanupAfterCompilation(entrypoint);
 
   // Give permissions
   if (!CHMOD(HFso, "644")) return false;
@@ -18,6 +18,7 @@
 #define ART_COMPILER_MCR_LLC_INTERFACE_H_
 
 #include <string>
+#include "arch/instruction_set.h"
 #include "mcr_cc/compiler_interface.h"
 
 #ifndef TARGET_DEVICE
@@ -41,9 +42,12 @@
 // https://github.com/llvm/llvm-project/blob/master/clang/lib/Driver/ToolChains/Arch/AArch64.cpp#L382-L386
 // +reserve-x19,
 #define ARCH_FLAGS "-march=arm64 -enable-implicit-null-checks -mattr=+reserve-x20 " DEVICE_FLAGS
+// Part of ARCH_FLAGS that is not about the target (in-process pipeline)
+#define ARCH_CL_FLAGS "-enable-implicit-null-checks"
 
 #else
 #define ARCH_FLAGS "-march=arm -arm-reserve-r9 " DEVICE_FLAGS
+#define ARCH_CL_FLAGS "-arm-reserve-r9"
 #endif
 
 #define RELOCATION_FLAGS "-relocation-model=pic"
@@ -55,12 +59,23 @@ namespace mcr {
 
 class LlcInterface : public CompilerInterface {
  public:
-  static bool CleanupBeforeCompilation();
-  static bool CleanupAfterCompilation();
-  static bool Compile(bool emit_llvm, bool emit_asm, std::string extraFlags="");
-  static bool GenerateSharedObject(std::string hf);
+  static bool CleanupBeforeCompilation(std::string entrypoint);
+  static bool CleanupAfterCompilation(std::string entrypoint);
+  // All hot regions (McrCC::GetRegions), in parallel
+  static bool CompileRegions(InstructionSet instruction_set, bool emit_llvm,
+                             bool emit_asm, std::string extraFlags,
+                             size_t thread_count);
+  static bool Compile(std::string entrypoint, InstructionSet instruction_set,
+                      bool emit_llvm, bool emit_asm, std::string extraFlags="");
 
  private:
+  static bool CompileInProcess(std::string entrypoint,
+                               InstructionSet instruction_set, bool emit_llvm,
+                               bool emit_asm, std::string extraFlags);
+  static bool CompileWithExternalTools(std::string entrypoint,
+                                       bool emit_llvm, bool emit_asm,
+                                       std::string extraFlags);
+
   static const std::string LLC;
   static const std::string OPT;
 };
@@ -1,5 +1,5 @@
 /**
- * Header required for the llvm/tools/plugin_code.cc generated bitcode by the LLVM backend.
+ * Header of the runtime bitcode library (art_runtime_lib.cc).
  * Basically it includes any structures that we can try to use directly
  * from libart.
  *
@@ -1,5 +1,13 @@
 /**
- * Copyright (C) 2020 Paschalis Mpeis
+ * Runtime code that the LLVM backend uses, compiled to bitcode at build time
+ * (mcr_art_runtime_lib.bc) with the same clang and flags as the runtime.
+ * Each LLVM module starts from it (RuntimeLibrary), so it has the runtime
+ * types, the declarations of the runtime calls, and the definitions of
+ * the inline fast paths, which opt can inline into the hot regions.
+ *
+ * It is never linked in the compiler.
+ *
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -12,17 +20,60 @@
  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
  * See the License for the specific language governing permissions and
  * limitations under the License.
+ *
  */
 
 #include "mcr_cc/llvm/art_plugin.h"
 
+#include "mirror/class-inl.h"
+#include "mirror/string-inl.h"
+
+namespace art {
+
 /**
- *  All HELPER methods should be manually cleared out from art_module_full.ll,
- *  into ../art_module.ll
+ * @brief Fast paths with a stable name, on top of the inline runtime code.
+ *        RuntimeLibrary gives them (and any other definition) linkonce_odr
+ *        linkage, so each module keeps only what it uses.
  */
-namespace art {
+extern "C" bool art_llvm_rt_IsInitialized(mirror::Class* klass)
+    NO_THREAD_SAFETY_ANALYSIS {
+  return klass->IsInitialized<kVerifyNone>();
+}
 
-void HELPER() {
+/**
+ * @brief String::CompareTo without the runtime call when the strings are the
+ *        same, or both are compressed. The other cases go through the RT.
+ */
+extern "C" int32_t art_llvm_rt_StringCompareTo(mirror::String* lhs,
+                                               mirror::String* rhs)
+    NO_THREAD_SAFETY_ANALYSIS {
+  if (lhs == rhs) {
+    return 0;
+  }
+  if (!lhs->IsCompressed() || !rhs->IsCompressed()) {
+    return LLVM::StringCompareTo(lhs, rhs);
+  }
+  int32_t lhs_count = lhs->GetLength();
+  int32_t rhs_count = rhs->GetLength();
+  int32_t count_diff = lhs_count - rhs_count;
+  int32_t min_count = (count_diff < 0) ? lhs_count : rhs_count;
+  const uint8_t* lhs_chars = lhs->GetValueCompressed();
+  const uint8_t* rhs_chars = rhs->GetValueCompressed();
+  for (int32_t i = 0; i < min_count; ++i) {
+    int32_t char_diff =
+        static_cast<int32_t>(lhs_chars[i]) - static_cast<int32_t>(rhs_chars[i]);
+    if (char_diff != 0) {
+      return char_diff;
+    }
+  }
+  return count_diff;
+}
+
+/**
+ * @brief Only keeps (and instantiates) the runtime code that the backend
+ *        looks up by name. RuntimeLibrary removes it.
+ */
+extern "C" void art_llvm_rt_anchor() NO_THREAD_SAFETY_ANALYSIS {
   // jvalue getters
   JValue v;
   v.GetB();
@@ -110,9 +161,9 @@ void HELPER() {
   LLVM::VerifyBssObject(nullptr);
 
   JNIEnvExt* env = nullptr;
-  env->GetSelf(); 
+  env->GetSelf();
 
-  LLVM::StringCompareTo(nullptr, nullptr); 
+  LLVM::StringCompareTo(nullptr, nullptr);
 
   LLVM::GetDeclaringClass(nullptr);
 
@@ -123,6 +174,9 @@ void HELPER() {
   LLVM::SetJniMethod(nullptr);
 
   LLVM::EnableDebugLLVM();
+
+  art_llvm_rt_IsInitialized(nullptr);
+  art_llvm_rt_StringCompareTo(nullptr, nullptr);
 }
 
 }  // namespace art
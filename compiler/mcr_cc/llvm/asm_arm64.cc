@@ -252,6 +252,23 @@ Value* LoadStateAndFlagsASM(IRBuilder* irb) {
   return v;
 }
 
+/**
+ * @brief Implicit stack overflow check, like the frame entry of quick code:
+ *    sub x16, sp, #reserved
+ *    ldr wzr, [x16]
+ *
+ * It faults at the protected region of the stack, and the runtime throws
+ * the StackOverflowError (mcr::LlvmFaultHandler).
+ */
+void StackOverflowProbe(IRBuilder* irb) {
+  FunctionType* fTy = FunctionType::get(irb->getVoidTy(), false);
+  std::stringstream ss;
+  ss << "sub x16, sp, #"
+    << GetStackOverflowReservedBytes(InstructionSet::kArm64)
+    << "\nldr wzr, [x16]";
+  irb->CallInlineAsm(fTy, ss.str(), "~{x16},~{memory}", false, true);
+}
+
 Value* PoisonHeapReference(IRBuilder* irb, Value* reg) {
   AVOID_ASM;
   VERIFY_LLVM_;
@@ -48,6 +48,7 @@ namespace Arm64 {
   Value* GetThreadRegister(IRBuilder* irb);
   Value* GetMrRegister(IRBuilder* irb);
   Value* LoadStateAndFlagsASM(IRBuilder* irb);
+  void StackOverflowProbe(IRBuilder* irb);
 
   void __Mov(IRBuilder* irb,  std::string to, Value* from);
   Value* __Mov(IRBuilder* irb, std::string from, bool w=false);
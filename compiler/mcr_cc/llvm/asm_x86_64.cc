@@ -0,0 +1,282 @@
+/**
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "asm_x86_64.h"
+
+#include <llvm/IR/DerivedTypes.h>
+#include <llvm/IR/Intrinsics.h>
+#include "entrypoints/quick/quick_entrypoints.h"
+#include "gc/accounting/card_table.h"
+#include "ir_builder.h"
+#include "thread.h"
+
+#include "llvm_macros_irb.h"
+
+using namespace ::llvm;
+
+namespace art {
+namespace LLVM {
+namespace X86_64 {
+
+/**
+ * @brief Loads a Thread field relative to the gs segment,
+ *        e.g.: movq %gs:0xd8, %rax
+ *
+ * INFO not ReadNone: thread flags and entrypoints can change
+ *      (suspension, instrumentation) between two loads.
+ */
+static Value* LoadThreadField(IRBuilder* irb, Type* ty, std::string mov,
+                              uint32_t offset) {
+  FunctionType* fTy = FunctionType::get(ty, false);
+  std::stringstream ss;
+  ss << mov << " %gs:" << std::to_string(offset) << ", $0";
+  D3LOG(INFO) << "X86_64: asm: " << ss.str();
+  return irb->CallInlineAsm(fTy, ss.str(), "=r", false, true);
+}
+
+/**
+ * @brief Nothing to do: unlike arm (TR register), gs is not a register that
+ *        LLVM can allocate. It is set by the runtime when a thread is
+ *        attached, so it is valid for any thread that calls LLVM code.
+ */
+void SetThreadRegister(IRBuilder* irb, Value* thread_self) {
+  UNUSED(irb);
+  UNUSED(thread_self);
+  D3LOG(INFO) << "X86_64::SetThreadRegister: gs is set by the runtime";
+}
+
+Value* GetThreadRegister(IRBuilder* irb) {
+  return LoadThreadField(irb, irb->getVoidPointerType(), "movq",
+      Thread::SelfOffset<kX86_64PointerSize>().Int32Value());
+}
+
+Value* LoadStateAndFlagsASM(IRBuilder* irb) {
+  Value* v = LoadThreadField(irb, irb->getInt16Ty(), "movw",
+      Thread::ThreadFlagsOffset<kX86_64PointerSize>().Int32Value());
+  v->setName("state_and_flags");
+  return v;
+}
+
+/**
+ * @brief Implicit stack overflow check, like the frame entry of quick code:
+ *        testq %rax, -reserved(%rsp)
+ */
+void StackOverflowProbe(IRBuilder* irb) {
+  FunctionType* fTy = FunctionType::get(irb->getVoidTy(), false);
+  std::stringstream ss;
+  ss << "testq %rax, -"
+    << GetStackOverflowReservedBytes(InstructionSet::kX86_64) << "(%rsp)";
+  irb->CallInlineAsm(fTy, ss.str(), "~{memory}", true, true);
+}
+
+Value* LoadCardTable(IRBuilder* irb) {
+  Value* v = LoadThreadField(irb, irb->getVoidPointerType(), "movq",
+      Thread::CardTableOffset<kX86_64PointerSize>().Int32Value());
+  v->setName("card");
+  return v;
+}
+
+Value* LoadIsGcMarking(IRBuilder* irb) {
+  Value* v = LoadThreadField(irb, irb->getJIntTy(), "movl",
+      Thread::IsGcMarkingOffset<kX86_64PointerSize>().Int32Value());
+  v->setName("is_gc_marking");
+  return v;
+}
+
+uint32_t offset(QuickEntrypointEnum qpoint) {
+  return GetThreadOffset<kX86_64PointerSize>(qpoint).Int32Value();
+}
+
+Value* GetQuickEntrypoint(IRBuilder* irb, QuickEntrypointEnum qpoint) {
+  return LoadThreadField(irb, irb->getJLongTy()->getPointerTo(), "movq",
+      offset(qpoint));
+}
+
+/**
+ * @brief Same as CodeGeneratorX86_64::MarkGCCard:
+ *
+ *    movq %gs:card_table, card
+ *    movq object, temp
+ *    shrq $kCardShift, temp
+ *    movb card, (temp, card, 1)
+ *
+ * The biased card table base has kCardDirty as its least-significant byte
+ * (see CardTable::Create), so it is also the value that is stored.
+ */
+void MarkGCCard(IRBuilder* irb, Value* object) {
+  Value* card = LoadCardTable(irb);
+  Value* temp = irb->CreateLShr(
+      irb->CreatePtrToInt(object, irb->getJLongTy()),
+      gc::accounting::CardTable::kCardShift);
+  temp->setName("card_index");
+  Value* addr = irb->CreateInBoundsGEP(card, temp);
+  Value* dirty = irb->CreateTrunc(
+      irb->CreatePtrToInt(card, irb->getJLongTy()), irb->getJByteTy());
+  irb->CreateStore(dirty, addr);
+}
+
+/**
+ * @brief x86_64 is TSO: only a store followed by a load needs a fence
+ *        (as in CodeGeneratorX86_64::GenerateMemoryBarrier).
+ *        The rest must only not be reordered by LLVM.
+ */
+void GenerateMemoryBarrier(IRBuilder* irb, MemBarrierKind kind) {
+  D1LOG(INFO) << "X86_64::GenerateMemoryBarrier: " << kind;
+  FunctionType* ty = FunctionType::get(irb->getVoidTy(), false);
+  std::string cmd;
+  switch (kind) {
+    case MemBarrierKind::kAnyAny:
+      // cheaper than mfence
+      cmd = "lock addl $$0, (%rsp)";
+      break;
+    case MemBarrierKind::kAnyStore:
+    case MemBarrierKind::kLoadAny:
+    case MemBarrierKind::kStoreStore:
+      break;
+    default:
+      DLOG(FATAL) << "Unexpected memory barrier " << kind;
+  }
+  InlineAsm* ia = InlineAsm::get(ty, cmd, "~{memory},~{dirflag},~{fpsr},~{flags}", true);
+  irb->CreateCall(ia);
+}
+
+/**
+ * @brief There is no Marking Register on x86_64: the read barriers
+ *        read is_gc_marking from the Thread (LoadIsGcMarking).
+ */
+void GenerateMarkingRegisterCheck(IRBuilder* irb, int code) {
+  UNUSED(irb);
+  UNUSED(code);
+}
+
+static Value* GetAddress(IRBuilder* irb, Value* base, Value* offset,
+                         Type* ty) {
+  Value* addr = irb->CreatePtrDisp(base,
+      irb->CreateZExt(offset, irb->getJLongTy()), ty->getPointerTo());
+  addr->setName("temp_base");
+  return addr;
+}
+
+/**
+ * @brief Returns the same types as Arm64::LoadAcquire:
+ *        sub-word values are extended to an int, and a reference is
+ *        the (zero extended) compressed heap reference.
+ */
+Value* LoadAcquire(IRBuilder* irb, DataType::Type type,
+                   Value* base, Value* offset) {
+  Type* ty = nullptr;
+  switch (type) {
+    case DataType::Type::kBool:
+    case DataType::Type::kUint8:
+    case DataType::Type::kInt8:
+      ty = irb->getJByteTy();
+      break;
+    case DataType::Type::kUint16:
+    case DataType::Type::kInt16:
+      ty = irb->getJShortTy();
+      break;
+    case DataType::Type::kReference:
+    case DataType::Type::kInt32:
+      ty = irb->getJIntTy();
+      break;
+    case DataType::Type::kInt64:
+      ty = irb->getJLongTy();
+      break;
+    default:
+      DIE_TODO << type;
+  }
+
+  LoadInst* load = irb->CreateLoad(GetAddress(irb, base, offset, ty));
+  load->setAtomic(AtomicOrdering::Acquire);
+  load->setAlignment(MaybeAlign(DataType::Size(type)));
+
+  Value* value = load;
+  switch (type) {
+    case DataType::Type::kInt8:
+    case DataType::Type::kInt16:
+      value = irb->CreateSExt(load, irb->getJIntTy());
+      break;
+    case DataType::Type::kBool:
+    case DataType::Type::kUint8:
+    case DataType::Type::kUint16:
+      value = irb->CreateZExt(load, irb->getJIntTy());
+      break;
+    case DataType::Type::kReference:
+      value = irb->CreateIntToPtr(
+          irb->CreateZExt(load, irb->getJLongTy()),
+          irb->getVoidPointerType());
+      break;
+    default:
+      break;
+  }
+  return value;
+}
+
+void StoreRelease(IRBuilder* irb, DataType::Type type,
+                  Value* src, Value* base, Value* offset) {
+  Type* ty = nullptr;
+  switch (type) {
+    case DataType::Type::kBool:
+    case DataType::Type::kUint8:
+    case DataType::Type::kInt8:
+      ty = irb->getJByteTy();
+      break;
+    case DataType::Type::kUint16:
+    case DataType::Type::kInt16:
+      ty = irb->getJShortTy();
+      break;
+    case DataType::Type::kReference:
+    case DataType::Type::kInt32:
+      ty = irb->getJIntTy();
+      break;
+    case DataType::Type::kInt64:
+      ty = irb->getJLongTy();
+      break;
+    default:
+      DIE_TODO << type;
+  }
+
+  Value* value = src;
+  if (value->getType()->isPointerTy()) {
+    value = irb->CreatePtrToInt(value, irb->getJLongTy());
+  }
+  if (value->getType() != ty) {
+    value = irb->CreateZExtOrTrunc(value, ty);
+  }
+  StoreInst* store = irb->CreateStore(value,
+      GetAddress(irb, base, offset, ty));
+  store->setAtomic(AtomicOrdering::Release);
+  store->setAlignment(MaybeAlign(DataType::Size(type)));
+}
+
+Value* Ror(IRBuilder* irb, Value* lhs, Value* rhs, bool i32) {
+  Type* ty = i32 ? irb->getJIntTy() : irb->getJLongTy();
+  Value* amount = irb->CreateZExtOrTrunc(rhs, ty);
+  Function* fshr = Intrinsic::getDeclaration(
+      irb->getModule(), Intrinsic::fshr, {ty});
+  return irb->CreateCall(fshr, {lhs, lhs, amount});
+}
+
+// movd/movq xmm -> gpr
+Value* MoveFPToInt(IRBuilder* irb, Value* input, bool i32) {
+  return irb->CreateBitCast(input, i32 ? irb->getJIntTy() : irb->getJLongTy());
+}
+
+#include "llvm_macros_undef.h"
+
+}  // namespace X86_64
+}  // namespace LLVM
+}  // namespace art
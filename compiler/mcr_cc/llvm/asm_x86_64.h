@@ -0,0 +1,62 @@
+/**
+ * LLVM inline assembly for x86_64, so the backend can run on a Linux host.
+ * Only the thread register dependent parts (gs segment) are assembly:
+ * anything else is plain LLVM IR, as x86_64 loads and stores already
+ * have acquire/release semantics.
+ *
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef ART_COMPILER_LLVM_ASM_X86_64_H_
+#define ART_COMPILER_LLVM_ASM_X86_64_H_
+
+#include <llvm/IR/InlineAsm.h>
+#include "entrypoints/quick/quick_entrypoints_enum.h"
+#include "optimizing/nodes.h"
+
+using namespace ::llvm;
+namespace art {
+namespace LLVM {
+class IRBuilder;
+namespace X86_64 {
+
+  // Thread register: the runtime points gs to the Thread of each thread
+  void SetThreadRegister(IRBuilder* irb, Value* thread_self);
+  Value* GetThreadRegister(IRBuilder* irb);
+  Value* LoadStateAndFlagsASM(IRBuilder* irb);
+  void StackOverflowProbe(IRBuilder* irb);
+  Value* LoadCardTable(IRBuilder* irb);
+  Value* LoadIsGcMarking(IRBuilder* irb);
+
+  uint32_t offset(QuickEntrypointEnum qpoint);
+  Value* GetQuickEntrypoint(IRBuilder* irb, QuickEntrypointEnum qpoint);
+
+  void MarkGCCard(IRBuilder* irb, Value* object);
+  void GenerateMemoryBarrier(IRBuilder* irb, MemBarrierKind kind);
+  void GenerateMarkingRegisterCheck(IRBuilder* irb, int code);
+
+  Value* LoadAcquire(IRBuilder* irb, DataType::Type type,
+      Value* base, Value* offset);
+  void StoreRelease(IRBuilder* irb, DataType::Type type,
+      Value* src, Value* base, Value* offset);
+
+  Value* Ror(IRBuilder* irb, Value* lhs, Value* rhs, bool i32);
+  Value* MoveFPToInt(IRBuilder* irb, Value* input, bool i32);
+
+}  // namespace X86_64
+}  // namespace LLVM
+}  // namespace art
+
+#endif  // ART_COMPILER_LLVM_ASM_X86_64_H_
@@ -25,6 +25,7 @@
 
 #include <android-base/logging.h>
 #include "base/os.h"
+#include "read_barrier_config.h"
 
 using namespace ::android::base;
 
@@ -33,6 +34,7 @@ namespace art {
 bool McrDebug::debug_llvm_code_ = false;
 bool McrDebug::debug_invoke_jni_ = false;
 bool McrDebug::debug_invoke_quick_ = false;
+bool McrDebug::llvm_external_tools_ = false;
 
 bool McrDebug::opt_quick_through_rt_ = false;
 bool McrDebug::sc_simplify_= false;
@@ -56,6 +58,15 @@ bool McrDebug::verify_speculation_ = false;
 bool McrDebug::verify_speculation_miss_ = false;
 bool McrDebug::speculative_devirt_ = true;
 bool McrDebug::interpret_nonhot_ = false;
+bool McrDebug::region_module_ = false;
+bool McrDebug::compilation_cache_ = false;
+bool McrDebug::direct_quick_calls_ = false;
+bool McrDebug::gc_stack_maps_ = false;
+bool McrDebug::profile_branches_ = false;
+bool McrDebug::line_table_ = false;
+bool McrDebug::safepoints_ = false;
+bool McrDebug::implicit_checks_ = false;
+bool McrDebug::region_inline_ = false;
 
 bool McrDebug::die_on_speculation_miss_ = false;
 bool McrDebug::verify_init_inner_ = false;
@@ -85,6 +96,16 @@ bool McrDebug::AnyOptionEnabled() {
          SkipSuspendCheck() ||
          SpeculativeDevirt() ||
          InterpretNonhot() ||
+         RegionModule() ||
+         UseCompilationCache() ||
+         DirectQuickCalls() ||
+         GcStackMaps() ||
+         ProfileBranches() ||
+         LineTable() ||
+         Safepoints() ||
+         ImplicitChecks() ||
+         RegionInline() ||
+         LlvmExternalTools() ||
          DebugInvokeQuick();
 }
 
@@ -108,6 +129,7 @@ void McrDebug::ReadOptions() {
   ReadDebugInvokeQuick();
   ReadDebugInvokeJni();
   ReadDebugLlvmCode();
+  ReadLlvmExternalTools();
 
   ReadVerifyInitInner();
   ReadVerifyBasicBlock();
@@ -128,6 +150,15 @@ void McrDebug::ReadOptions() {
   ReadVerifySpeculationMiss();
   ReadSpeculativeDevirt();
   ReadInterpretNonhot();
+  ReadRegionModule();
+  ReadCompilationCache();
+  ReadDirectQuickCalls();
+  ReadGcStackMaps();
+  ReadProfileBranches();
+  ReadLineTable();
+  ReadSafepoints();
+  ReadImplicitChecks();
+  ReadRegionInline();
 }
 
 void McrDebug::ReadVerifyBasicBlock() {
@@ -159,6 +190,87 @@ void McrDebug::ReadInterpretNonhot() {
   interpret_nonhot_ = IsEnabled(F_INTEPRET_NONHOT);
 }
 
+/**
+ * @brief All methods of the hot region are generated in one LLVM module
+ *        (LlvmRegion), instead of an inner/outer bitcode file per method.
+ */
+void McrDebug::ReadRegionModule() {
+  region_module_ = IsEnabled(F_OPT_REGION_MODULE);
+}
+
+/**
+ * @brief Reuses the bitcode of methods, and the objects of regions,
+ *        of earlier compilations with the same inputs (CompilationCache).
+ */
+void McrDebug::ReadCompilationCache() {
+  compilation_cache_ = IsEnabled(F_OPT_COMPILATION_CACHE);
+}
+
+/**
+ * @brief LLVM calls quick code with the quick ABI (art_llvm_call_quick),
+ *        instead of marshalling args for art_quick_invoke_stub.
+ */
+void McrDebug::ReadDirectQuickCalls() {
+  direct_quick_calls_ = IsEnabled(F_OPT_DIRECT_QUICK_CALLS);
+}
+
+/**
+ * @brief Safepoint calls record the live references of their LLVM frame
+ *        (gc.statepoint), translated to a CodeInfo per function.
+ *        The references are not relocated (no gc.relocate), so not with
+ *        the concurrent copying collector (read barriers).
+ */
+void McrDebug::ReadGcStackMaps() {
+  gc_stack_maps_ = IsEnabled(F_OPT_GC_STACKMAPS);
+  if (gc_stack_maps_ && kUseReadBarrier) {
+    DLOG(WARNING) << "GcStackMaps: ignoring " << F_OPT_GC_STACKMAPS
+      << ": read barriers (moving collector)";
+    gc_stack_maps_ = false;
+  }
+}
+
+/**
+ * @brief LLVM code counts its branches and entries (mcr::BranchProfile),
+ *        for the branch weights of later compilations.
+ */
+void McrDebug::ReadProfileBranches() {
+  profile_branches_ = IsEnabled(F_OPT_PROFILE_BRANCHES);
+}
+
+/**
+ * @brief Debug locations (dex method, dex_pc) on the generated code, and a
+ *        line table of hf.so (hf.lines) for the native profiler of the
+ *        runtime (mcr::LlvmProfiler).
+ */
+void McrDebug::ReadLineTable() {
+  line_table_ = IsEnabled(F_OPT_LINE_TABLE);
+}
+
+/**
+ * @brief Places the suspend checks of the loops by their trip counts
+ *        (HGraphToLLVM::PlanSuspendChecks), instead of one per back edge.
+ */
+void McrDebug::ReadSafepoints() {
+  safepoints_ = IsEnabled(F_OPT_SAFEPOINTS);
+}
+
+/**
+ * @brief Null checks that fault (LLVM's implicit null checks) and a stack
+ *        overflow probe at the entry of each inner method. The runtime
+ *        handles their faults (mcr::LlvmFaultHandler, with hf.faults).
+ */
+void McrDebug::ReadImplicitChecks() {
+  implicit_checks_ = IsEnabled(F_OPT_IMPLICIT_CHECKS);
+}
+
+/**
+ * @brief Inline hints per call site of the linked region
+ *        (LLVM::RegionInliner), from the profiled call counts.
+ */
+void McrDebug::ReadRegionInline() {
+  region_inline_ = IsEnabled(F_OPT_REGION_INLINE);
+}
+
 void McrDebug::ReadVerifyInvoke() {
   verify_invoke_ = IsEnabled(F_VERIF_INVOKE);
 }
@@ -185,6 +297,14 @@ void McrDebug::ReadDebugInvokeJni() {
   debug_invoke_jni_ = IsEnabled(F_DBG_INVOKE_JNI);
 }
 
+/**
+ * @brief Use the external llvm-link/opt/llc tools (and the intermediate
+ *        bitcode files) instead of the in-process LLVM pipeline.
+ */
+void McrDebug::ReadLlvmExternalTools() {
+  llvm_external_tools_ = IsEnabled(F_DBG_LLVM_EXTERNAL_TOOLS);
+}
+
 void McrDebug::ReadVerifyInvokeJni() {
   verify_invoke_jni_ = IsEnabled(F_VERIF_INVOKE_JNI);
 }
@@ -253,6 +373,64 @@ bool McrDebug::InterpretNonhot() {
   return interpret_nonhot_;
 }
 
+bool McrDebug::RegionModule() {
+  return region_module_;
+}
+
+bool McrDebug::UseCompilationCache() {
+  return compilation_cache_;
+}
+
+bool McrDebug::DirectQuickCalls() {
+  return direct_quick_calls_;
+}
+
+bool McrDebug::GcStackMaps() {
+  return gc_stack_maps_;
+}
+
+bool McrDebug::ProfileBranches() {
+  return profile_branches_;
+}
+
+bool McrDebug::LineTable() {
+  return line_table_;
+}
+
+bool McrDebug::Safepoints() {
+  return safepoints_;
+}
+
+bool McrDebug::ImplicitChecks() {
+  return implicit_checks_;
+}
+
+bool McrDebug::RegionInline() {
+  return region_inline_;
+}
+
+std::string McrDebug::GetOptionsFingerprint() {
+  const bool options[] = {
+    debug_invoke_quick_, debug_invoke_jni_, debug_llvm_code_,
+    opt_quick_through_rt_, sc_simplify_, skip_suspend_check_,
+    verify_invoke_, verify_invoke_jni_, verify_invoke_quick_,
+    verify_invoke_llvm_, verify_llvm_called_,
+    verify_art_method_, verify_art_obj_, verify_art_class_,
+    verify_llvm_invoke_wrapper, verify_invoke_quick_ThroughRTslow_,
+    verify_invoke_quick_LlvmToQuick_, verify_load_class_,
+    speculative_devirt_, interpret_nonhot_, region_module_,
+    verify_speculation_, verify_speculation_miss_, die_on_speculation_miss_,
+    verify_init_inner_, verify_basic_block_, ImplicitNullChecks(),
+    direct_quick_calls_, gc_stack_maps_, profile_branches_,
+    line_table_, safepoints_, implicit_checks_, region_inline_
+  };
+  std::string fingerprint;
+  for (bool option : options) {
+    fingerprint.push_back(option ? '1' : '0');
+  }
+  return fingerprint;
+}
+
 bool McrDebug::DebugInvokeJni() {
   return debug_invoke_jni_;
 }
@@ -261,6 +439,10 @@ bool McrDebug::DebugInvokeQuick() {
   return debug_invoke_quick_;
 }
 
+bool McrDebug::LlvmExternalTools() {
+  return llvm_external_tools_;
+}
+
 bool McrDebug::VerifyBasicBlock(std::string pretty_method) {
   // option is not overriden
   if(pretty_method.size() == 0) return verify_basic_block_;
@@ -431,6 +613,46 @@ void McrDebug::PrintOptions() {
       DLOG(WARNING) << "| WARNING: SuspendCheck: for nested loops";
     }
 
+    if (RegionModule()) {
+      DLOG(lvl) << "| OPT:    Region module (single bitcode)";
+    }
+
+    if (UseCompilationCache()) {
+      DLOG(lvl) << "| OPT:    Compilation cache (bitcode, objects)";
+    }
+
+    if (DirectQuickCalls()) {
+      DLOG(lvl) << "| OPT:    Direct quick calls (quick ABI)";
+    }
+
+    if (GcStackMaps()) {
+      DLOG(lvl) << "| OPT:    GC stack maps (statepoints)";
+    }
+
+    if (ProfileBranches()) {
+      DLOG(lvl) << "| OPT:    Profile branches (counters)";
+    }
+
+    if (LineTable()) {
+      DLOG(lvl) << "| OPT:    Line table (dex_pc debug locations)";
+    }
+
+    if (Safepoints()) {
+      DLOG(lvl) << "| OPT:    Safepoint placement (loop suspend checks)";
+    }
+
+    if (ImplicitChecks()) {
+      DLOG(lvl) << "| OPT:    Implicit null/stack overflow checks (faults)";
+    }
+
+    if (RegionInline()) {
+      DLOG(lvl) << "| OPT:    Region inlining (profiled call counts)";
+    }
+
+    if (LlvmExternalTools()) {
+      DLOG(lvl) << "| DEBUG:  LLVM external tools (llvm-link/opt/llc)";
+    }
+
     if (QuickThroughRT()) {
       DLOG(ERROR) << "| WARNING: OPT: Quick through RT (not LLVMtoQUICK)";
     }
@@ -31,6 +31,7 @@
 #define F_DBG_LLVM_CODE DIR_MCR "/dbg.llvm_code"
 #define F_DBG_INVOKE_JNI DIR_MCR "/dbg.invoke.jni"
 #define F_DBG_INVOKE_QUICK DIR_MCR "/dbg.invoke.quick"
+#define F_DBG_LLVM_EXTERNAL_TOOLS DIR_MCR "/dbg.llvm_external_tools"
 
 #define F_SKIP_SUSPEND_CHECK DIR_MCR "/suspend_check.dont_run"
 #define F_VERIF_INVOKE DIR_MCR "/verif.invoke"
@@ -54,6 +55,15 @@
 #define F_DISABLE_SPECULATION DIR_MCR "/spec_devirt.disable"
 
 #define F_INTEPRET_NONHOT DIR_MCR "/opt.interpret_nonhot"
+#define F_OPT_REGION_MODULE DIR_MCR "/opt.region_module"
+#define F_OPT_COMPILATION_CACHE DIR_MCR "/opt.compilation_cache"
+#define F_OPT_DIRECT_QUICK_CALLS DIR_MCR "/opt.direct_quick_calls"
+#define F_OPT_GC_STACKMAPS DIR_MCR "/opt.gc_stackmaps"
+#define F_OPT_PROFILE_BRANCHES DIR_MCR "/opt.profile_branches"
+#define F_OPT_LINE_TABLE DIR_MCR "/opt.line_table"
+#define F_OPT_SAFEPOINTS DIR_MCR "/opt.safepoints"
+#define F_OPT_IMPLICIT_CHECKS DIR_MCR "/opt.implicit_checks"
+#define F_OPT_REGION_INLINE DIR_MCR "/opt.region_inline"
 #define F_EXP_PROF_BREAKDOWN DIR_MCR "/exp.profile.breakdown"
 
 #define F_LLVM_RECOMPILE DIR_MCR "/llvm.recompile"
@@ -84,6 +94,7 @@ class McrDebug {
   static void ReadDebugLlvmCode();
   static void ReadDebugInvokeJni();
   static void ReadDebugInvokeQuick();
+  static void ReadLlvmExternalTools();
 
   static void ReadVerifyInitInner();
   static void ReadVerifyBasicBlock();
@@ -108,14 +119,35 @@ class McrDebug {
   static void ReadVerifySpeculationMiss();
   static void ReadSpeculativeDevirt();
   static void ReadInterpretNonhot();
+  static void ReadRegionModule();
+  static void ReadCompilationCache();
+  static void ReadDirectQuickCalls();
+  static void ReadGcStackMaps();
+  static void ReadProfileBranches();
+  static void ReadLineTable();
+  static void ReadSafepoints();
+  static void ReadImplicitChecks();
+  static void ReadRegionInline();
 
   static bool QuickThroughRT();
   static bool SuspendCheckSimplify();
   static bool SkipSuspendCheck();
   static bool SpeculativeDevirt();
   static bool InterpretNonhot();
+  static bool RegionModule();
+  static bool UseCompilationCache();
+  static bool DirectQuickCalls();
+  static bool GcStackMaps();
+  static bool ProfileBranches();
+  static bool LineTable();
+  static bool Safepoints();
+  static bool ImplicitChecks();
+  static bool RegionInline();
+  // All options that change the generated code (for mcr::CompilationCache)
+  static std::string GetOptionsFingerprint();
   static bool DebugInvokeQuick();
   static bool DebugInvokeJni();
+  static bool LlvmExternalTools();
 
   static bool VerifyInitInner();
   static bool VerifyBasicBlock(std::string pretty_method = "");
@@ -168,6 +200,7 @@ class McrDebug {
   static bool debug_invoke_quick_;
   static bool debug_invoke_jni_;
   static bool debug_llvm_code_;
+  static bool llvm_external_tools_;
 
   static bool exp_profile_breakdown_;
   static bool opt_quick_through_rt_;
@@ -192,6 +225,15 @@ class McrDebug {
   static bool verify_load_class_;
   static bool speculative_devirt_;
   static bool interpret_nonhot_;
+  static bool region_module_;
+  static bool compilation_cache_;
+  static bool direct_quick_calls_;
+  static bool gc_stack_maps_;
+  static bool profile_branches_;
+  static bool line_table_;
+  static bool safepoints_;
+  static bool implicit_checks_;
+  static bool region_inline_;
   static bool verify_speculation_;
   static bool verify_speculation_miss_;
   static bool die_on_speculation_miss_;
@@ -0,0 +1,127 @@
+/**
+ * Translates the implicit null checks of hf.so (.llvm_faultmaps, v1) to
+ * the faulting loads that the runtime handles (mcr::LlvmFaultHandler).
+ *
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "fault_maps.h"
+
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/CodeGen/FaultMaps.h>
+#include <llvm/Object/ObjectFile.h>
+#include <map>
+#include "llvm_pipeline.h"
+#include "mcr_rt/llvm_fault_handler.h"
+#include "mcr_rt/mcr_rt.h"
+#include "stack_maps.h"
+
+using namespace ::llvm;
+
+namespace art {
+namespace LLVM {
+
+static constexpr const char* kFaultMapsSection = ".llvm_faultmaps";
+// header: version, reserved, reserved, num functions (8 bytes)
+static constexpr uint64_t kHeaderSize = 8;
+// function: address, num faulting pcs, reserved (16 bytes)
+static constexpr uint64_t kFunctionSize = 16;
+// faulting pc: kind, faulting pc offset, handler pc offset (12 bytes)
+static constexpr uint64_t kFaultingPCSize = 12;
+
+template <typename T>
+static void Append(SmallVectorImpl<char>* out, T value) {
+  const char* bytes = reinterpret_cast<const char*>(&value);
+  out->append(bytes, bytes + sizeof(T));
+}
+
+bool FaultMaps::Translate(std::string file_so, std::string file_faults) {
+  Expected<object::OwningBinary<object::ObjectFile>> binary =
+    object::ObjectFile::createObjectFile(file_so);
+  if (!binary) {
+    DLOG(ERROR) << "FaultMaps: " << file_so << ": "
+                << toString(binary.takeError());
+    return false;
+  }
+  const object::ObjectFile* obj = binary->getBinary();
+
+  StringRef contents;
+  uint64_t section_address = 0;
+  for (const object::SectionRef& section : obj->sections()) {
+    Expected<StringRef> name = section.getName();
+    if (!name) {
+      consumeError(name.takeError());
+      continue;
+    }
+    if (*name != kFaultMapsSection) continue;
+    Expected<StringRef> data = section.getContents();
+    if (!data) {
+      DLOG(ERROR) << "FaultMaps: " << toString(data.takeError());
+      return false;
+    }
+    contents = *data;
+    section_address = section.getAddress();
+  }
+
+  SmallVector<char, 0> out;
+  Append<uint32_t>(&out, mcr::LlvmFaultHandler::kMagic);
+  if (contents.empty()) {
+    // e.g. arm64: the implicit null checks of LLVM 10 are only for x86_64
+    D1LOG(INFO) << "FaultMaps: no faulting loads: " << file_so;
+    Append<uint32_t>(&out, 0);
+    return LlvmPipeline::WriteFile(file_faults, out);
+  }
+  if (contents[0] != 1) {
+    DLOG(ERROR) << "FaultMaps: unsupported version: "
+                << static_cast<int>(contents[0]);
+    return false;
+  }
+
+  const uint8_t* begin = reinterpret_cast<const uint8_t*>(contents.data());
+  const uint8_t* end = begin + contents.size();
+  FaultMapParser parser(begin, end);
+  std::map<uint64_t, uint64_t> relocated;
+  GetRelocatedAddresses(obj, section_address,
+                        section_address + contents.size(), &relocated);
+
+  SmallVector<char, 0> loads;
+  uint32_t num_loads = 0;
+  uint64_t offset = kHeaderSize;
+  if (parser.getNumFunctions() != 0) {
+    FaultMapParser::FunctionInfoAccessor fn = parser.getFirstFunctionInfo();
+    for (uint32_t f = 0; f < parser.getNumFunctions(); f++) {
+      if (f != 0) fn = fn.getNextFunctionInfo(end);
+      uint64_t address = fn.getFunctionAddr();
+      if (address == 0) address = relocated[section_address + offset];
+      for (uint32_t i = 0; i < fn.getNumFaultingPCs(); i++) {
+        const FaultMapParser::FunctionFaultInfoAccessor fault =
+          fn.getFunctionFaultInfoAt(i);
+        Append<uint64_t>(&loads, address + fault.getFaultingPCOffset());
+        Append<uint64_t>(&loads, address + fault.getHandlerPCOffset());
+        num_loads++;
+      }
+      offset += kFunctionSize + kFaultingPCSize * fn.getNumFaultingPCs();
+    }
+  }
+
+  Append<uint32_t>(&out, num_loads);
+  out.append(loads.begin(), loads.end());
+  D1LOG(INFO) << "FaultMaps: " << num_loads << " faulting loads in "
+              << parser.getNumFunctions() << " functions: " << file_so;
+  return LlvmPipeline::WriteFile(file_faults, out);
+}
+
+}  // namespace LLVM
+}  // namespace art
@@ -0,0 +1,38 @@
+/**
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef ART_COMPILER_LLVM_FAULT_MAPS_H_
+#define ART_COMPILER_LLVM_FAULT_MAPS_H_
+
+#include <string>
+
+namespace art {
+namespace LLVM {
+
+/**
+ * @brief Translates the .llvm_faultmaps of an hf.so (the implicit null
+ *        checks of opt.implicit_checks) to a table of (faulting pc,
+ *        handler pc). It is read by mcr::LlvmFaultHandler (see its format).
+ */
+class FaultMaps final {
+ public:
+  static bool Translate(std::string file_so, std::string file_faults);
+};
+
+}  // namespace LLVM
+}  // namespace art
+
+#endif  // ART_COMPILER_LLVM_FAULT_MAPS_H_
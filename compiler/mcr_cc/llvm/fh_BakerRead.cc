@@ -38,7 +38,9 @@ ALWAYS_INLINE Value* _FieldLoadWithBakerReadBarrier(
   {
     if (use_load_acquire) {
       // __ ldar(ref_reg, src);
-      fastVal=Arm64::__Ldar(IRB, lobj, DataType::Type::kReference);
+      fastVal = IRB->IsCompilingX86_64() ?
+        X86_64::LoadAcquire(IRB, DataType::Type::kReference, lobj, loffset) :
+        Arm64::__Ldar(IRB, lobj, DataType::Type::kReference);
     } else {
       // __ ldr(ref_reg, src);
       fastVal=HL->LoadWord<true>(lobj, loffset);
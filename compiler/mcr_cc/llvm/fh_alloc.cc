@@ -0,0 +1,278 @@
+/**
+ * Inline TLAB (bump-pointer) allocations of new-instance and new-array,
+ * the same fast paths with art_quick_alloc_*_region_tlab.
+ *
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "function_helper.h"
+
+#include <llvm/IR/Argument.h>
+#include <llvm/IR/Function.h>
+#include "asm_arm64.h"
+#include "asm_x86_64.h"
+#include "gc/heap.h"
+#include "hgraph_to_llvm-inl.h"
+#include "hgraph_to_llvm.h"
+#include "ir_builder.h"
+#include "mirror/array.h"
+#include "mirror/class.h"
+#include "thread.h"
+#include <sstream>
+
+#include "llvm_macros_irb.h"
+
+using namespace ::llvm;
+
+namespace art {
+namespace LLVM {
+
+static bool HasTlabFastPath(IRBuilder* irb) {
+  return irb->IsCompilingArm64() || irb->IsCompilingX86_64();
+}
+
+static void GenerateMemoryBarrier(IRBuilder* irb, MemBarrierKind kind) {
+  if (irb->IsCompilingX86_64()) {
+    X86_64::GenerateMemoryBarrier(irb, kind);
+  } else {
+    Arm64::GenerateMemoryBarrier(irb, kind);
+  }
+}
+
+/**
+ * @brief Bumps thread_local_pos by size, when it fits in the TLAB.
+ *        Branches to the slow path otherwise, or when the thread must not
+ *        allocate inline (see Thread::LlvmAllocFastPathOffset).
+ *
+ * With no TLAB, pos and end are both null, so nothing fits.
+ *
+ * @return the start of the new object (in the fast path block)
+ */
+static Value* GenerateTlabBump(HGraphToLLVM* HL, IRBuilder* irb,
+                               Value* size, BasicBlock* slow_path) {
+  LLVMContext& ctx = irb->getContext();
+  Function* F = irb->GetInsertBlock()->getParent();
+  MDNode* likely = HL->MDB()->createBranchWeights(MAX_BRWEIGHT, 1);
+  Type* i64 = irb->getJLongTy();
+
+  Value* thread = HL->GetLoadedThread();
+  Value* enabled = HL->LoadFromObjectOffset(
+      thread, HL->GetThreadLlvmAllocFastPathOffset(), irb->getJIntTy());
+  enabled->setName("alloc_fast_path");
+
+  BasicBlock* check_fit = BasicBlock::Create(ctx, "check_fit", F);
+  BasicBlock* fast_path = BasicBlock::Create(ctx, "fast_path", F);
+  irb->CreateCondBr(
+      irb->CreateICmpNE(enabled, irb->getJInt(0)), check_fit, slow_path,
+      likely);
+
+  irb->SetInsertPoint(check_fit);
+  Value* pos = HL->LoadFromObjectOffset(
+      thread, HL->GetThreadLocalPosOffset(), i64);
+  pos->setName("tlab_pos");
+  Value* end = HL->LoadFromObjectOffset(
+      thread, HL->GetThreadLocalEndOffset(), i64);
+  end->setName("tlab_end");
+  // unsigned, as in the quick fast paths: a huge size never fits
+  Value* remaining = irb->CreateSub(end, pos);
+  irb->CreateCondBr(irb->CreateICmpUGT(size, remaining), slow_path,
+                    fast_path, HL->MDB()->createBranchWeights(1, MAX_BRWEIGHT));
+
+  irb->SetInsertPoint(fast_path);
+  HL->StoreToObjectOffset(thread, HL->GetThreadLocalPosOffset(),
+                          irb->CreateAdd(pos, size));
+  Value* objects = HL->LoadFromObjectOffset(
+      thread, HL->GetThreadLocalObjectsOffset(), i64);
+  HL->StoreToObjectOffset(thread, HL->GetThreadLocalObjectsOffset(),
+                          irb->CreateAdd(objects, irb->getJLong(1)));
+
+  Value* obj = irb->CreateIntToPtr(pos, irb->getVoidPointerType());
+  obj->setName("tlab_obj");
+  return obj;
+}
+
+// Stores the (compressed) class reference: the rest of the TLAB is zeroed
+static void StoreClass(HGraphToLLVM* HL, IRBuilder* irb,
+                       Value* obj, Value* klass) {
+  Value* klass32 = irb->CreateTrunc(
+      irb->CreatePtrToInt(klass, irb->getJLongTy()), irb->getJIntTy());
+  HL->StoreToObjectOffset(obj, mirror::Object::ClassOffset().Uint32Value(),
+                          klass32);
+}
+
+/**
+ * @brief new-instance with the TLAB fast path of
+ *        art_quick_alloc_object_resolved_region_tlab:
+ *
+ * object_size_alloc_fast_path of a class is a huge value until the class is
+ * initialized (or when it is finalizable), so these go to the runtime.
+ *
+ * Unless the class was initialized at compile time (Initialized), its
+ * status is not checked, so a full barrier orders the class loads before
+ * the object is used (the same dmb ish as quick). Otherwise the stores are
+ * published with a StoreStore barrier (constructor fence).
+ *
+ * WithChecks (the class may be abstract, an interface, or not accessible)
+ * always goes to the runtime, which throws: the object size does not
+ * tell these apart.
+ */
+Function* FunctionHelper::AllocObject(
+    HGraphToLLVM* HL, IRBuilder* irb, QuickEntrypointEnum qpoint) {
+  if (alloc_[qpoint] != nullptr) return alloc_[qpoint];
+
+  std::stringstream ss;
+  ss << "AllocObject" << static_cast<int>(qpoint);
+  std::string name = ss.str();
+  D3LOG(INFO) << "Creating function: " << name;
+  BasicBlock* pinsert_point = irb->GetInsertBlock();
+
+  FunctionType* ty = FunctionType::get(irb->getVoidPointerType(),
+      {irb->getVoidPointerType()}, false);
+  Function* f = Function::Create(
+      ty, Function::LinkOnceODRLinkage, name, irb->getModule());
+  f->setDSOLocal(true);
+  AddAttributesCommon(f);
+  alloc_[qpoint] = f;
+
+  Function::arg_iterator arg_iter(f->arg_begin());
+  Value* klass = &*arg_iter++;
+  klass->setName("klass");
+
+  LLVMContext& ctx = irb->getContext();
+  BasicBlock* entry_block = BasicBlock::Create(ctx, "entry", f);
+  BasicBlock* slow_path = BasicBlock::Create(ctx, "slow_path", f);
+  irb->SetInsertPoint(entry_block);
+
+  const bool fast_path_qpoint = qpoint == kQuickAllocObjectResolved ||
+      qpoint == kQuickAllocObjectInitialized;
+  if (fast_path_qpoint && HasTlabFastPath(irb)) {
+    Value* size = irb->CreateZExt(HL->LoadFromObjectOffset(
+          klass, mirror::Class::ObjectSizeAllocFastPathOffset().Int32Value(),
+          irb->getJIntTy()), irb->getJLongTy());
+    size->setName("size");
+
+    Value* obj = GenerateTlabBump(HL, irb, size, slow_path);
+    StoreClass(HL, irb, obj, klass);
+    GenerateMemoryBarrier(irb,
+        qpoint == kQuickAllocObjectInitialized ?
+        MemBarrierKind::kStoreStore : MemBarrierKind::kAnyAny);
+    irb->CreateRet(obj);
+  } else {
+    irb->CreateBr(slow_path);
+  }
+
+  irb->SetInsertPoint(slow_path);
+  irb->CreateRet(HL->ArtCallAllocObject__(qpoint, klass));
+
+  irb->SetInsertPoint(pinsert_point);
+  return f;
+}
+
+static int32_t GetArrayComponentSizeShift(QuickEntrypointEnum qpoint) {
+  switch (qpoint) {
+    case kQuickAllocArrayResolved8:
+      return 0;
+    case kQuickAllocArrayResolved16:
+      return 1;
+    case kQuickAllocArrayResolved32:
+      return 2;
+    case kQuickAllocArrayResolved64:
+      return 3;
+    default:
+      return -1;  // unknown component size: no fast path
+  }
+}
+
+/**
+ * @brief new-array with the TLAB fast path of
+ *        art_quick_alloc_array_resolved*_region_tlab.
+ *
+ * The length is compared unsigned: negative lengths, and arrays that go
+ * to the large object space take the slow path (which also throws).
+ * Array classes are initialized once published (ClassLinker::CreateArrayClass),
+ * so only the StoreStore barrier is needed.
+ */
+Function* FunctionHelper::AllocArray(
+    HGraphToLLVM* HL, IRBuilder* irb, QuickEntrypointEnum qpoint) {
+  if (alloc_[qpoint] != nullptr) return alloc_[qpoint];
+
+  std::stringstream ss;
+  ss << "AllocArray" << static_cast<int>(qpoint);
+  std::string name = ss.str();
+  D3LOG(INFO) << "Creating function: " << name;
+  BasicBlock* pinsert_point = irb->GetInsertBlock();
+
+  FunctionType* ty = FunctionType::get(irb->getVoidPointerType(),
+      {irb->getVoidPointerType(), irb->getJIntTy()}, false);
+  Function* f = Function::Create(
+      ty, Function::LinkOnceODRLinkage, name, irb->getModule());
+  f->setDSOLocal(true);
+  AddAttributesCommon(f);
+  alloc_[qpoint] = f;
+
+  Function::arg_iterator arg_iter(f->arg_begin());
+  Value* klass = &*arg_iter++;
+  klass->setName("klass");
+  Value* length = &*arg_iter++;
+  length->setName("length");
+
+  LLVMContext& ctx = irb->getContext();
+  BasicBlock* entry_block = BasicBlock::Create(ctx, "entry", f);
+  BasicBlock* slow_path = BasicBlock::Create(ctx, "slow_path", f);
+  irb->SetInsertPoint(entry_block);
+
+  const int32_t shift = GetArrayComponentSizeShift(qpoint);
+  if (HasTlabFastPath(irb) && shift >= 0) {
+    const uint64_t data_offset =
+      mirror::Array::DataOffset(1u << shift).Uint32Value();
+    const uint64_t max_length =
+      (gc::Heap::kMinLargeObjectThreshold - data_offset) >> shift;
+    Type* i64 = irb->getJLongTy();
+
+    BasicBlock* bump = BasicBlock::Create(ctx, "bump", f);
+    Value* length64 = irb->CreateZExt(length, i64);
+    irb->CreateCondBr(
+        irb->CreateICmpUGE(length64, irb->getJLong(max_length)),
+        slow_path, bump, HL->MDB()->createBranchWeights(1, MAX_BRWEIGHT));
+
+    irb->SetInsertPoint(bump);
+    // size = (length << shift) + data_offset, aligned to kObjectAlignment
+    Value* size = irb->CreateAnd(
+        irb->CreateAdd(irb->CreateShl(length64, shift),
+                       irb->getJLong(data_offset + kObjectAlignment - 1)),
+        irb->getJLong(~static_cast<int64_t>(kObjectAlignment - 1)));
+    size->setName("size");
+
+    Value* array = GenerateTlabBump(HL, irb, size, slow_path);
+    StoreClass(HL, irb, array, klass);
+    HL->StoreToObjectOffset(
+        array, mirror::Array::LengthOffset().Uint32Value(), length);
+    GenerateMemoryBarrier(irb, MemBarrierKind::kStoreStore);
+    irb->CreateRet(array);
+  } else {
+    irb->CreateBr(slow_path);
+  }
+
+  irb->SetInsertPoint(slow_path);
+  irb->CreateRet(HL->ArtCallAllocArray__(qpoint, klass, length));
+
+  irb->SetInsertPoint(pinsert_point);
+  return f;
+}
+
+#include "llvm_macros_undef.h"
+
+}  // namespace LLVM
+}  // namespace art
@@ -24,6 +24,7 @@
 #include "llvm_utils.h"
 #include "asm_arm64.h"
 #include "asm_arm_thumb.h"
+#include "asm_x86_64.h"
 #include "hgraph_to_llvm-inl.h"
 #include "hgraph_to_llvm.h"
 
@@ -50,7 +51,8 @@ Function* FunctionHelper::LoadStateAndFlags(
 
   BasicBlock* entry_block=BasicBlock::Create(irb->getContext(), "entry", f);
   irb->SetInsertPoint(entry_block);
-  Value* state_and_flags=Arm64::LoadStateAndFlagsASM(irb);
+  Value* state_and_flags = irb->IsCompilingX86_64() ?
+    X86_64::LoadStateAndFlagsASM(irb) : Arm64::LoadStateAndFlagsASM(irb);
   state_and_flags->setName("state_and_flags");
   irb->CreateRet(state_and_flags);
 
@@ -85,7 +87,9 @@ Function* FunctionHelper::GetQuickEntrypoint(
 
   BasicBlock* entry_block=BasicBlock::Create(irb->getContext(), "entry", f);
   irb->SetInsertPoint(entry_block);
-  Value* e= Arm64::GetQuickEntrypoint(irb, qpoint);
+  Value* e = irb->IsCompilingX86_64() ?
+    X86_64::GetQuickEntrypoint(irb, qpoint) :
+    Arm64::GetQuickEntrypoint(irb, qpoint);
   e->setName("quick" + std::to_string(static_cast<int>(qpoint)));
   irb->CreateRet(e);
 
@@ -121,6 +125,9 @@ Function* FunctionHelper::LoadThread(HGraphToLLVM* HL, IRBuilder* irb) {
     case InstructionSet::kArm64:
       thread_register = Arm64::GetThreadRegister(irb);
       break;
+    case InstructionSet::kX86_64:
+      thread_register = X86_64::GetThreadRegister(irb);
+      break;
     default:
       DLOG(FATAL) << "Unimplemented for architecture: " << isa;
       UNREACHABLE();
@@ -22,16 +22,21 @@
 #include "art_method.h"
 #include "asm_arm64.h"
 #include "asm_arm_thumb.h"
+#include "asm_x86_64.h"
 #include "dex/dex_file_loader.h"
+#include "dex/dex_file_types.h"
 #include "hgraph_to_llvm-inl.h"
 #include "hgraph_to_llvm.h"
 #include "ir_builder.h"
 #include "llvm_compiler.h"
+#include "imtable.h"
 #include "llvm_utils.h"
 #include "mcr_cc/os_comp.h"
 #include "mcr_cc/analyser.h"
 #include "mcr_cc/invoke_histogram.h"
 #include "mcr_rt/invoke_info.h"
+#include "mcr_rt/llvm_inline_cache.h"
+#include "mirror/class.h"
 
 #include "llvm_macros_irb.h"
 
@@ -91,7 +96,7 @@ inline std::string GetSpecName(InvokeHistogram* histogram,
     int cnt=1;
     for (SortedSpeculationIterator it(histogram->begin());
         it != histogram->end(); it++, cnt++) {
-      ss << "." << std::to_string(it->GetSpecClassIdx());
+      ss << "." << HGraphToLLVM::GetSpecClassName(*it);
       ss << "m" << std::to_string(it->GetSpecMethodIdx());
       DLOG(INFO) << mcr::McrCC::PrettyHistogramLine(*it, cnt);
     }
@@ -108,7 +113,7 @@ inline void CreateBasicBlocks(IRBuilder* irb, InvokeHistogram* histogram,
   if (histogram != nullptr) {
     for (SortedSpeculationIterator it(histogram->begin());
          it != histogram->end(); it++) {
-      std::string sidx = std::to_string(it->GetSpecClassIdx());
+      std::string sidx = HGraphToLLVM::GetSpecClassName(*it);
 
       std::string block_name = "class" + sidx +"_";
       std::pair<std::string, BasicBlock*>
@@ -131,6 +136,161 @@ inline void CreateBasicBlocks(IRBuilder* irb, InvokeHistogram* histogram,
       irb->getContext(), miss_block_name, invoke_virtual);
 }
 
+/**
+ * @brief The vtable entry of the receiver class, as
+ *        CodeGeneratorARM64::GenerateVirtualCall. The class is read without
+ *        a read barrier, as only its (immutable) vtable is used.
+ */
+static Value* LoadVTableMethod(HGraphToLLVM* HL, IRBuilder* irb,
+                               HInvoke* hinvoke, Value* receiver) {
+  Value* klass = HL->GenerateReferenceObjectClass(
+      hinvoke, receiver, ReadBarrierOption::kWithoutReadBarrier);
+  klass->setName("klass");
+  uint32_t offset = mirror::Class::EmbeddedVTableEntryOffset(
+      hinvoke->AsInvokeVirtual()->GetVTableIndex(),
+      irb->GetPointerSize()).Uint32Value();
+  Value* method =
+    HL->LoadFromObjectOffset(klass, offset, irb->getVoidPointerType());
+  method->setName("vtable_method");
+  return method;
+}
+
+/**
+ * @brief Inline cache of an interface call site (mcr::LlvmInlineCache).
+ *        Zero-initialized, and filled in by the runtime.
+ */
+static GlobalVariable* CreateInlineCache(IRBuilder* irb, std::string name) {
+  size_t size = mcr::LlvmInlineCache::SizeOf(
+      static_cast<size_t>(irb->GetPointerSize()));
+  ArrayType* ty = ArrayType::get(irb->getInt8Ty(), size);
+  GlobalVariable* cache = new GlobalVariable(*irb->getModule(), ty, false,
+      GlobalValue::InternalLinkage, ConstantAggregateZero::get(ty),
+      "InlineCache." + name);
+  cache->setAlignment(MaybeAlign(8));
+  return cache;
+}
+
+static Value* LoadAcquireInt(IRBuilder* irb, Value* base, uint32_t offset) {
+  Value* loffset = irb->getJUnsignedInt(offset);
+  return irb->IsCompilingX86_64() ?
+    X86_64::LoadAcquire(irb, DataType::Type::kInt32, base, loffset) :
+    Arm64::LoadAcquire(irb, nullptr, DataType::Type::kInt32, base, loffset, false);
+}
+
+/**
+ * @brief Interface dispatch in LLVM, as the quick code and
+ *        art_quick_imt_conflict_trampoline do it, without runtime calls:
+ *  - the IMT entry of the receiver class, unless it is a conflict
+ *    (a runtime method),
+ *  - on a conflict: the inline cache of the call site, and then the
+ *    ImtConflictTable of the conflict method.
+ * Only then it calls the runtime, which also fills in the inline cache
+ * and the conflict table.
+ */
+static Value* ResolveInterfaceMethod(HGraphToLLVM* HL, IRBuilder* irb,
+    HInvoke* hinvoke, Value* receiver, Value* interface_method,
+    GlobalVariable* inline_cache) {
+  const PointerSize ps = irb->GetPointerSize();
+  const uint32_t ptr_size = static_cast<uint32_t>(ps);
+  Type* ptrTy = irb->getVoidPointerType();
+  Function* F = irb->GetInsertBlock()->getParent();
+  LLVMContext& ctx = irb->getContext();
+
+  BasicBlock* bb_conflict = BasicBlock::Create(ctx, "imt_conflict", F);
+  BasicBlock* bb_table = BasicBlock::Create(ctx, "conflict_table", F);
+  BasicBlock* bb_loop = BasicBlock::Create(ctx, "conflict_table_loop", F);
+  BasicBlock* bb_found = BasicBlock::Create(ctx, "conflict_table_found", F);
+  BasicBlock* bb_end = BasicBlock::Create(ctx, "conflict_table_end", F);
+  BasicBlock* bb_next = BasicBlock::Create(ctx, "conflict_table_next", F);
+  BasicBlock* bb_rt = BasicBlock::Create(ctx, "ic_miss", F);
+  BasicBlock* bb_done = BasicBlock::Create(ctx, "imt_done", F);
+  std::vector<std::pair<Value*, BasicBlock*>> resolved;
+
+  // IMT entry
+  Value* klass = HL->GenerateReferenceObjectClass(
+      hinvoke, receiver, ReadBarrierOption::kWithoutReadBarrier);
+  klass->setName("klass");
+  Value* imt = HL->LoadFromObjectOffset(klass,
+      mirror::Class::ImtPtrOffset(ps).Uint32Value(), ptrTy);
+  imt->setName("imt");
+  uint32_t imt_offset = static_cast<uint32_t>(ImTable::OffsetOfElement(
+        hinvoke->AsInvokeInterface()->GetImtIndex(), ps));
+  Value* imt_method = HL->LoadFromObjectOffset(imt, imt_offset, ptrTy);
+  imt_method->setName("imt_method");
+  Value* dex_method_idx = HL->LoadFromObjectOffset(imt_method,
+      ArtMethod::DexMethodIndexOffset().Uint32Value(), irb->getJIntTy());
+  Value* is_conflict = irb->CreateICmpEQ(dex_method_idx,
+      irb->getJUnsignedInt(dex::kDexNoIndex));
+  resolved.push_back(std::make_pair(imt_method, irb->GetInsertBlock()));
+  irb->CreateCondBr(is_conflict, bb_conflict, bb_done);
+
+  // Inline cache: compressed class references, and then their methods
+  irb->SetInsertPoint(bb_conflict);
+  Value* cache = irb->CreateBitCast(inline_cache, ptrTy);
+  Value* klass_ref = irb->CreateTrunc(
+      irb->CreatePtrToInt(klass, irb->getJLongTy()), irb->getJIntTy());
+  for (size_t i = 0; i < mcr::LlvmInlineCache::kSize; i++) {
+    std::string si = std::to_string(i);
+    BasicBlock* bb_hit = BasicBlock::Create(ctx, "ic_hit" + si, F);
+    BasicBlock* bb_check = (i + 1 < mcr::LlvmInlineCache::kSize) ?
+      BasicBlock::Create(ctx, "ic_check" + std::to_string(i + 1), F) : bb_table;
+    Value* cached_class = LoadAcquireInt(irb, cache,
+        mcr::LlvmInlineCache::ClassesOffset() + i * sizeof(uint32_t));
+    irb->CreateCondBr(irb->CreateICmpEQ(cached_class, klass_ref),
+                      bb_hit, bb_check);
+
+    irb->SetInsertPoint(bb_hit);
+    Value* cached_method = HL->LoadFromObjectOffset(cache,
+        mcr::LlvmInlineCache::MethodsOffset() + i * ptr_size, ptrTy);
+    cached_method->setName("ic_method" + si);
+    resolved.push_back(std::make_pair(cached_method, bb_hit));
+    irb->CreateBr(bb_done);
+    irb->SetInsertPoint(bb_check);
+  }
+
+  // ImtConflictTable: (interface method, implementation) pairs,
+  // terminated by a null interface method
+  Value* iface = irb->CreateBitCast(interface_method, ptrTy);
+  Value* table = HL->LoadFromObjectOffset(imt_method,
+      ArtMethod::DataOffset(ps).Uint32Value(), ptrTy);
+  table->setName("conflict_table");
+  irb->CreateBr(bb_loop);
+
+  irb->SetInsertPoint(bb_loop);
+  PHINode* entry = irb->CreatePHI(ptrTy, 2, "conflict_entry");
+  entry->addIncoming(table, bb_table);
+  Value* entry_iface = HL->LoadFromObjectOffset(entry, 0, ptrTy);
+  irb->CreateCondBr(irb->CreateICmpEQ(entry_iface, iface), bb_found, bb_end);
+
+  irb->SetInsertPoint(bb_found);
+  Value* impl = HL->LoadFromObjectOffset(entry, ptr_size, ptrTy);
+  impl->setName("conflict_method");
+  resolved.push_back(std::make_pair(impl, bb_found));
+  irb->CreateBr(bb_done);
+
+  irb->SetInsertPoint(bb_end);
+  irb->CreateCondBr(irb->CreateCmpIsNull(entry_iface), bb_rt, bb_next);
+
+  irb->SetInsertPoint(bb_next);
+  Value* next_entry = irb->CreatePtrDisp(entry,
+      irb->getPtrEquivInt(2 * ptr_size), irb->getInt8Ty()->getPointerTo());
+  entry->addIncoming(next_entry, bb_next);
+  irb->CreateBr(bb_loop);
+
+  // Runtime (fills in the inline cache)
+  irb->SetInsertPoint(bb_rt);
+  Value* rt_method = HL->ArtCallInlineCacheMiss(receiver, iface, cache);
+  resolved.push_back(std::make_pair(rt_method, irb->GetInsertBlock()));
+  irb->CreateBr(bb_done);
+
+  irb->SetInsertPoint(bb_done);
+  PHINode* method = irb->CreatePHI(ptrTy, resolved.size(), "imt_resolved");
+  for (auto& it : resolved) {
+    method->addIncoming(it.first, it.second);
+  }
+  return method;
+}
+
 #define DBG_BB(BB)  \
   if (dbgbb) { \
     irb->AndroidLogPrint(INFO, "BB: " + Pretty(BB) + "\n"); \
@@ -170,6 +330,24 @@ Function* FunctionHelper::InvokeWrapper(
   // calculate the virtual invoke wrapper method's name
   std::string invoke_method_name = GetSpecName(
         histogram, hinvoke, HL, orig_pretty_callee, signature, is_native);
+#if defined(ART_MCR_ANDROID_10)
+  if (hinvoke->IsInvokeInterface()) {
+    // each call site has its own inline cache
+    invoke_method_name += ".ic" + std::to_string(HL->GetMethodIdx()) +
+      "_" + std::to_string(hinvoke->GetDexPc());
+  }
+#endif
+
+  // The guards of the speculations. Each method that uses the wrapper
+  // resolves them in its InitInner methods.
+  std::map<std::string, GlobalVariable*> spec_guards;
+  if (histogram != nullptr && McrDebug::SpeculativeDevirt()) {
+    for (SortedSpeculationIterator it(histogram->begin());
+        it != histogram->end(); it++) {
+      spec_guards[HGraphToLLVM::GetSpecClassName(*it)] =
+        HL->GetSpecClassGuard(*it);
+    }
+  }
 
   // method already defined, so return it
   if (invoke_virtuals_.find(invoke_method_name) != invoke_virtuals_.end()) {
@@ -234,14 +412,17 @@ if(histogram == nullptr && !McrDebug::SpeculativeDevirt()) {
     irb->AndroidLogPrint(WARNING, "SpeculativeDevirt disabled!");
   }
 
+  Value* obj_class = nullptr;
   Value* obj_class_idx = nullptr;
   if (use_histogram) {
     ReadBarrierOption RBO = ReadBarrierOption::kWithoutReadBarrier;
-    Value* obj_class =
-      HL->GenerateReferenceObjectClass(hinvoke, receiver, RBO);
+    obj_class = HL->GenerateReferenceObjectClass(hinvoke, receiver, RBO);
     obj_class->setName("obj_class");
-    obj_class_idx = HL->GetClassTypeIdx(obj_class);
-    obj_class_idx->setName("obj_classIDX");
+    // only for verifying: the guards compare class references
+    if (McrDebug::VerifySpeculation() || McrDebug::VerifySpeculationMiss()) {
+      obj_class_idx = HL->GetClassTypeIdx(obj_class);
+      obj_class_idx->setName("obj_classIDX");
+    }
 
     if(McrDebug::VerifyArtMethod() && McrDebug::DebugLlvmCode4()) {
       HL->ArtCallVerifyArtObject(receiver);
@@ -256,50 +437,72 @@ if(histogram == nullptr && !McrDebug::SpeculativeDevirt()) {
     irb->AndroidLogPrint(ERROR, msg + "\n");
   }
 
-  std::vector<uint32_t> weights;
   if (use_histogram) {
-    SwitchInst* Switch = SwitchInst::Create(
-        obj_class_idx, spec_miss, histogram->GetSize(), irb->GetInsertBlock());
-
-    /* 
+    /*
      * When enabled (use_histogram=T):
      *
-     * Created a switch instruction:
+     * Creates a chain of guards:
      * - for each speculation (histogram entry)
-     *    - ADD a weighted label to the switch (branch predition),
-     *      based on the execution frequency that was observed earlier.
-     *      After the biased check, the method will be executed directly
-     *      (w/o RT intervention. w/o leaving LLVM code).
-     * - add default case:
+     *    - compare the receiver class with the class of the speculation
+     *      (a class reference, resolved by InitInner in its own dex file),
+     *    - weighted (branch predition), based on the execution frequency
+     *      that was observed earlier. After the biased check, the method will
+     *      be executed directly (w/o RT intervention. w/o leaving LLVM code).
+     * - the last guard fails to the miss block:
      *    - call method through RT:
      *    - Something that Android would have done anyway
      *      as this concerns non-direct calls (calls that did not "de-virtualized")
      */
-    // populate instructions for all blocks
+    std::vector<uint32_t> weights;
     for (SortedSpeculationIterator it(histogram->begin());
         it != histogram->end(); it++) {
-      mcr::InvokeInfo invoke_info = *it;
-      const uint32_t class_idx = invoke_info.GetSpecClassIdx();
-
-      // OPTIMIZE_LLVM recursive virtual calls:
-      // if class_idx == HL->GetArtMethod()->GetClass:
-      // then mark the call as tail
-
       uint32_t W = MAX_BRWEIGHT;
       if(histogram->GetSize() > 1) {
-        W = std::min(MAX_BRWEIGHT, invoke_info.GetSpecInvokeType()*100);
+        W = std::min(MAX_BRWEIGHT, it->GetSpecInvokeType()*100);
         DLOG(WARNING) << "Histogram with multiple entries!";
       }
       weights.push_back(W);
+    }
 
-      // a method: loop iterator... and then set full weight..
-      std::string sidx = std::to_string(class_idx);
-
+    Value* obj_class_ref = irb->CreateTrunc(
+        irb->CreatePtrToInt(obj_class, irb->getJLongTy()), irb->getJIntTy());
+    obj_class_ref->setName("obj_class_ref");
+    size_t i = 0;
+    for (SortedSpeculationIterator it(histogram->begin());
+        it != histogram->end(); it++, i++) {
+      std::string sidx = HGraphToLLVM::GetSpecClassName(*it);
       BasicBlock* block = blocks["class" + sidx + "_"];
+      GlobalVariable* guard = spec_guards[sidx];
       CHECK(block != nullptr);
-      CHECK(obj_class_idx !=nullptr);
+      CHECK(guard != nullptr);
+
+      // null (not resolved) never matches
+      LoadInst* spec_class = irb->CreateLoad(guard);
+      spec_class->setAtomic(AtomicOrdering::Monotonic);
+      spec_class->setName("spec_class" + sidx);
+      BasicBlock* next = (i + 1 < weights.size()) ?
+        BasicBlock::Create(irb->getContext(), "guard" + std::to_string(i + 1),
+                           invoke_virtual) : spec_miss;
+      uint32_t rest = 1;
+      for (size_t j = i + 1; j < weights.size(); j++) rest += weights[j];
+      irb->CreateCondBr(irb->CreateICmpEQ(obj_class_ref, spec_class),
+                        block, next,
+                        HL->MDB()->createBranchWeights(weights[i], rest));
+      irb->SetInsertPoint(next);
+    }
+
+    // populate instructions for all blocks
+    for (SortedSpeculationIterator it(histogram->begin());
+        it != histogram->end(); it++) {
+      mcr::InvokeInfo invoke_info = *it;
+
+      // OPTIMIZE_LLVM recursive virtual calls:
+      // if class_idx == HL->GetArtMethod()->GetClass:
+      // then mark the call as tail
+
+      std::string sidx = HGraphToLLVM::GetSpecClassName(invoke_info);
+      BasicBlock* block = blocks["class" + sidx + "_"];
 
-      Switch->addCase(irb->getJUnsignedInt(class_idx), block);
       ArtMethod* spec_art_method = HL->ResolveSpeculativeMethod(invoke_info);
 
       // Update stuff that will be used by hit block
@@ -349,12 +552,6 @@ if(histogram == nullptr && !McrDebug::SpeculativeDevirt()) {
         }
       }  // spec-hit
     }  // for each speculation
-
-    // Zero weight fro miss case
-    weights.push_back(0);
-
-    MDNode *N=HL->MDB()->createBranchWeights(weights);
-    Switch->setMetadata(LLVMContext::MD_prof, N);
   } else {
     irb->CreateBr(spec_miss);
   }
@@ -408,18 +605,13 @@ if(histogram == nullptr && !McrDebug::SpeculativeDevirt()) {
     uint32_t imt_index;
     if (hinvoke->IsInvokeInterface()) { 
 #if defined(ART_MCR_ANDROID_10)
-      imt_index= static_cast<uint32_t>(ImTable::OffsetOfElement(
-            hinvoke->AsInvokeInterface()->GetImtIndex(),
-            kArm64PointerSize));
-      rt_resolved_vmethod=
-        HL->ArtCallResolveInterfaceMethod(receiver, lart_method);
+      imt_index = hinvoke->AsInvokeInterface()->GetImtIndex();
+      rt_resolved_vmethod = ResolveInterfaceMethod(HL, irb, hinvoke,
+          receiver, lart_method,
+          CreateInlineCache(irb, invoke_method_name));
       if(McrDebug::DebugLlvmCode4()) {
-        LOGLLVM4val(WARNING, "ResolveInterface: RT", rt_resolved_vmethod);
+        LOGLLVM4val(WARNING, "ResolveInterface: LLVM", rt_resolved_vmethod);
         HL->ArtCallVerifyArtMethod(rt_resolved_vmethod);
-        // TODO: use directly LLVM, but have to do the
-        // runtime method check, then the conflict
-        // Value* cc_resolved_vmethod=
-        //   HL->ResolveInterfaceMethod(hinvoke->AsInvokeInterface(), receiver);
       }
 
 #elif defined(ART_MCR_ANDROID_6)
@@ -432,8 +624,7 @@ if(histogram == nullptr && !McrDebug::SpeculativeDevirt()) {
         << std::to_string(imt_index);
     } else {
 #if defined(ART_MCR_ANDROID_10)
-      rt_resolved_vmethod =
-        HL->ArtCallResolveVirtualMethod(receiver, lart_method);
+      rt_resolved_vmethod = LoadVTableMethod(HL, irb, hinvoke, receiver);
 #elif defined(ART_MCR_ANDROID_6)
       F = __ResolveVirtualMethod();
 #endif
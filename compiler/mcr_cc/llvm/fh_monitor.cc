@@ -0,0 +1,250 @@
+/**
+ * Inline thin-lock fast paths of monitor-enter and monitor-exit,
+ * the same with art_quick_lock_object and art_quick_unlock_object.
+ *
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "function_helper.h"
+
+#include <llvm/IR/Argument.h>
+#include <llvm/IR/Function.h>
+#include "hgraph_to_llvm-inl.h"
+#include "hgraph_to_llvm.h"
+#include "ir_builder.h"
+#include "lock_word.h"
+#include "mirror/object.h"
+
+#include "llvm_macros_irb.h"
+
+using namespace ::llvm;
+
+namespace art {
+namespace LLVM {
+
+static Value* GetLockWordAddress(IRBuilder* irb, Value* obj) {
+  return irb->CreatePtrDisp(
+      obj, irb->getPtrEquivInt(mirror::Object::MonitorOffset().Uint32Value()),
+      irb->getJIntTy()->getPointerTo());
+}
+
+static Value* GetJInt(IRBuilder* irb, uint32_t value) {
+  return irb->getJInt(static_cast<int32_t>(value));
+}
+
+// (value & mask) == 0
+static Value* CreateTestZero(IRBuilder* irb, Value* value, uint32_t mask) {
+  return irb->CreateICmpEQ(irb->CreateAnd(value, GetJInt(irb, mask)),
+                           irb->getJInt(0));
+}
+
+/**
+ * @brief Creates the monitor helper: a null object and anything but an
+ *        unlocked or thin-locked (by this thread) lock word go to the
+ *        runtime entrypoint. So do recursion count overflows (inflation)
+ *        and contention (a lock owned by another thread).
+ */
+static Function* CreateMonitorFunction(HGraphToLLVM* HL, IRBuilder* irb,
+                                       const char* name, Value** obj,
+                                       Value** thread_id, BasicBlock** retry,
+                                       BasicBlock** slow_path) {
+  D3LOG(INFO) << "Creating function: " << name;
+  FunctionType* ty = FunctionType::get(irb->getJVoidTy(),
+      {irb->getVoidPointerType()}, false);
+  Function* f = Function::Create(
+      ty, Function::LinkOnceODRLinkage, name, irb->getModule());
+  f->setDSOLocal(true);
+  FunctionHelper::AddAttributesCommon(f);
+
+  Function::arg_iterator arg_iter(f->arg_begin());
+  *obj = &*arg_iter++;
+  (*obj)->setName("obj");
+
+  LLVMContext& ctx = irb->getContext();
+  BasicBlock* entry_block = BasicBlock::Create(ctx, "entry", f);
+  BasicBlock* load_id = BasicBlock::Create(ctx, "load_thread_id", f);
+  *retry = BasicBlock::Create(ctx, "retry", f);
+  *slow_path = BasicBlock::Create(ctx, "slow_path", f);
+
+  irb->SetInsertPoint(entry_block);
+  irb->CreateCondBr(
+      irb->CreateICmpEQ(*obj, ConstantPointerNull::get(
+          cast<PointerType>((*obj)->getType()))),
+      *slow_path, load_id, HL->MDB()->createBranchWeights(1, MAX_BRWEIGHT));
+
+  irb->SetInsertPoint(load_id);
+  *thread_id = HL->LoadFromObjectOffset(HL->GetLoadedThread(),
+      HL->GetThreadThinLockIdOffset(), irb->getJIntTy());
+  (*thread_id)->setName("thread_id");
+  irb->CreateBr(*retry);
+  return f;
+}
+
+/**
+ * @brief Stores new_value to the lock word, if it is still old_value.
+ *        Retries from the start otherwise (as the stxr failures of quick).
+ */
+static void CreateCmpXchgOrRetry(HGraphToLLVM* HL, IRBuilder* irb,
+                                 Value* addr, Value* old_value,
+                                 Value* new_value, AtomicOrdering ordering,
+                                 BasicBlock* retry) {
+  LLVMContext& ctx = irb->getContext();
+  Function* f = irb->GetInsertBlock()->getParent();
+  AtomicCmpXchgInst* cmpxchg = irb->CreateAtomicCmpXchg(
+      addr, old_value, new_value, ordering, AtomicOrdering::Monotonic);
+  BasicBlock* done = BasicBlock::Create(ctx, "done", f);
+  irb->CreateCondBr(irb->CreateExtractValue(cmpxchg, 1), done, retry,
+                    HL->MDB()->createBranchWeights(MAX_BRWEIGHT, 1));
+  irb->SetInsertPoint(done);
+  irb->CreateRetVoid();
+}
+
+/**
+ * @brief monitor-enter:
+ *   - unlocked: cas the thread id in (acquire), keeping the gc bits
+ *   - thin-locked by this thread: increments the recursion count,
+ *     unless it overflows
+ */
+Function* FunctionHelper::LockObject(HGraphToLLVM* HL, IRBuilder* irb) {
+  if (lock_object_ != nullptr) return lock_object_;
+  BasicBlock* pinsert_point = irb->GetInsertBlock();
+
+  Value *obj, *thread_id;
+  BasicBlock *retry, *slow_path;
+  Function* f = CreateMonitorFunction(HL, irb, "LockObject", &obj,
+                                      &thread_id, &retry, &slow_path);
+  lock_object_ = f;
+  LLVMContext& ctx = irb->getContext();
+  BasicBlock* unlocked = BasicBlock::Create(ctx, "unlocked", f);
+  BasicBlock* not_unlocked = BasicBlock::Create(ctx, "not_unlocked", f);
+  BasicBlock* recursive = BasicBlock::Create(ctx, "recursive", f);
+  BasicBlock* increment = BasicBlock::Create(ctx, "increment", f);
+
+  irb->SetInsertPoint(retry);
+  Value* addr = GetLockWordAddress(irb, obj);
+  LoadInst* lock_word = irb->CreateLoad(addr);
+  lock_word->setAtomic(AtomicOrdering::Monotonic);
+  lock_word->setName("lock_word");
+  // unlocked: the thread id, a count of 0, and the original gc bits.
+  // Otherwise: zero owner and state bits mean it is thin-locked by us.
+  Value* xored = irb->CreateXor(lock_word, thread_id);
+  irb->CreateCondBr(
+      CreateTestZero(irb, lock_word, LockWord::kGCStateMaskShiftedToggled),
+      unlocked, not_unlocked);
+
+  irb->SetInsertPoint(unlocked);
+  CreateCmpXchgOrRetry(HL, irb, addr, lock_word, xored,
+                       AtomicOrdering::Acquire, retry);
+
+  irb->SetInsertPoint(not_unlocked);
+  irb->CreateCondBr(
+      CreateTestZero(irb, xored, LockWord::kStateMaskShifted |
+                     LockWord::kThinLockOwnerMaskShifted),
+      recursive, slow_path);
+
+  irb->SetInsertPoint(recursive);
+  Value* new_lock_word = irb->CreateAdd(
+      lock_word, GetJInt(irb, LockWord::kThinLockCountOne));
+  // a zero count overflowed: the runtime inflates the lock
+  irb->CreateCondBr(
+      CreateTestZero(irb, new_lock_word, LockWord::kThinLockCountMaskShifted),
+      slow_path, increment);
+
+  irb->SetInsertPoint(increment);
+  CreateCmpXchgOrRetry(HL, irb, addr, lock_word, new_lock_word,
+                       AtomicOrdering::Monotonic, retry);
+
+  irb->SetInsertPoint(slow_path);
+  HL->ArtCallMonitorOperation(obj, true);
+  irb->CreateRetVoid();
+
+  irb->SetInsertPoint(pinsert_point);
+  return f;
+}
+
+/**
+ * @brief monitor-exit:
+ *   - thin-locked once by this thread: stores the unlocked lock word
+ *     (release), keeping the gc bits
+ *   - thin-locked recursively by this thread: decrements the count
+ *
+ * With read barriers the gc bits can change concurrently, so the stores
+ * are a cas (as the stlxr/stxr of quick).
+ */
+Function* FunctionHelper::UnlockObject(HGraphToLLVM* HL, IRBuilder* irb) {
+  if (unlock_object_ != nullptr) return unlock_object_;
+  BasicBlock* pinsert_point = irb->GetInsertBlock();
+
+  Value *obj, *thread_id;
+  BasicBlock *retry, *slow_path;
+  Function* f = CreateMonitorFunction(HL, irb, "UnlockObject", &obj,
+                                      &thread_id, &retry, &slow_path);
+  unlock_object_ = f;
+  LLVMContext& ctx = irb->getContext();
+  BasicBlock* simply_locked = BasicBlock::Create(ctx, "simply_locked", f);
+  BasicBlock* not_simply_locked =
+    BasicBlock::Create(ctx, "not_simply_locked", f);
+  BasicBlock* recursive = BasicBlock::Create(ctx, "recursive", f);
+
+  irb->SetInsertPoint(retry);
+  Value* addr = GetLockWordAddress(irb, obj);
+  LoadInst* lock_word = irb->CreateLoad(addr);
+  lock_word->setAtomic(AtomicOrdering::Monotonic);
+  lock_word->setName("lock_word");
+  Value* xored = irb->CreateXor(lock_word, thread_id);
+  irb->CreateCondBr(
+      CreateTestZero(irb, xored, LockWord::kGCStateMaskShiftedToggled),
+      simply_locked, not_simply_locked);
+
+  irb->SetInsertPoint(simply_locked);
+  if (kUseReadBarrier) {
+    CreateCmpXchgOrRetry(HL, irb, addr, lock_word, xored,
+                         AtomicOrdering::Release, retry);
+  } else {
+    StoreInst* store = irb->CreateStore(xored, addr);
+    store->setAtomic(AtomicOrdering::Release);
+    irb->CreateRetVoid();
+  }
+
+  irb->SetInsertPoint(not_simply_locked);
+  irb->CreateCondBr(
+      CreateTestZero(irb, xored, LockWord::kStateMaskShifted |
+                     LockWord::kThinLockOwnerMaskShifted),
+      recursive, slow_path);
+
+  irb->SetInsertPoint(recursive);
+  Value* new_lock_word = irb->CreateSub(
+      lock_word, GetJInt(irb, LockWord::kThinLockCountOne));
+  if (kUseReadBarrier) {
+    CreateCmpXchgOrRetry(HL, irb, addr, lock_word, new_lock_word,
+                         AtomicOrdering::Monotonic, retry);
+  } else {
+    StoreInst* store = irb->CreateStore(new_lock_word, addr);
+    store->setAtomic(AtomicOrdering::Monotonic);
+    irb->CreateRetVoid();
+  }
+
+  irb->SetInsertPoint(slow_path);
+  HL->ArtCallMonitorOperation(obj, false);
+  irb->CreateRetVoid();
+
+  irb->SetInsertPoint(pinsert_point);
+  return f;
+}
+
+#include "llvm_macros_undef.h"
+
+}  // namespace LLVM
+}  // namespace art
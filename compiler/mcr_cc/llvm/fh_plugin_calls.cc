@@ -1,5 +1,5 @@
 /**
- * Code that imports the plugin-generated runtime calls
+ * Code that imports the runtime calls of the runtime library
  *
  * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
  *
@@ -67,6 +67,8 @@ ART_METHOD_INL(__mirrorStringCompareTo,
 
 ART_METHOD_INL(__CheckCast, "_ZN3art4LLVM9CheckCastEPvS1_");
 ART_METHOD_INL(__InstanceOf, "_ZN3art4LLVM10InstanceOfEPvS1_");
+ART_METHOD_INL(__IsInitialized, "art_llvm_rt_IsInitialized");
+ART_METHOD_INL(__StringCompareToFast, "art_llvm_rt_StringCompareTo");
 ART_METHOD_INL(__object_AsMirrorPtr, "_ZNK3art6mirror15ObjectReferenceILb0ENS0_6ObjectEE11AsMirrorPtrEv");
 ART_METHOD_INL(__object_FromMirrorPtr, "_ZN3art6mirror19CompressedReferenceINS0_6ObjectEE13FromMirrorPtrEPS2_");
 
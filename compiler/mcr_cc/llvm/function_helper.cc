@@ -23,6 +23,7 @@
 #include "art_method.h"
 #include "asm_arm64.h"
 #include "asm_arm_thumb.h"
+#include "asm_x86_64.h"
 #include "base/logging.h"
 #include "class_status.h"
 #include "hgraph_to_llvm-inl.h"
@@ -584,33 +585,13 @@ Function* FunctionHelper::GenerateClassInitializationCheck(
     VERIFY_LLVMD4("check_init");
   }
 
-  constexpr size_t status_lsb_position = SubtypeCheckBits::BitStructSizeOf();
-  const size_t status_byte_offset =
-    mirror::Class::StatusOffset().SizeValue() +
-    (status_lsb_position / kBitsPerByte);
-  UNUSED(status_byte_offset);
-  constexpr uint32_t shifted_initialized_value =
-    enum_cast<uint32_t>(ClassStatus::kInitialized) << (status_lsb_position % kBitsPerByte);
-
-  // When using assembly (not pure_llvm) it works, as long as
-  // we do an AndroidLog call..
-  Value* loffset = irb->getPtrEquivInt(status_byte_offset);
-  Value* status_addr = irb->CreatePtrDisp(arg_class, loffset,
-      irb->getJLongTy()->getPointerTo());
-  status_addr->setName("status_addr");
-
-  // INFO semi manual
-  Value* cast = irb->CreateBitCast(status_addr, irb->getVoidPointerType());
-  // Value* temp = new LoadInst(irb->getJByteTy(), cast, "class_status",
-  //     false/*volatile*/, Align(), AtomicOrdering::Acquire,
-  //     SyncScope::System, check_init);
-  // __ Ldarb(temp, HeapOperand(temp));
-  Value* temp=Arm64::__Ldarb(irb, cast);
-  temp = irb->CreateZExt(temp, irb->getJIntTy());
-
-  // __ Cmp(temp, shifted_initialized_value);
-  Value* init_val = irb->getJInt(shifted_initialized_value);
-  Value* is_inited = irb->mCreateCmpEQ(false, temp, init_val);
+  // Class::IsInitialized of the runtime library: a plain atomic load that
+  // opt can inline and schedule (unlike the inline asm of Ldarb)
+  Value* klass = irb->CreateBitCast(arg_class,
+      __IsInitialized()->getFunctionType()->getParamType(0));
+  Value* inited = irb->CreateCall(__IsInitialized(), {klass});
+  Value* is_inited = irb->CreateICmpNE(
+      inited, ConstantInt::get(inited->getType(), 0));
   is_inited->setName("is_inited");
 
   irb->CreateCondBr(is_inited, ok, init);
@@ -996,6 +977,14 @@ Function* FunctionHelper::MarkGCCard(
 
   irb->SetInsertPoint(mark);
   VERIFY_LLVMD4("MarkGCCard: marking..");
+  if (irb->IsCompilingX86_64()) {
+    X86_64::MarkGCCard(irb, object);
+    irb->CreateRetVoid();
+    irb->SetInsertPoint(done);
+    irb->CreateRetVoid();
+    irb->SetInsertPoint(pinsert_point);
+    return func;
+  }
 
   /* Example:
    *
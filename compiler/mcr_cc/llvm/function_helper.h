@@ -98,6 +98,12 @@ class FunctionHelper {
       Value* receiver, bool is_static, std::vector<Value*> callee_args,
       DataType::Type ret_type, uint32_t didx, const char* shorty,
       uint32_t shorty_len, std::string pretty_method, std::string call_info);
+  bool CanCallQuickDirect(IRBuilder* irb, const char* shorty,
+                          uint32_t shorty_len, bool is_static);
+  Value* LLVMtoQuickDirect(
+      HGraphToLLVM* HL, IRBuilder* irb, Value* art_method,
+      Value* receiver, bool is_static, std::vector<Value*> callee_args,
+      DataType::Type ret_type, const char* shorty, uint32_t shorty_len);
 
 
   Function* LoadClass(HGraphToLLVM* HL, IRBuilder* irb,
@@ -119,6 +125,14 @@ class FunctionHelper {
 
   Function* GenerateClassInitializationCheck(HGraphToLLVM* HL, IRBuilder* irb);
 
+  Function* AllocObject(
+      HGraphToLLVM* HL, IRBuilder* irb, QuickEntrypointEnum qpoint);
+  Function* AllocArray(
+      HGraphToLLVM* HL, IRBuilder* irb, QuickEntrypointEnum qpoint);
+
+  Function* LockObject(HGraphToLLVM* HL, IRBuilder* irb);
+  Function* UnlockObject(HGraphToLLVM* HL, IRBuilder* irb);
+
   // void FieldLoadWithBakerReadBarrier(
   //     HGraphToLLVM* HL, HInstruction* instruction, Value* lobj,
   //     uint32_t offset, bool needs_null_check, bool use_load_acquire);
@@ -219,6 +233,9 @@ class FunctionHelper {
   Function* __VerifyArtObject();
   Function* __VerifyArtClass();
   Function* __ArrayPutObject();
+  // * Fast paths of the runtime library (art_runtime_lib.cc)
+  Function* __IsInitialized();
+  Function* __StringCompareToFast();
 
   // * JValue methods
   Function* __jvalue_SetZ();
@@ -274,6 +291,9 @@ class FunctionHelper {
   std::map<std::string, Function*> load_string_;
   std::map<std::string, Function*> array_get_;
   std::map<std::string, Function*> string_compare_to_;
+  std::map<QuickEntrypointEnum, Function*> alloc_;
+  Function* lock_object_ = nullptr;
+  Function* unlock_object_ = nullptr;
   Function* class_init_check_ = nullptr;
 
   void VerifySpeculation(
@@ -0,0 +1,195 @@
+/**
+ * Branch profile of LLVM code: with opt.profile_branches the inner methods
+ * count their entries and the successors of their HIf and HPackedSwitch
+ * (mcr::BranchProfile). Later compilations turn those counts into
+ * branch_weights and function_entry_count metadata (BranchProfileIndex).
+ *
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "hgraph_to_llvm.h"
+
+#include <algorithm>
+#include <limits>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/GlobalVariable.h>
+#include <llvm/IR/Instructions.h>
+#include "hgraph_to_llvm-inl.h"
+#include "ir_builder.h"
+#include "mcr_cc/branch_profile_index.h"
+#include "mcr_rt/branch_profile.h"
+#include "optimizing/nodes.h"
+
+#include "llvm_macros_irb_.h"
+
+using namespace ::llvm;
+namespace art {
+namespace LLVM {
+
+/**
+ * @brief Increments the entry counter, and gives the inner method the
+ *        entry count of the profile.
+ */
+void HGraphToLLVM::ProfileMethodEntry() {
+  uint64_t entry_count = mcr::BranchProfileIndex::Current()->GetEntryCount(
+      GetGraph()->GetDexFile().GetLocation(), GetMethodIdx());
+  if (entry_count > 0) {
+    D3LOG(INFO) << __func__ << ": entry count: " << entry_count;
+    inner_func_->setEntryCount(
+        Function::ProfileCount(entry_count, Function::PCT_Real));
+  }
+
+  if (!McrDebug::ProfileBranches()) return;
+  IncrementBranchCounter(mcr::BranchProfile::kMethodEntry, 0, 0);
+}
+
+/**
+ * @brief Increments the counter of the successor (successor_index) that
+ *        h takes. There is a counter for each of its num_successors.
+ */
+void HGraphToLLVM::ProfileBranch(HInstruction* h, Value* successor_index,
+                                 uint32_t num_successors) {
+  if (!McrDebug::ProfileBranches()) return;
+  D4LOG(INFO) << __func__ << ": " << GetTwine(h);
+  const uint32_t first = branch_sites_.size() / 3;
+  for (uint32_t i = 0; i < num_successors; i++) {
+    AddBranchSite(h->GetBlock()->GetBlockId(), h->GetDexPc(), i);
+  }
+  Value* idx = irb_->CreateAdd(successor_index, irb_->getJUnsignedInt(first));
+  CreateCounterIncrement(idx);
+}
+
+void HGraphToLLVM::IncrementBranchCounter(uint32_t block_id, uint32_t dex_pc,
+                                          uint32_t successor) {
+  const uint32_t idx = branch_sites_.size() / 3;
+  AddBranchSite(block_id, dex_pc, successor);
+  CreateCounterIncrement(irb_->getJUnsignedInt(idx));
+}
+
+void HGraphToLLVM::AddBranchSite(uint32_t block_id, uint32_t dex_pc,
+                                 uint32_t successor) {
+  branch_sites_.push_back(block_id);
+  branch_sites_.push_back(dex_pc);
+  branch_sites_.push_back(successor);
+}
+
+/**
+ * @brief The counters are not known until the whole method is generated,
+ *        so the increments use a placeholder array that
+ *        FinalizeBranchProfile replaces.
+ *        They are racy (like the counters of ProfilingInfo).
+ */
+void HGraphToLLVM::CreateCounterIncrement(Value* idx) {
+  if (branch_counters_ == nullptr) {
+    ArrayType* ty = ArrayType::get(irb_->getJIntTy(), 0);
+    branch_counters_ = new GlobalVariable(*mod_, ty, false,
+        GlobalValue::ExternalLinkage, nullptr,
+        "BranchCounters.placeholder");
+  }
+  Value* addr = irb_->CreateGEP(branch_counters_,
+                                {irb_->getJUnsignedInt(0), idx});
+  Value* count = irb_->CreateLoad(addr);
+  irb_->CreateStore(irb_->CreateAdd(count, irb_->getJUnsignedInt(1)), addr);
+}
+
+/**
+ * @brief Creates the counters and the table of their sites, and the
+ *        InitInner methods register them with the runtime
+ *        (art_llvm_register_branch_profile).
+ */
+void HGraphToLLVM::FinalizeBranchProfile() {
+  if (branch_counters_ == nullptr) return;
+  const uint32_t num_sites = branch_sites_.size() / 3;
+  const std::string name = inner_func_->getName().str();
+  D3LOG(INFO) << __func__ << ": " << num_sites << " counters: " << name;
+
+  ArrayType* counters_ty = ArrayType::get(irb_->getJIntTy(), num_sites);
+  GlobalVariable* counters = new GlobalVariable(*mod_, counters_ty, false,
+      GlobalValue::InternalLinkage, ConstantAggregateZero::get(counters_ty),
+      "BranchCounters." + name);
+  counters->setAlignment(MaybeAlign(4));
+  branch_counters_->replaceAllUsesWith(
+      ConstantExpr::getBitCast(counters, branch_counters_->getType()));
+  branch_counters_->eraseFromParent();
+  branch_counters_ = nullptr;
+
+  std::vector<Constant*> lsites;
+  for (uint32_t site : branch_sites_) {
+    lsites.push_back(irb_->getJUnsignedInt(site));
+  }
+  ArrayType* sites_ty = ArrayType::get(irb_->getJIntTy(), lsites.size());
+  GlobalVariable* sites = new GlobalVariable(*mod_, sites_ty, true,
+      GlobalValue::PrivateLinkage, ConstantArray::get(sites_ty, lsites),
+      "BranchSites." + name);
+  sites->setAlignment(MaybeAlign(4));
+  branch_sites_.clear();
+
+  BasicBlock* prev_block = irb_->GetInsertBlock();
+  Value* referrers[] = { art_method_ichf_, art_method_init_ };
+  BasicBlock* blocks[] = { init_inner_from_ichf_block_,
+                           init_inner_from_init_block_ };
+  for (size_t i = 0; i < 2; i++) {
+    irb_->SetInsertPoint(blocks[i]);
+    ArtCallRegisterBranchProfile(
+        referrers[i],
+        irb_->CreateBitCast(counters, irb_->getVoidPointerType()),
+        irb_->CreateBitCast(sites, irb_->getVoidPointerType()),
+        num_sites);
+  }
+  irb_->SetInsertPoint(prev_block);
+}
+
+/**
+ * @brief branch_weights of h from the profile, or nullptr when it has none.
+ *        Counts are scaled down to fit the 32-bit weights.
+ */
+MDNode* HGraphToLLVM::GetBranchWeights(HInstruction* h,
+                                       uint32_t num_successors) {
+  std::vector<uint64_t> counts = mcr::BranchProfileIndex::Current()->Lookup(
+      GetGraph()->GetDexFile().GetLocation(), GetMethodIdx(),
+      h->GetBlock()->GetBlockId(), h->GetDexPc(), num_successors);
+  if (counts.empty()) return nullptr;
+
+  uint64_t max_count = *std::max_element(counts.begin(), counts.end());
+  uint64_t scale = max_count / std::numeric_limits<uint32_t>::max() + 1;
+  std::vector<uint32_t> weights;
+  for (uint64_t count : counts) {
+    weights.push_back(static_cast<uint32_t>(count / scale));
+  }
+  D4LOG(INFO) << __func__ << ": " << GetTwine(h) << ": "
+    << weights.size() << " weights";
+  return MDB()->createBranchWeights(weights);
+}
+
+/**
+ * @brief Profiled calls of an invoke to another LLVM method (for the
+ *        RegionInliner), or 0 when unknown.
+ *        Only the invoke histogram has counts per call site (the receivers
+ *        of virtual and interface calls). The entry count of a callee is
+ *        shared by all its callers, so it is not used.
+ */
+uint64_t HGraphToLLVM::GetCallCount(HInvoke* hinvoke) {
+  // synthetic speculations (of direct calls) count once
+  if (hinvoke->HasSpeculation() &&
+      hinvoke->GetSpeculation()->GetInvokeTimes() > 1) {
+    return hinvoke->GetSpeculation()->GetInvokeTimes();
+  }
+  return 0;
+}
+
+#include "llvm_macros_undef.h"
+
+}  // namespace LLVM
+}  // namespace art
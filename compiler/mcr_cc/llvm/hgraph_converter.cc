@@ -19,6 +19,8 @@
 
 #include "asm_arm64.h"
 #include "asm_arm_thumb.h"
+#include "asm_x86_64.h"
+#include "base/casts.h"
 #include "dex/dex_file.h"
 #include "dex/invoke_type.h"
 #include "dex/method_reference.h"
@@ -68,7 +70,14 @@ void HGraphToLLVM::VisitBasicBlock(HBasicBlock* hblock) {
     PrintBasicBlockDebug(hblock);
   }
   D3LOG(INFO) << "VisitBasicBlock: " << GetBasicBlockName(hblock);
-  HGraphVisitor::VisitBasicBlock(hblock);
+  ResetDebugLocation();
+  if (McrDebug::GcStackMaps()) {
+    VisitBasicBlockWithStackMaps(hblock);
+  } else if (McrDebug::LineTable()) {
+    VisitBasicBlockWithDebugLocations(hblock);
+  } else {
+    HGraphVisitor::VisitBasicBlock(hblock);
+  }
 }
 
 void HGraphToLLVM::VisitCurrentMethod(HCurrentMethod* h) {
@@ -258,7 +267,10 @@ void HGraphToLLVM::VisitMultiplyAccumulate(HMultiplyAccumulate* h) {
 
 void HGraphToLLVM::VisitMonitorOperation(HMonitorOperation* instruction) {
   Value* lobj = getValue(instruction->InputAt(0));
-  ArtCallMonitorOperation(lobj, instruction->IsEnter());
+  // thin-lock fast paths, with the entrypoints as slow paths (fh_monitor)
+  Function* f = instruction->IsEnter() ?
+    fh_->LockObject(this, irb_) : fh_->UnlockObject(this, irb_);
+  irb_->CreateCall(f, irb_->CreateBitCast(lobj, irb_->getVoidPointerType()));
   MaybeGenerateMarkingRegisterCheck(/* code= */ __LINE__);
 }
 
@@ -272,6 +284,12 @@ void HGraphToLLVM::VisitPackedSwitch(HPackedSwitch* switch_instr) {
   D3LOG(INFO) << __func__ << ": LowBound:" << lower_bound
               << " NumEntries:" << num_entries;
 
+  // successors: the entries, and then the default
+  Value* case_idx = irb_->CreateSub(value, irb_->getJInt(lower_bound));
+  ProfileBranch(switch_instr, irb_->CreateSelect(
+        irb_->CreateICmpULT(case_idx, irb_->getJUnsignedInt(num_entries)),
+        case_idx, irb_->getJUnsignedInt(num_entries)), num_entries + 1);
+
   SwitchInst* Switch = SwitchInst::Create(
       value, ldefault_block, num_entries, irb_->GetInsertBlock());
 
@@ -291,6 +309,22 @@ void HGraphToLLVM::VisitPackedSwitch(HPackedSwitch* switch_instr) {
     BasicBlock* lsuccessor = getBasicBlock(successor);
     Switch->addCase(case_val, lsuccessor);
   }
+
+  MDNode* weights = GetBranchWeights(switch_instr, num_entries + 1);
+  if (weights != nullptr) {
+    // the default, the entries, and the extra case of the default block
+    std::vector<uint32_t> lweights { mdconst::extract<ConstantInt>(
+        weights->getOperand(num_entries + 1))->getZExtValue() };
+    for (uint32_t i = 0; i < num_entries; i++) {
+      lweights.push_back(mdconst::extract<ConstantInt>(
+            weights->getOperand(i + 1))->getZExtValue());
+    }
+    while (lweights.size() < Switch->getNumSuccessors()) {
+      lweights.push_back(0);
+    }
+    Switch->setMetadata(LLVMContext::MD_prof,
+                        MDB()->createBranchWeights(lweights));
+  }
 }
 
 void HGraphToLLVM::VisitGoto(HGoto* got) {
@@ -352,13 +386,16 @@ void HGraphToLLVM::VisitPhi(HPhi* h ATTRIBUTE_UNUSED) {
 void HGraphToLLVM::PopulatePhi(HPhi* hphi) {
   D3LOG(INFO) << "PopulatePhi: " << prt_->GetInstruction(hphi);
   PHINode* lphi = getPhi(hphi);
+  if (hphi->IsCatchPhi()) {
+    return;  // its inputs are added by each dispatch (GenerateCatchDispatch)
+  }
 
   D3LOG(INFO) << "Generating phi inputs";
   for (size_t i = 0; i < hphi->InputCount(); i++) {
     D5LOG(INFO) << "Generating phi input: " << i;
     HInstruction* input = hphi->InputAt(i);
     HBasicBlock* pred = hphi->GetBlock()->GetPredecessors()[i];
-    BasicBlock* lpred = getBasicBlock(pred);
+    BasicBlock* lpred = GetLastBasicBlock(pred);
 
     BasicBlock* lblockSC = nullptr;
     if(phi_sc_additions_.find(lpred) != phi_sc_additions_.end()) {
@@ -389,7 +426,10 @@ void HGraphToLLVM::VisitIf(HIf* h) {
   Value* condition = irb_->CreateICmpNE(lhs, rhs_false);
   BasicBlock* ltrue_block = getBasicBlock(htrue_block);
   BasicBlock* lfalse_block = getBasicBlock(hfalse_block);
-  irb_->CreateCondBr(condition, ltrue_block, lfalse_block);
+  ProfileBranch(h, irb_->CreateSelect(condition, irb_->getJUnsignedInt(0),
+                                      irb_->getJUnsignedInt(1)), 2);
+  irb_->CreateCondBr(condition, ltrue_block, lfalse_block,
+                     GetBranchWeights(h, 2));
 }
 
 void HGraphToLLVM::VisitSelect(HSelect* h) {
@@ -717,6 +757,18 @@ void HGraphToLLVM::VisitLoadClass(HLoadClass* cls) {
         skip_init_check = true;
       }
       break;
+    case HLoadClass::LoadKind::kJitBootImageAddress: {
+      // LLVM JIT tier: the boot image is not moving, so its address is in
+      // the code, as in the quick code
+      uint32_t address = reinterpret_cast32<uint32_t>(cls->GetClass().Get());
+      DCHECK_NE(address, 0u);
+      loaded_class = irb_->CreateIntToPtr(irb_->getJUnsignedInt(address),
+          irb_->getVoidPointerType());
+    } break;
+    case HLoadClass::LoadKind::kJitTableAddress:
+      // LLVM JIT tier: there are no JIT roots of LLVM code, so it goes
+      // through the runtime (as kRuntimeCall)
+      FALLTHROUGH_INTENDED;
     case HLoadClass::LoadKind::kRuntimeCall: {
       // TODO make this: LoadClassSlow
       // and for BssCheck make: LoadClassBss,
@@ -726,10 +778,6 @@ void HGraphToLLVM::VisitLoadClass(HLoadClass* cls) {
       loaded_class = irb_->CreateCall(
           fh_->LoadClass(this, irb_, cls, GetMethodIdx(), false), args);
     } break;
-    case HLoadClass::LoadKind::kJitBootImageAddress:
-      FALLTHROUGH_INTENDED;
-    case HLoadClass::LoadKind::kJitTableAddress:
-      FALLTHROUGH_INTENDED;
     case HLoadClass::LoadKind::kInvalid:
       LOG(FATAL) << "LoadClass: LoadKind: " << load_kind;
       UNREACHABLE();
@@ -845,6 +893,19 @@ void HGraphToLLVM::VisitLoadString(
         }
       }
       break;
+    case HLoadString::LoadKind::kJitBootImageAddress:
+      {
+        // LLVM JIT tier: as kJitBootImageAddress of VisitLoadClass
+        uint32_t address =
+          reinterpret_cast32<uint32_t>(load->GetString().Get());
+        DCHECK_NE(address, 0u);
+        loaded_string = irb_->CreateIntToPtr(irb_->getJUnsignedInt(address),
+            irb_->getVoidPointerType());
+      }
+      break;
+    case HLoadString::LoadKind::kJitTableAddress:
+      // LLVM JIT tier: as kJitTableAddress of VisitLoadClass
+      FALLTHROUGH_INTENDED;
     case HLoadString::LoadKind::kRuntimeCall:
       {
         constexpr bool use_cache=false;
@@ -856,10 +917,6 @@ void HGraphToLLVM::VisitLoadString(
         }
       }
       break;
-    case HLoadString::LoadKind::kJitBootImageAddress:
-    case HLoadString::LoadKind::kJitTableAddress: 
-      LOG(FATAL) << "LoadClass: LoadKind: " << load_kind;
-      UNREACHABLE();
     default:
       break;
   }
@@ -1121,6 +1178,12 @@ void HGraphToLLVM::VisitNullCheck(HNullCheck* h) {
   HInstruction* hreceiver = h->InputAt(0);
   Value* receiver = getValue(hreceiver);
 
+  if (McrDebug::ImplicitChecks()) {
+    GenerateImplicitNullCheck(h, receiver);
+    addValue(h, receiver);
+    return;
+  }
+
   std::vector<Value*> null_check_args;
   Value* dex_pc = irb_->getJUnsignedInt(h->GetDexPc());
   null_check_args.push_back(receiver);
@@ -1244,17 +1307,17 @@ void HGraphToLLVM::VisitCheckCast(HCheckCast* h) {
 
 void HGraphToLLVM::VisitThrow(HThrow* h) {
   D3LOG(INFO) << __func___ << GetTwine(h);
-  // TODO Throw/Exceptions are not supported
-  // There are several problems:
-  // we have to enter the runtime, which should decide whether
-  // an exception can be handled. If it's handled then the code should
-  // be tranfered back to LLVM, and LLVM should silent the exception,
-  // and transfer execution to the appropriate catch block.
+  // Inside a try block, the runtime finds the catch block and execution
+  // continues there (GenerateCatchDispatch). Otherwise, or for a null
+  // exception (NullPointerException), the exception is delivered to the
+  // callers of the method.
   VERIFY_LLVM(GetPrettyMethod());
   Value* lexception = getValue(h->InputAt(0));
+  if (h->GetBlock()->IsTryBlock() && !h->InputAt(0)->IsNullConstant()) {
+    GenerateCatchDispatch(h, lexception);
+    return;
+  }
   ArtCallDeliverException(lexception);
-
-  // exception might be handled
   irb_->CreateUnreachable();
 }
 
@@ -1277,6 +1340,174 @@ void HGraphToLLVM::VisitClearException(HClearException* clear) {
   // __ Str(wzr, GetExceptionTlsAddress());
 }
 
+// Catch blocks are in the outer method: methods with try blocks are not
+// inlined. So the dex pc and the vregs of h are of its outer environment.
+static HEnvironment* GetOuterEnvironment(HInstruction* h) {
+  HEnvironment* env = h->GetEnvironment();
+  while (env != nullptr && env->GetParent() != nullptr) {
+    env = env->GetParent();
+  }
+  return env;
+}
+
+/**
+ * @brief Branches to the catch block of lexception (or of the pending
+ *        exception, when null) that h throws in its try block.
+ *
+ * The runtime finds the handler (ArtMethod::FindCatchBlock), and the switch
+ * goes to its catch block, where HLoadException reads the exception that is
+ * still pending. Without a handler the exception is delivered, as before.
+ * A handler that is not in the HGraph (e.g. removed as dead) delivers it
+ * too.
+ *
+ * Catch phis are not per predecessor in HGraph: each of their inputs is the
+ * vreg at a throwing instruction. Each dispatch adds as an incoming value
+ * the vreg from the environment of h.
+ */
+void HGraphToLLVM::GenerateCatchDispatch(HInstruction* h, Value* lexception) {
+  D3LOG(INFO) << __func__ << ": " << prt_->GetInstruction(h);
+  HEnvironment* env = GetOuterEnvironment(h);
+  const uint32_t dex_pc = env != nullptr ? env->GetDexPc() : h->GetDexPc();
+  if (lexception == nullptr) {
+    lexception = irb_->getJNull();
+  }
+  lexception = irb_->CreateBitCast(lexception, irb_->getVoidPointerType());
+  Value* handler = ArtCallFindCatchBlock(
+      GetLoadedArtMethod(), dex_pc, lexception);
+
+  BasicBlock* dispatch = irb_->GetInsertBlock();
+  BasicBlock* deliver = BasicBlock::Create(
+      *ctx_, "deliver_" + Pretty(dispatch), dispatch->getParent());
+  const ArenaVector<HBasicBlock*>& handlers = h->GetBlock()
+    ->GetTryCatchInformation()->GetTryEntry().GetExceptionHandlers();
+  SwitchInst* sw = irb_->CreateSwitch(handler, deliver, handlers.size());
+
+  for (HBasicBlock* hcatch : handlers) {
+    BasicBlock* lcatch = getBasicBlock(hcatch);
+    sw->addCase(irb_->getJLong(hcatch->GetDexPc() + 1), lcatch);
+    for (HInstructionIterator it(hcatch->GetPhis()); !it.Done(); it.Advance()) {
+      HPhi* hphi = it.Current()->AsPhi();
+      PHINode* lphi = getPhi(hphi);
+      HInstruction* vreg = nullptr;
+      if (env != nullptr && hphi->GetRegNumber() < env->Size()) {
+        vreg = env->GetInstructionAt(hphi->GetRegNumber());
+      }
+      Value* inval = nullptr;
+      if (vreg != nullptr && (vreg->IsPhi() || regs_.count(vreg) != 0)) {
+        inval = getValue(vreg);
+      }
+      if (inval == nullptr || inval->getType() != lphi->getType()) {
+        D2LOG(WARNING) << "Catch phi: no input: " << prt_->GetInstruction(hphi);
+        inval = UndefValue::get(lphi->getType());
+      }
+      lphi->addIncoming(inval, dispatch);
+    }
+  }
+
+  irb_->SetInsertPoint(deliver);
+  Value* thread = GetLoadedThread();
+  ArtCallDeliverException(LoadWord<true>(thread, GetThreadExceptionOffset()));
+  irb_->CreateUnreachable();
+}
+
+/**
+ * @brief Invokes that return with a pending exception (both the invoke
+ *        wrapper and direct quick calls return to LLVM) go to a catch
+ *        dispatch, when they are in a try block.
+ *
+ * The HGraph block is split: the rest of its instructions are in the
+ * continuation block, which is also the predecessor of its successor phis
+ * (GetLastBasicBlock).
+ */
+void HGraphToLLVM::GenerateCatchCheck(HInvoke* invoke) {
+  if (!invoke->GetBlock()->IsTryBlock()) return;
+  D3LOG(INFO) << __func__ << ": " << prt_->GetInstruction(invoke);
+
+  BasicBlock* lblock = getBasicBlock(invoke->GetBlock());
+  BasicBlock* pinsert_point = irb_->GetInsertBlock();
+  Function* F = pinsert_point->getParent();
+  BasicBlock* dispatch = BasicBlock::Create(
+      *ctx_, "catch_" + Pretty(pinsert_point), F);
+  BasicBlock* cont = BasicBlock::Create(
+      *ctx_, "cont_" + Pretty(pinsert_point), F);
+
+  Value* thread = GetLoadedThread();
+  Value* exception = LoadWord<true>(thread, GetThreadExceptionOffset());
+  Value* is_pending = irb_->CreateICmpNE(
+      exception, ConstantPointerNull::get(
+        cast<PointerType>(exception->getType())));
+  irb_->CreateCondBr(is_pending, dispatch, cont,
+                     mdb_->createBranchWeights(1, MAX_BRWEIGHT));
+
+  irb_->SetInsertPoint(dispatch);
+  GenerateCatchDispatch(invoke, nullptr);
+
+  cur_lblock_ = cont;
+  lblock_ends_[lblock] = cont;
+  irb_->SetInsertPoint(cont);
+}
+
+/**
+ * @brief A null check that llc can make implicit (make.implicit): the
+ *        compare is removed, and the first load from the receiver faults
+ *        instead. The null branch is then the handler of that load, in
+ *        .llvm_faultmaps (hf.faults), and the runtime continues there on
+ *        a fault (mcr::LlvmFaultHandler). Otherwise the check stays, as
+ *        a branch that is never taken.
+ *
+ * The null branch throws a NullPointerException, at a catch block when
+ * in a try block. The HGraph block is split like GenerateCatchCheck does.
+ */
+void HGraphToLLVM::GenerateImplicitNullCheck(HNullCheck* h, Value* receiver) {
+  D3LOG(INFO) << __func__ << ": " << prt_->GetInstruction(h);
+  BasicBlock* lblock = getBasicBlock(h->GetBlock());
+  BasicBlock* pinsert_point = irb_->GetInsertBlock();
+  Function* F = pinsert_point->getParent();
+  BasicBlock* npe = BasicBlock::Create(
+      *ctx_, "npe_" + Pretty(pinsert_point), F);
+  BasicBlock* cont = BasicBlock::Create(
+      *ctx_, "cont_" + Pretty(pinsert_point), F);
+
+  Value* is_null = irb_->CreateCmpIsNull(receiver);
+  BranchInst* br = irb_->CreateCondBr(is_null, npe, cont,
+      mdb_->createBranchWeights(1, MAX_BRWEIGHT));
+  br->setMetadata(LLVMContext::MD_make_implicit, MDNode::get(*ctx_, {}));
+
+  irb_->SetInsertPoint(npe);
+  HEnvironment* env = GetOuterEnvironment(h);
+  const uint32_t dex_pc = env != nullptr ? env->GetDexPc() : h->GetDexPc();
+  Value* exception = ArtCallNewNullPointer(GetLoadedArtMethod(), dex_pc);
+  if (h->GetBlock()->IsTryBlock()) {
+    GenerateCatchDispatch(h, exception);
+  } else {
+    ArtCallDeliverException(exception);
+    irb_->CreateUnreachable();
+  }
+
+  cur_lblock_ = cont;
+  lblock_ends_[lblock] = cont;
+  irb_->SetInsertPoint(cont);
+}
+
+/**
+ * @brief Probes the protected region of the stack at the entry of an
+ *        inner method, like the frame entry of quick code does.
+ */
+void HGraphToLLVM::GenerateStackOverflowProbe() {
+  if (!McrDebug::ImplicitChecks()) return;
+  if (irb_->IsCompilingArm64()) {
+    Arm64::StackOverflowProbe(irb_);
+  } else if (irb_->IsCompilingX86_64()) {
+    X86_64::StackOverflowProbe(irb_);
+  }
+}
+
+BasicBlock* HGraphToLLVM::GetLastBasicBlock(HBasicBlock* hblock) {
+  BasicBlock* lblock = getBasicBlock(hblock);
+  auto it = lblock_ends_.find(lblock);
+  return it == lblock_ends_.end() ? lblock : it->second;
+}
+
 
 /**
  * @brief 
@@ -1304,7 +1535,8 @@ void HGraphToLLVM::VisitNewInstance(HNewInstance* h) {
     case QuickEntrypointEnum::kQuickAllocObjectInitialized:
     case QuickEntrypointEnum::kQuickAllocObjectWithChecks:
     case QuickEntrypointEnum::kQuickAllocObjectResolved: {
-      newobj = ArtCallAllocObject__(qpoint, loaded_class);
+      newobj = irb_->CreateCall(
+          fh_->AllocObject(this, irb_, qpoint), {loaded_class});
       if (McrDebug::VerifyArtObject()) {
         ArtCallVerifyArtObject(newobj);
       }
@@ -1327,7 +1559,8 @@ void HGraphToLLVM::VisitNewArray(HNewArray* h) {
   Value* loaded_class = getValue(h->GetLoadClass());
   Value* length = getValue(h->GetLength());
   
-  Value* newarray = ArtCallAllocArray__(qpoint, loaded_class, length);
+  Value* newarray = irb_->CreateCall(
+      fh_->AllocArray(this, irb_, qpoint), {loaded_class, length});
   newarray->setName("newArray");
 
   addValue(h, newarray);
@@ -1335,7 +1568,11 @@ void HGraphToLLVM::VisitNewArray(HNewArray* h) {
 
 void HGraphToLLVM::VisitConstructorFence(HConstructorFence* h) {
   VERIFIED_;
-  Arm64::GenerateMemoryBarrier(irb_, MemBarrierKind::kStoreStore);
+  if (irb_->IsCompilingX86_64()) {
+    X86_64::GenerateMemoryBarrier(irb_, MemBarrierKind::kStoreStore);
+  } else {
+    Arm64::GenerateMemoryBarrier(irb_, MemBarrierKind::kStoreStore);
+  }
 }
 
 void HGraphToLLVM::VisitBoundType(HBoundType* h) {
@@ -1353,6 +1590,9 @@ void HGraphToLLVM::VisitMemoryBarrier(HMemoryBarrier* h) {
       ArmThumb::GenerateMemoryBarrier(irb_, h->GetBarrierKind());
       // INFO_LLVM arm64 should be the same with Thumb
     } break;
+    case InstructionSet::kX86_64:
+      X86_64::GenerateMemoryBarrier(irb_, h->GetBarrierKind());
+      break;
     default:
       DIE_TODO << "VisitMemoryBarrier: Unimplemented for architecture: " << isa;
   }
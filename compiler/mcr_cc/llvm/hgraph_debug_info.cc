@@ -0,0 +1,150 @@
+/**
+ * Debug locations of LLVM code: with opt.line_table each instruction that
+ * an HInstruction generates is located at its dex_pc (line: dex_pc + 1),
+ * in the subprogram of its dex method. Code that the ART inliner inlined
+ * gets the inlinedAt chain of its environment.
+ * llc emits them as the .debug_line of hf.so (see LineTable).
+ *
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "hgraph_to_llvm.h"
+
+#include <llvm/IR/DIBuilder.h>
+#include <llvm/IR/DebugInfoMetadata.h>
+#include "art_method-inl.h"
+#include "hgraph_to_llvm-inl.h"
+#include "ir_builder.h"
+#include "optimizing/nodes.h"
+
+#include "llvm_macros_irb_.h"
+
+using namespace ::llvm;
+namespace art {
+namespace LLVM {
+
+static uint32_t GetDebugLine(uint32_t dex_pc) {
+  return dex_pc == dex::kDexNoIndex ? 0 : dex_pc + 1;
+}
+
+/**
+ * @brief A compile unit for the dex file of the method, and the
+ *        subprogram of the inner method.
+ */
+void HGraphToLLVM::CreateDebugInfo() {
+  if (!McrDebug::LineTable()) return;
+  if (mod_->getModuleFlag("Debug Info Version") == nullptr) {
+    mod_->addModuleFlag(Module::Warning, "Debug Info Version",
+                        DEBUG_METADATA_VERSION);
+    mod_->addModuleFlag(Module::Warning, "Dwarf Version", 4);
+  }
+
+  dib_.reset(new DIBuilder(*mod_));
+  const std::string dex_location = GetGraph()->GetDexFile().GetLocation();
+  DIFile* file = dib_->createFile(
+      dex_location.substr(dex_location.find_last_of('/') + 1),
+      dex_location.substr(0, dex_location.find_last_of('/') + 1));
+  di_unit_ = dib_->createCompileUnit(dwarf::DW_LANG_Java, file, "mcr_cc",
+      true, "", 0, "", DICompileUnit::LineTablesOnly);
+  di_inner_ = CreateDebugSubprogram(GetPrettyMethod());
+  inner_func_->setSubprogram(di_inner_);
+}
+
+DISubprogram* HGraphToLLVM::CreateDebugSubprogram(std::string pretty_method) {
+  return dib_->createFunction(di_unit_, pretty_method, "", di_unit_->getFile(),
+      0, dib_->createSubroutineType(dib_->getOrCreateTypeArray({})), 0,
+      DINode::FlagZero, DISubprogram::SPFlagDefinition);
+}
+
+/**
+ * @brief The subprogram of a method that the ART inliner inlined.
+ */
+DISubprogram* HGraphToLLVM::GetDebugSubprogram(ArtMethod* method) {
+  if (method == nullptr) return di_inner_;
+  auto it = di_methods_.find(method);
+  if (it != di_methods_.end()) return it->second;
+  DISubprogram* sp = CreateDebugSubprogram(method->PrettyMethod());
+  di_methods_.emplace(method, sp);
+  return sp;
+}
+
+/**
+ * @brief New blocks start at the inner method. The inlined blocks take the
+ *        scope of their first instruction with an environment.
+ */
+void HGraphToLLVM::ResetDebugLocation() {
+  if (dib_ == nullptr) return;
+  debug_loc_ = DILocation::get(*ctx_, 0, 0, di_inner_);
+  irb_->SetCurrentDebugLocation(DebugLoc(debug_loc_));
+}
+
+/**
+ * @brief Locates the code of h at its dex_pc. With an environment, the
+ *        scope is the innermost method, inlined at the dex_pc of each
+ *        of its callers (the parent environments).
+ *        Otherwise it keeps the scope of the previous instruction.
+ */
+void HGraphToLLVM::SetDebugLocation(HInstruction* h) {
+  if (dib_ == nullptr) return;
+  if (h->HasEnvironment()) {
+    std::vector<HEnvironment*> envs;
+    for (HEnvironment* env = h->GetEnvironment(); env != nullptr;
+         env = env->GetParent()) {
+      envs.push_back(env);
+    }
+    DILocation* inlined_at = nullptr;
+    for (auto it = envs.rbegin(); it != envs.rend(); it++) {
+      HEnvironment* env = *it;
+      DISubprogram* sp = env->GetParent() == nullptr ?
+        di_inner_ : GetDebugSubprogram(env->GetMethod());
+      inlined_at = DILocation::get(
+          *ctx_, GetDebugLine(env->GetDexPc()), 0, sp, inlined_at);
+    }
+    debug_loc_ = inlined_at;
+  } else {
+    debug_loc_ = DILocation::get(*ctx_, GetDebugLine(h->GetDexPc()), 0,
+                                 debug_loc_->getScope(),
+                                 debug_loc_->getInlinedAt());
+  }
+  irb_->SetCurrentDebugLocation(DebugLoc(debug_loc_));
+}
+
+void HGraphToLLVM::VisitBasicBlockWithDebugLocations(HBasicBlock* hblock) {
+  for (HInstructionIterator it(hblock->GetPhis()); !it.Done(); it.Advance()) {
+    it.Current()->Accept(this);
+  }
+  for (HInstructionIterator it(hblock->GetInstructions());
+       !it.Done(); it.Advance()) {
+    SetDebugLocation(it.Current());
+    it.Current()->Accept(this);
+  }
+}
+
+/**
+ * @brief The rest of the code (InitInners, helpers) has no locations.
+ *        LlvmPipeline::CompleteDebugInfo gives them one after linking.
+ */
+void HGraphToLLVM::FinalizeDebugInfo() {
+  if (dib_ == nullptr) return;
+  irb_->SetCurrentDebugLocation(DebugLoc());
+  dib_->finalize();
+  D3LOG(INFO) << __func__ << ": " << di_methods_.size()
+    << " inlined methods: " << GetPrettyMethod();
+}
+
+#include "llvm_macros_undef.h"
+
+}  // namespace LLVM
+}  // namespace art
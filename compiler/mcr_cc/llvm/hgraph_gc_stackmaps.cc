@@ -0,0 +1,155 @@
+/**
+ * GC stack maps of LLVM frames: the calls that an HInstruction generates get
+ * a "deopt" bundle with the references that are live in its environment.
+ * RewriteStatepointsForGC (LlvmPipeline) turns them into statepoints, and
+ * llc records the stack slots of those references in .llvm_stackmaps.
+ *
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "hgraph_to_llvm.h"
+
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/IntrinsicInst.h>
+#include <set>
+#include "hgraph_to_llvm-inl.h"
+#include "ir_builder.h"
+#include "optimizing/nodes.h"
+
+#include "llvm_macros_irb_.h"
+
+using namespace ::llvm;
+namespace art {
+namespace LLVM {
+
+/**
+ * @brief Same instructions with HGraphVisitor::VisitBasicBlock, but it
+ *        records the calls that each instruction creates in the function,
+ *        and adds to them the live references of the instruction.
+ */
+void HGraphToLLVM::VisitBasicBlockWithStackMaps(HBasicBlock* hblock) {
+  for (HInstructionIterator it(hblock->GetPhis()); !it.Done(); it.Advance()) {
+    it.Current()->Accept(this);
+  }
+
+  std::vector<CallInst*> calls;
+  for (HInstructionIterator it(hblock->GetInstructions());
+       !it.Done(); it.Advance()) {
+    HInstruction* h = it.Current();
+    SetDebugLocation(h);
+    if (!h->HasEnvironment()) {
+      h->Accept(this);
+      continue;
+    }
+
+    std::vector<Value*> refs = GetLiveReferences(h);
+    Function* F = irb_->GetInsertBlock()->getParent();
+    calls.clear();
+    irb_->RecordCalls(F, &calls);
+    h->Accept(this);
+    irb_->RecordCalls(nullptr, nullptr);
+    if (!refs.empty()) AddStackMaps(h, refs, calls);
+  }
+}
+
+/**
+ * @brief The references of the environment of h (and of the environments
+ *        it was inlined in), i.e., those that live across h.
+ *        Constants (null) are not roots, and values that are not generated
+ *        yet (back edges) are not live at h.
+ */
+std::vector<Value*> HGraphToLLVM::GetLiveReferences(HInstruction* h) {
+  std::vector<Value*> refs;
+  std::set<Value*> seen;
+  for (HEnvironment* env = h->GetEnvironment(); env != nullptr;
+       env = env->GetParent()) {
+    for (size_t i = 0; i < env->Size(); i++) {
+      HInstruction* vreg = env->GetInstructionAt(i);
+      if (vreg == nullptr || vreg == h) continue;
+      if (vreg->GetType() != DataType::Type::kReference) continue;
+      if (vreg->IsConstant()) continue;
+
+      Value* value = nullptr;
+      if (vreg->IsPhi()) {
+        auto phi = phis_.find(vreg->AsPhi());
+        if (phi != phis_.end()) value = phi->second;
+      } else {
+        auto reg = regs_.find(vreg);
+        if (reg != regs_.end()) value = reg->second;
+      }
+      if (value == nullptr || isa<Constant>(value)) continue;
+      if (!value->getType()->isPointerTy()) continue;
+      if (seen.insert(value).second) refs.push_back(value);
+    }
+  }
+  return refs;
+}
+
+// Values that are defined in the entry block after a call (it can be a
+// hoisted load, like GetLoadedThread) are not available to it.
+static bool IsAvailableAt(Value* value, CallInst* call) {
+  Instruction* def = dyn_cast<Instruction>(value);
+  if (def == nullptr) return true;  // arguments
+  BasicBlock* entry = &call->getFunction()->getEntryBlock();
+  if (call->getParent() != entry) return true;
+  if (def->getParent() != entry) return false;
+  for (Instruction& I : *entry) {
+    if (&I == def) return true;
+    if (&I == call) return false;
+  }
+  return false;
+}
+
+/**
+ * @brief Re-creates each call of h with a deopt bundle of the live
+ *        references, and a statepoint-id of the dex pc (kept in the
+ *        stack maps, for debugging).
+ *
+ * Intrinsics and inline asm never reach a safepoint, so they are left as is.
+ */
+void HGraphToLLVM::AddStackMaps(HInstruction* h,
+                                const std::vector<Value*>& refs,
+                                const std::vector<CallInst*>& calls) {
+  const std::string statepoint_id = std::to_string(h->GetDexPc());
+  for (CallInst* call : calls) {
+    if (isa<IntrinsicInst>(call) || call->isInlineAsm()) continue;
+    if (call->getNumOperandBundles() != 0) continue;
+
+    std::vector<Value*> live;
+    for (Value* ref : refs) {
+      if (IsAvailableAt(ref, call)) live.push_back(ref);
+    }
+    if (live.empty()) continue;
+
+    OperandBundleDef deopt("deopt", live);
+    CallInst* safepoint = CallInst::Create(call, {deopt}, call);
+    safepoint->addAttribute(AttributeList::FunctionIndex,
+                            Attribute::get(*ctx_, "statepoint-id",
+                                           statepoint_id));
+    safepoint->copyMetadata(*call);
+    safepoint->takeName(call);
+    call->replaceAllUsesWith(safepoint);
+    auto reg = regs_.find(h);
+    if (reg != regs_.end() && reg->second == call) reg->second = safepoint;
+    call->eraseFromParent();
+    D4LOG(INFO) << "GcStackMaps: " << live.size() << " refs: "
+                << prt_->GetInstruction(h);
+  }
+}
+
+#include "llvm_macros_undef.h"
+
+}  // namespace LLVM
+}  // namespace art
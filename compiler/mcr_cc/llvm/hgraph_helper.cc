@@ -22,6 +22,7 @@
 #include <llvm/IR/CFG.h>
 #include "art_method-inl.h"
 #include "asm_arm_thumb.h"
+#include "asm_x86_64.h"
 #include "base/mutex-inl.h"
 #include "base/mutex.h"
 #include "dex/dex_file_loader.h"
@@ -38,6 +39,7 @@
 #include "optimizing/data_type.h"
 #include "optimizing/nodes.h"
 #include "optimizing/intrinsics.h"
+#include "region_inliner.h"
 #include "thread.h"
 
 using namespace ::llvm;
@@ -271,7 +273,11 @@ Value* HGraphToLLVM::GetShiftOperation(
     if(h->GetRight()->IsConstant()) {
       uint64_t imm2= h->GetConstantRight()->GetValueAsUint64() &
       ((DataType::Size(h->GetLeft()->GetType())*8) - 1);
-      shifted_val=Arm64::__Ror(irb_, lhs, imm2, i32);
+      shifted_val = irb_->IsCompilingX86_64() ?
+        X86_64::Ror(irb_, lhs, irb_->getJLong(imm2), i32) :
+        Arm64::__Ror(irb_, lhs, imm2, i32);
+    } else if (irb_->IsCompilingX86_64()) {
+      shifted_val=X86_64::Ror(irb_, lhs, rhs, i32);
     } else {
       shifted_val=Arm64::__Ror(irb_, lhs, rhs, i32);
     }
@@ -333,7 +339,9 @@ void HGraphToLLVM::HandleFieldGet(HInstruction* h) {
         // Note that a potential implicit null check is handled in this LoadAcquire call.
         // NB: LoadAcquire will record the pc info if needed.
         // codegen_->LoadAcquire instruction,
-        loaded=Arm64::LoadAcquire(irb_, h, load_type, lobj, loffset, false);
+        loaded = irb_->IsCompilingX86_64() ?
+          X86_64::LoadAcquire(irb_, load_type, lobj, loffset) :
+          Arm64::LoadAcquire(irb_, h, load_type, lobj, loffset, false);
       } else {
         // codegen_->Load(load_type, OutputCPURegister(instruction), field);
         loaded= _LoadForFieldGet(h, lobj, loffset, is_volatile); 
@@ -401,11 +409,15 @@ void HGraphToLLVM::HandleFieldSet(HInstruction* h) {
     // Value* dst = Arm64::wLdr(irb_, lobj, offset);  // ??
     // or pull from a w register the obj + offset
     // use directly the lset_val...
-    Arm64::StoreRelease(irb_, h, field_type,
-        casted_set_val, // src
-        lobj, // base
-        loffset, // offset
-        true);
+    if (irb_->IsCompilingX86_64()) {
+      X86_64::StoreRelease(irb_, field_type, casted_set_val, lobj, loffset);
+    } else {
+      Arm64::StoreRelease(irb_, h, field_type,
+          casted_set_val, // src
+          lobj, // base
+          loffset, // offset
+          true);
+    }
   } else {
     // codegen_->Store(field_type, source, HeapOperand(obj, offset));
     Arm64::MaybeRecordImplicitNullCheck(h);
@@ -433,7 +445,9 @@ void HGraphToLLVM::HandleGotoMethod(HInstruction* got, HBasicBlock* successor) {
     HLoopInformation* info = block->GetLoopInformation();
     if (info != nullptr && info->IsBackEdge(*block) &&
         info->HasSuspendCheck()) {
-      GenerateSuspendCheckMethod(info->GetSuspendCheck(), successor);
+      if (!GeneratePlannedSuspendCheck(block)) {
+        GenerateSuspendCheckMethod(info->GetSuspendCheck(), successor);
+      }
       // return;
     }
     else if (block->IsEntryBlock() && (previous != nullptr) &&
@@ -704,7 +718,8 @@ void HGraphToLLVM::HandleInvoke(HInvoke* hinvoke) {
               GetGraph()->GetDexFile().GetLocation().c_str(),
               dex_base, dex_loc);
           mcr::InvokeInfo::AddToCache(info);
-          mcr::Analyser::histogram_additions_.insert(art_method->PrettyMethod());
+          mcr::Analyser::AddHistogramAddition(
+              GetPrettyMethod(), art_method->PrettyMethod());
         }
       }
     }
@@ -961,12 +976,16 @@ Value* HGraphToLLVM::CallMethod(
         is_hot, is_native, is_abstract, signature,
         dex_filename, dex_location, framework_method);
   }
+  uint64_t call_count = 0;
+  if (llvm_to_llvm && McrDebug::RegionInline()) {
+    call_count = GetCallCount(hinvoke);
+  }
   Locks::mutator_lock_->SharedUnlock(self);
 
   // if it's hot, regardless whether it will be called directly,
   // we have to add it as a dependency to include it's code
   if (is_hot) {
-    mcr::LinkerInterface::AddDependency(GetPrettyMethod(), spec_method_name);
+    AddLinkDependency(spec_method_name);
   }
 
   Value* call_result = nullptr;
@@ -982,6 +1001,10 @@ Value* HGraphToLLVM::CallMethod(
           callee_uniq_name, calleeFTy).getCallee());
 
     call_result = irb_->CreateCall(calleeF, callee_args);
+    if (call_count > 0) {
+      RegionInliner::AnnotateCall(cast<CallInst>(call_result), call_count,
+          hinvoke->GetDexPc());
+    }
 
     if(hinvoke->IsInvokeStaticOrDirect() &&
         hinvoke->AsInvokeStaticOrDirect()->IsRecursive()) {
@@ -1085,7 +1108,11 @@ void HGraphToLLVM::MaybeGenerateMarkingRegisterCheck(int code) {
     // The following condition is a run-time one; it is executed after the
     // previous compile-time test, to avoid penalizing non-debug builds.
     if (GetCompilerOptions().EmitRunTimeChecksInDebugMode()) {
-      Arm64::GenerateMarkingRegisterCheck(irb_, code);
+      if (irb_->IsCompilingX86_64()) {
+        X86_64::GenerateMarkingRegisterCheck(irb_, code);
+      } else {
+        Arm64::GenerateMarkingRegisterCheck(irb_, code);
+      }
     }
   }
 }
@@ -1110,7 +1137,9 @@ Value* HGraphToLLVM::GenIsInfinite(Value* input, bool is64bit) {
   // MoveFPToInt(locations, is64bit, masm);
   // INFO: this does not work, so we rely to inline asm
   // Value* fpToSI= irb_->CreateFPToSI(input, ty);
-  Value* fpToSI=Arm64::__Fmov(irb_, input, !is64bit);
+  Value* fpToSI = irb_->IsCompilingX86_64() ?
+    X86_64::MoveFPToInt(irb_, input, !is64bit) :
+    Arm64::__Fmov(irb_, input, !is64bit);
 
   // __ Eor(out, out, infinity);
   Value *eor=irb_->CreateXor(fpToSI, linfinity);
@@ -64,7 +64,9 @@ Value* HGraphToLLVM::GenUnsafeGet(HInvoke* invoke,
     // MemOperand mem_op(base.X(), offset);
     if (is_volatile) {
       VERIFY_LLVM("LoadAcquire");
-      loaded=Arm64::LoadAcquire(irb_, invoke, type, lbase, loffset, false);
+      loaded = irb_->IsCompilingX86_64() ?
+        X86_64::LoadAcquire(irb_, type, lbase, loffset) :
+        Arm64::LoadAcquire(irb_, invoke, type, lbase, loffset, false);
     } else {
       if(i64) {
         loaded=Load<false, false>(lbase, loffset);
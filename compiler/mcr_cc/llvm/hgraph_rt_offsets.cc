@@ -38,6 +38,9 @@ uint32_t HGraphToLLVM::GetArtMethodEntryPointFromJniOffset() {
     case InstructionSet::kArm64:
       return ArtMethod::EntryPointFromJniOffset(
           kArm64PointerSize).Int32Value();
+    case InstructionSet::kX86_64:
+      return ArtMethod::EntryPointFromJniOffset(
+          kX86_64PointerSize).Int32Value();
     case InstructionSet::kArm:
     case InstructionSet::kThumb2:
       return ArtMethod::EntryPointFromJniOffset(
@@ -52,6 +55,8 @@ uint32_t HGraphToLLVM::GetThreadTopShadowFrameOffset() {
   switch (isa) {
     case InstructionSet::kArm64:
       return Thread::TopShadowFrameOffset<kArm64PointerSize>().Int32Value();
+    case InstructionSet::kX86_64:
+      return Thread::TopShadowFrameOffset<kX86_64PointerSize>().Int32Value();
     case InstructionSet::kArm:
     case InstructionSet::kThumb2:
       return Thread::TopShadowFrameOffset<kArmPointerSize>().Int32Value();
@@ -65,6 +70,8 @@ uint32_t HGraphToLLVM::GetThreadTopOfManagedStackOffset() {
   switch (isa) {
     case InstructionSet::kArm64:
       return Thread::TopOfManagedStackOffset<kArm64PointerSize>().Int32Value();
+    case InstructionSet::kX86_64:
+      return Thread::TopOfManagedStackOffset<kX86_64PointerSize>().Int32Value();
     case InstructionSet::kArm:
     case InstructionSet::kThumb2:
       return Thread::TopOfManagedStackOffset<kArmPointerSize>().Int32Value();
@@ -78,6 +85,8 @@ uint32_t HGraphToLLVM::GetThreadExceptionOffset() {
   switch (isa) {
     case InstructionSet::kArm64:
       return Thread::ExceptionOffset<kArm64PointerSize>().SizeValue();
+    case InstructionSet::kX86_64:
+      return Thread::ExceptionOffset<kX86_64PointerSize>().SizeValue();
     case InstructionSet::kArm:
     case InstructionSet::kThumb2:
       return Thread::ExceptionOffset<kArmPointerSize>().SizeValue();
@@ -91,6 +100,8 @@ uint32_t HGraphToLLVM::GetThreadFlagsOffset() {
   switch (isa) {
     case InstructionSet::kArm64:
       return Thread::ThreadFlagsOffset<kArm64PointerSize>().SizeValue();
+    case InstructionSet::kX86_64:
+      return Thread::ThreadFlagsOffset<kX86_64PointerSize>().SizeValue();
     case InstructionSet::kArm:
     case InstructionSet::kThumb2:
       return Thread::ThreadFlagsOffset<kArmPointerSize>().SizeValue();
@@ -104,6 +115,8 @@ uint32_t HGraphToLLVM::GetThreadJNIEnvOffset() {
   switch (isa) {
     case InstructionSet::kArm64:
       return Thread::JniEnvOffset<kArm64PointerSize>().Int32Value();
+    case InstructionSet::kX86_64:
+      return Thread::JniEnvOffset<kX86_64PointerSize>().Int32Value();
     case InstructionSet::kArm:
     case InstructionSet::kThumb2:
       return Thread::JniEnvOffset<kArmPointerSize>().Int32Value();
@@ -112,6 +125,96 @@ uint32_t HGraphToLLVM::GetThreadJNIEnvOffset() {
   }
 }
 
+uint32_t HGraphToLLVM::GetThreadLocalPosOffset() {
+  InstructionSet isa(GetISA());
+  switch (isa) {
+    case InstructionSet::kArm64:
+      return Thread::ThreadLocalPosOffset<kArm64PointerSize>().Int32Value();
+    case InstructionSet::kX86_64:
+      return Thread::ThreadLocalPosOffset<kX86_64PointerSize>().Int32Value();
+    case InstructionSet::kArm:
+    case InstructionSet::kThumb2:
+      return Thread::ThreadLocalPosOffset<kArmPointerSize>().Int32Value();
+    default:
+      DIE_UNIMPLEMENTED_ARCH(isa);
+  }
+}
+
+uint32_t HGraphToLLVM::GetThreadLocalEndOffset() {
+  InstructionSet isa(GetISA());
+  switch (isa) {
+    case InstructionSet::kArm64:
+      return Thread::ThreadLocalEndOffset<kArm64PointerSize>().Int32Value();
+    case InstructionSet::kX86_64:
+      return Thread::ThreadLocalEndOffset<kX86_64PointerSize>().Int32Value();
+    case InstructionSet::kArm:
+    case InstructionSet::kThumb2:
+      return Thread::ThreadLocalEndOffset<kArmPointerSize>().Int32Value();
+    default:
+      DIE_UNIMPLEMENTED_ARCH(isa);
+  }
+}
+
+uint32_t HGraphToLLVM::GetThreadLocalObjectsOffset() {
+  InstructionSet isa(GetISA());
+  switch (isa) {
+    case InstructionSet::kArm64:
+      return Thread::ThreadLocalObjectsOffset<kArm64PointerSize>().Int32Value();
+    case InstructionSet::kX86_64:
+      return Thread::ThreadLocalObjectsOffset<kX86_64PointerSize>().Int32Value();
+    case InstructionSet::kArm:
+    case InstructionSet::kThumb2:
+      return Thread::ThreadLocalObjectsOffset<kArmPointerSize>().Int32Value();
+    default:
+      DIE_UNIMPLEMENTED_ARCH(isa);
+  }
+}
+
+uint32_t HGraphToLLVM::GetThreadThinLockIdOffset() {
+  InstructionSet isa(GetISA());
+  switch (isa) {
+    case InstructionSet::kArm64:
+      return Thread::ThinLockIdOffset<kArm64PointerSize>().Int32Value();
+    case InstructionSet::kX86_64:
+      return Thread::ThinLockIdOffset<kX86_64PointerSize>().Int32Value();
+    case InstructionSet::kArm:
+    case InstructionSet::kThumb2:
+      return Thread::ThinLockIdOffset<kArmPointerSize>().Int32Value();
+    default:
+      DIE_UNIMPLEMENTED_ARCH(isa);
+  }
+}
+
+uint32_t HGraphToLLVM::GetThreadLlvmCalledQuickOffset() {
+  InstructionSet isa(GetISA());
+  switch (isa) {
+    case InstructionSet::kArm64:
+      return Thread::LlvmCalledQuickOffset<kArm64PointerSize>().Int32Value();
+    case InstructionSet::kX86_64:
+      return Thread::LlvmCalledQuickOffset<kX86_64PointerSize>().Int32Value();
+    case InstructionSet::kArm:
+    case InstructionSet::kThumb2:
+      return Thread::LlvmCalledQuickOffset<kArmPointerSize>().Int32Value();
+    default:
+      DIE_UNIMPLEMENTED_ARCH(isa);
+  }
+}
+
+uint32_t HGraphToLLVM::GetThreadLlvmAllocFastPathOffset() {
+  InstructionSet isa(GetISA());
+  switch (isa) {
+    case InstructionSet::kArm64:
+      return Thread::LlvmAllocFastPathOffset<kArm64PointerSize>().Int32Value();
+    case InstructionSet::kX86_64:
+      return Thread::LlvmAllocFastPathOffset<kX86_64PointerSize>().Int32Value();
+    case InstructionSet::kArm:
+    case InstructionSet::kThumb2:
+      return Thread::LlvmAllocFastPathOffset<kArmPointerSize>().Int32Value();
+    default:
+      DIE_UNIMPLEMENTED_ARCH(isa);
+  }
+}
+
 static uint32_t GetBootImageOffsetImpl(const void* object, ImageHeader::ImageSections section) {
   Runtime* runtime = Runtime::Current();
   DCHECK(runtime->IsAotCompiler());
@@ -0,0 +1,164 @@
+/**
+ * Safepoints of LLVM loops: with opt.safepoints the suspend check of each
+ * innermost loop is placed by its trip count (induction analysis), instead
+ * of calling SuspendCheck on every back edge:
+ * - kElide: short counted loops have none.
+ * - kHoist: counted loops within a loop with a suspend check rely on it.
+ * - kCounter: other loops poll every kSuspendPollInterval iterations.
+ * Outer loops keep their check, so the pause latency stays bounded.
+ *
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "hgraph_to_llvm.h"
+
+#include "function_helper.h"
+#include "hgraph_to_llvm-inl.h"
+#include "ir_builder.h"
+#include "optimizing/induction_var_analysis.h"
+#include "optimizing/induction_var_range.h"
+#include "optimizing/nodes.h"
+
+#include "llvm_macros_irb_.h"
+
+using namespace ::llvm;
+namespace art {
+namespace LLVM {
+
+// max trip count of loops without a suspend check
+static constexpr int64_t kElideMaxTripCount = 16;
+// max trip count of loops that rely on the check of their outer loop
+static constexpr int64_t kHoistMaxTripCount = 1024;
+// iterations between the polls of kCounter loops
+static constexpr int32_t kSuspendPollInterval = 64;
+
+static bool IsInnermostLoop(HLoopInformation* loop) {
+  for (HBlocksInLoopIterator it(*loop); !it.Done(); it.Advance()) {
+    if (it.Current()->GetLoopInformation() != loop) return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Picks the policy of each innermost loop with a suspend check.
+ *        The counters of kCounter loops are allocas of the entry block
+ *        (mem2reg promotes them), so it runs before any HGraph block.
+ */
+void HGraphToLLVM::PlanSuspendChecks() {
+  if (!McrDebug::Safepoints() || !GetGraph()->HasLoops()) return;
+
+  HInductionVarAnalysis induction(GetGraph());
+  induction.Run();
+  InductionVarRange range(&induction);
+
+  for (HBasicBlock* hblock : GetGraph()->GetReversePostOrder()) {
+    if (!hblock->IsLoopHeader()) continue;
+    HLoopInformation* loop = hblock->GetLoopInformation();
+    if (!loop->HasSuspendCheck() || loop->IsIrreducible() ||
+        !IsInnermostLoop(loop)) {
+      continue;
+    }
+
+    SuspendCheckPolicy policy = SuspendCheckPolicy::kCounter;
+    HLoopInformation* outer = loop->GetPreHeader()->GetLoopInformation();
+    int64_t trip_count = 0;
+    if (range.HasKnownTripCount(loop, &trip_count)) {
+      if (trip_count <= kElideMaxTripCount) {
+        policy = SuspendCheckPolicy::kElide;
+      } else if (trip_count <= kHoistMaxTripCount && outer != nullptr &&
+                 outer->HasSuspendCheck()) {
+        policy = SuspendCheckPolicy::kHoist;
+      }
+    }
+
+    if (policy == SuspendCheckPolicy::kCounter) {
+      AllocaInst* counter =
+        irb_->CreateAlloca(irb_->getJIntTy(), nullptr, "suspend_counter");
+      irb_->CreateStore(irb_->getJInt(kSuspendPollInterval), counter);
+      suspend_counters_.emplace(loop, counter);
+    }
+    suspend_policies_.emplace(loop, policy);
+    D3LOG(INFO) << __func__ << ": loop: " << hblock->GetBlockId()
+      << ": trip count: " << trip_count
+      << ": policy: " << static_cast<int>(policy);
+  }
+}
+
+SuspendCheckPolicy HGraphToLLVM::GetSuspendCheckPolicy(
+    HLoopInformation* loop) {
+  auto it = suspend_policies_.find(loop);
+  return it == suspend_policies_.end() ? SuspendCheckPolicy::kDefault
+                                       : it->second;
+}
+
+/**
+ * @brief The suspend check of the back edge of a planned loop.
+ *        Returns false for the default check (HandleGotoMethod).
+ */
+bool HGraphToLLVM::GeneratePlannedSuspendCheck(HBasicBlock* back_edge) {
+  if (McrDebug::SkipSuspendCheck()) return false;
+  HLoopInformation* loop = back_edge->GetLoopInformation();
+  switch (GetSuspendCheckPolicy(loop)) {
+    case SuspendCheckPolicy::kDefault:
+      return false;
+    case SuspendCheckPolicy::kElide:
+    case SuspendCheckPolicy::kHoist:
+      D4LOG(INFO) << __func__ << ": no suspend check: "
+        << prt_->GetBasicBlock(back_edge);
+      return true;
+    case SuspendCheckPolicy::kCounter:
+      GenerateSuspendCheckPoll(back_edge, suspend_counters_[loop]);
+      return true;
+  }
+  return false;
+}
+
+/**
+ * @brief Decrements the counter of the loop, and when it reaches zero it
+ *        resets it and calls SuspendCheck.
+ *
+ * The back edge is split like GenerateCatchCheck does: the goto to the
+ * header is in the continuation block (GetLastBasicBlock).
+ */
+void HGraphToLLVM::GenerateSuspendCheckPoll(HBasicBlock* back_edge,
+                                            AllocaInst* counter) {
+  BasicBlock* pinsert_point = irb_->GetInsertBlock();
+  Function* F = pinsert_point->getParent();
+  BasicBlock* poll = BasicBlock::Create(
+      *ctx_, "poll_" + Pretty(pinsert_point), F);
+  BasicBlock* cont = BasicBlock::Create(
+      *ctx_, "cont_" + Pretty(pinsert_point), F);
+
+  Value* count = irb_->CreateSub(irb_->CreateLoad(counter), irb_->getJInt(1));
+  irb_->CreateStore(count, counter);
+  Value* is_zero = irb_->CreateICmpEQ(count, irb_->getJInt(0));
+  irb_->CreateCondBr(is_zero, poll, cont,
+      mdb_->createBranchWeights(1, kSuspendPollInterval - 1));
+
+  irb_->SetInsertPoint(poll);
+  irb_->CreateStore(irb_->getJInt(kSuspendPollInterval), counter);
+  irb_->CreateCall(
+      fh_->SuspendCheckASM(this, irb_, llcu_->GetInstructionSet(), nullptr));
+  irb_->CreateBr(cont);
+
+  cur_lblock_ = cont;
+  lblock_ends_[getBasicBlock(back_edge)] = cont;
+  irb_->SetInsertPoint(cont);
+}
+
+#include "llvm_macros_undef.h"
+
+}  // namespace LLVM
+}  // namespace art
@@ -25,6 +25,7 @@
 #include "art_method.h"
 #include "asm_arm64.h"
 #include "asm_arm_thumb.h"
+#include "asm_x86_64.h"
 #include "class_linker-inl.h"
 #include "llvm_utils.h"
 #include "mcr_cc/analyser.h"
@@ -485,6 +486,9 @@ inline Value* HGraphToLLVM::GetQuickEntrypoint(QuickEntrypointEnum qpoint) {
     case InstructionSet::kArm64:
         offset = Arm64::offset(qpoint);
         break;
+    case InstructionSet::kX86_64:
+        offset = X86_64::offset(qpoint);
+        break;
     default:
       DLOG(FATAL) << "Unimplemented for architecture: " << isa;
       UNREACHABLE();
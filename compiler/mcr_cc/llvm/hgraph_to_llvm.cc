@@ -37,6 +37,7 @@
 #include "art_method.h"
 #include "asm_arm_thumb.h"
 #include "asm_arm64.h"
+#include "asm_x86_64.h"
 #include "dex/dex_file_loader.h"
 #include "llvm_utils.h"
 #include "mcr_cc/analyser.h"
@@ -88,6 +89,8 @@ void HGraphToLLVM::ExpandIR() {
     // work too)
     InitializeInitInnerMethods(!framework_method, method_ref);
     PopulateInnerMethod();
+    FinalizeDebugInfo();
+    FinalizeBranchProfile();
     FinalizeInitInnerMethods();
   }
 }
@@ -106,16 +109,24 @@ void HGraphToLLVM::DefineInnerMethod() {
 
   bool is_static = dcu_.IsStatic();
   std::string name = GetInnerMethodName(is_static, GetInnerSignature());
-  inner_func_ =
-      Function::Create(
-          inner_func_type,
-          Function::ExternalLinkage,
-          name,
-          mod_);
+  inner_func_ = GetOrCreateFunction(inner_func_type, name);
   inner_func_->addFnAttr(Attribute::AlwaysInline);
   inner_func_->setDSOLocal(true);
 }
 
+/**
+ * @brief In a region module (LlvmRegion) a caller may have declared the
+ *        function already, or (for the outer) the inner may have defined it.
+ */
+Function* HGraphToLLVM::GetOrCreateFunction(FunctionType* ty, std::string name) {
+  Function* f = mod_->getFunction(name);
+  if (f != nullptr) {
+    if (f->getFunctionType() == ty) return f;
+    DLOG(ERROR) << __func__ << ": type mismatch: " << name;
+  }
+  return Function::Create(ty, Function::ExternalLinkage, name, mod_);
+}
+
 void HGraphToLLVM::PopulateInnerMethod() {
   D2LOG(INFO) << __func__;
   uint32_t shorty_len;
@@ -126,6 +137,7 @@ void HGraphToLLVM::PopulateInnerMethod() {
       *ctx_, ENTRY_LLVM, inner_func_);
   SetCurrentMethodEntryBlock(llvm_entry_block_);
   irb_->SetInsertPoint(GetCurrentMethodEntryBlock());
+  CreateDebugInfo();
 
   if (McrDebug::VerifyBasicBlock(GetPrettyMethod())) {
     std::string info = " " + GetPrettyMethod();
@@ -165,6 +177,9 @@ void HGraphToLLVM::PopulateInnerMethod() {
     }
   }
 
+  GenerateStackOverflowProbe();
+  ProfileMethodEntry();
+  PlanSuspendChecks();
   GenerateBasicBlocksAndPhis();
   GenerateInstructions();
   PopulatePhis();
@@ -185,12 +200,10 @@ void HGraphToLLVM::DefineInitInnerMethods() {
   std::string nameDirect = GetCallingMethodName(
       GetPrettyMethod(), signature, is_static, INIT_DIRECT);
 
-  init_inner_from_ichf_func_=Function::Create(
-      initIchfTy, Function::ExternalLinkage, nameInclude, mod_);
+  init_inner_from_ichf_func_ = GetOrCreateFunction(initIchfTy, nameInclude);
 
   D4LOG(INFO) << "creating init init";
-  init_inner_from_init_func_=Function::Create(
-      initInitTy, Function::ExternalLinkage, nameDirect, mod_);
+  init_inner_from_init_func_ = GetOrCreateFunction(initInitTy, nameDirect);
 
   AddToInitializedInnerMethods(init_inner_from_ichf_func_);
   AddToInitializedInnerMethods(init_inner_from_init_func_);
@@ -364,9 +377,9 @@ void HGraphToLLVM::AddToInitInnerMethods(
 
   if (!is_hot && !is_native) {
     if(mcr::McrRT::IsFrameworkDexLocation(dex_location)) {
-      mcr::Analyser::AddColdMethodInternal(callee_name);
+      mcr::Analyser::AddColdMethodInternal(GetPrettyMethod(), callee_name);
     } else if(!is_abstract && !mcr::Match::IsMarkedNotHot(callee_name)) {
-      mcr::Analyser::AddColdMethod(callee_name);
+      mcr::Analyser::AddColdMethod(GetPrettyMethod(), callee_name);
     }
   }
 
@@ -809,6 +822,9 @@ void HGraphToLLVM::SetThreadRegister(Value* thread_self) {
     case InstructionSet::kArm64:
       Arm64::SetThreadRegister(irb_, thread_self);
       break;
+    case InstructionSet::kX86_64:
+      X86_64::SetThreadRegister(irb_, thread_self);
+      break;
     default:
       DLOG(FATAL) << "Unimplemented for architecture: " << isa;
   }
@@ -920,6 +936,61 @@ ArtMethod* HGraphToLLVM::ResolveSpeculativeMethod(mcr::InvokeInfo invoke_info) {
   return method;
 }
 
+/**
+ * @brief Type index of a speculated class, and its dex file (the same index
+ *        can be another class in another dex file).
+ */
+std::string HGraphToLLVM::GetSpecClassName(const mcr::InvokeInfo& invoke_info) {
+  std::stringstream ss;
+  ss << invoke_info.GetSpecClassIdx() << "d" << std::hex
+     << std::hash<std::string>()(invoke_info.GetSpecClassDexLocation());
+  return ss.str();
+}
+
+/**
+ * @brief Guard of a speculation: the (compressed) class reference of the
+ *        speculated class, or null when it does not resolve.
+ *
+ * It is shared by the InvokeWrappers of the module, and the InitInner
+ * methods of each method that speculates on it resolve it
+ * (art_llvm_resolve_spec_class). The runtime sweeps it as a weak root.
+ */
+GlobalVariable* HGraphToLLVM::GetSpecClassGuard(
+    const mcr::InvokeInfo& invoke_info) {
+  const std::string name = GetSpecClassName(invoke_info);
+  const std::string global_name = "SpecClass." + name;
+  GlobalVariable* guard = mod_->getNamedGlobal(global_name);
+  if (guard == nullptr) {
+    guard = new GlobalVariable(*mod_, irb_->getJIntTy(), false,
+        GlobalValue::LinkOnceODRLinkage, irb_->getJInt(0), global_name);
+    guard->setDSOLocal(true);
+    guard->setAlignment(MaybeAlign(4));
+  }
+  if (initialized_spec_classes_.find(name) != initialized_spec_classes_.end()) {
+    return guard;
+  }
+  initialized_spec_classes_.insert(name);
+
+  D3LOG(INFO) << __func__ << ": " << invoke_info.GetSpecClassIdx() << ":"
+    << mcr::McrCC::PrettyDexFile(invoke_info.GetSpecClassDexLocation());
+  BasicBlock* prev_block = irb_->GetInsertBlock();
+  const std::string dex_location = invoke_info.GetSpecClassDexLocation();
+  const std::string dex_filename =
+    DexFileLoader::GetBaseLocation(dex_location.c_str());
+  Value* referrers[] = { art_method_ichf_, art_method_init_ };
+  BasicBlock* blocks[] = { init_inner_from_ichf_block_,
+                           init_inner_from_init_block_ };
+  for (size_t i = 0; i < 2; i++) {
+    irb_->SetInsertPoint(blocks[i]);
+    Value* ldex_filename = irb_->mCreateGlobalStringPtr(dex_filename);
+    Value* ldex_location = irb_->mCreateGlobalStringPtr(dex_location);
+    ArtCallResolveSpecClass(referrers[i], ldex_filename, ldex_location,
+                            invoke_info.GetSpecClassIdx(), guard);
+  }
+  irb_->SetInsertPoint(prev_block);
+  return guard;
+}
+
 ArtMethod* HGraphToLLVM::ResolveLocalMethod(
     uint32_t dex_method_idx, InvokeType invoke_type) {
   D3LOG(INFO) << __func__ << ": " << dex_method_idx;
@@ -20,9 +20,11 @@
 #define ART_COMPILER_OPTIMIZING_HGRAPH_TO_LLVM_H_
 
 #include <llvm/IR/Argument.h>
+#include <llvm/IR/DIBuilder.h>
 #include <llvm/IR/MDBuilder.h>
 #include <llvm/IR/Metadata.h>
 #include <map>
+#include <memory>
 #include "debug.h"
 #include "dex/dex_file-inl.h"  // needed by dex_compilation_unit
 #include "driver/dex_compilation_unit.h"
@@ -63,6 +65,14 @@ class IRBuilder;
 class IntrinsicHelper;
 class LLVMCompilationUnit;
 
+// Suspend check on the back edges of a loop (hgraph_safepoints.cc)
+enum class SuspendCheckPolicy {
+  kDefault,  // every iteration
+  kElide,    // none: a short loop
+  kHoist,    // none: the check of the outer loop bounds the latency
+  kCounter   // every kSuspendPollInterval iterations
+};
+
 class HGraphToLLVM : public ::art::HGraphVisitor {
  public:
   explicit HGraphToLLVM(art::HGraph* graph,
@@ -117,6 +127,11 @@ class HGraphToLLVM : public ::art::HGraphVisitor {
   std::string GetPrettyMethod() {
     return mcr::McrCC::PrettyMethod(GetGraph());
   }
+
+  // Stored with the inner method (see LLVMCompilationUnit::StoreBitcode)
+  void AddLinkDependency(std::string callee) {
+    (IsOuterMethod() ? llvm_cu_inner_ : llcu_)->AddLinkDependency(callee);
+  }
   void DefineInnerMethod();
   void CommonInitialization();
   void CreateGlobalArtMethod();
@@ -163,7 +178,7 @@ class HGraphToLLVM : public ::art::HGraphVisitor {
   ALWAYS_INLINE Value* GetQuickEntrypoint(QuickEntrypointEnum qpoint);
   ALWAYS_INLINE Value* GetQuickEntrypointASM(QuickEntrypointEnum qpoint);
 
-  void ArtCallPushQuickFrame(Value* fragment);
+  void ArtCallPushQuickFrame(Value* fragment, Value* callee);
   void ArtCallPopQuickFrame(Value* fragment);
   void ArtCallClearTopOfStack();
 
@@ -179,6 +194,9 @@ class HGraphToLLVM : public ::art::HGraphVisitor {
 
   // exceptions
   void ArtCallDeliverException(Value* lexception);
+  Value* ArtCallFindCatchBlock(
+      Value* art_method, uint32_t dex_pc, Value* lexception);
+  Value* ArtCallNewNullPointer(Value* art_method, uint32_t dex_pc);
 
   Value* ArtCallAllocObject__(QuickEntrypointEnum qpoint, Value* klass);
   Value* ArtCallAllocArray__(
@@ -197,6 +215,11 @@ class HGraphToLLVM : public ::art::HGraphVisitor {
   Value* ArtCallResolveExternalMethod(
       Value* referrer, Value* dex_filename, Value* dex_location,
       uint32_t dex_method_idx, InvokeType invoke_type);
+  Value* ArtCallResolveSpecClass(
+      Value* referrer, Value* dex_filename, Value* dex_location,
+      uint32_t type_idx, Value* slot);
+  Value* ArtCallRegisterBranchProfile(
+      Value* referrer, Value* counters, Value* sites, uint32_t num_sites);
 
   Value* ArtCallResolveInternalMethod(
       Value* referrer, Value* ldex_method_idx, Value* linvoke_type);
@@ -207,6 +230,8 @@ class HGraphToLLVM : public ::art::HGraphVisitor {
 
   Value* ResolveInterfaceMethod(HInvokeInterface *hinvoke, Value* receiver);
   Value* ArtCallResolveInterfaceMethod(Value* receiver, Value* referrer);
+  Value* ArtCallInlineCacheMiss(Value* receiver, Value* interface_method,
+                                Value* inline_cache);
   Value* ArtCallResolveString(Value* caller, uint32_t string_idx,
       Value* llvm_bss_slot);
 
@@ -217,6 +242,8 @@ class HGraphToLLVM : public ::art::HGraphVisitor {
   void ArtCallInvokeQuick__(HInvoke* invoke, Value* art_method, Value* qargs,
       Value* qargs_size, Value* jvalue, Value* shorty,
       bool is_static, bool use_wrapper);
+  Value* ArtCallQuick(Type* retTy, std::vector<Type*> params,
+                      std::vector<Value*> args);
   
   GlobalVariable* GetGlobalBssSlot(std::string name);
   Value* LoadGlobalBssSlot(std::string name);
@@ -229,6 +256,9 @@ class HGraphToLLVM : public ::art::HGraphVisitor {
       std::string global_name, DataType::Type type, bool define);
   GlobalVariable* GetGlobalVariable(
       std::string global_name, Type* type, bool define);
+  GlobalVariable* CreateGlobalVariable(
+      std::string global_name, Type* type, Constant* zero, bool define);
+  Function* GetOrCreateFunction(FunctionType* ty, std::string name);
   void AddToInitializedInnerMethods(Function* func);
   bool InitializedInnerMethod(Function* func);
   void PopulateInnerMethod();
@@ -252,6 +282,8 @@ class HGraphToLLVM : public ::art::HGraphVisitor {
                        BasicBlock* trgt);
 
   ArtMethod* ResolveSpeculativeMethod(mcr::InvokeInfo invoke_info);
+  static std::string GetSpecClassName(const mcr::InvokeInfo& invoke_info);
+  GlobalVariable* GetSpecClassGuard(const mcr::InvokeInfo& invoke_info);
   ArtMethod* ResolveLocalMethod(uint32_t dex_method_idx,
                                 InvokeType optimized_invoke_type)
       SHARED_LOCKS_REQUIRED(Locks::mutator_lock_);
@@ -418,6 +450,12 @@ class HGraphToLLVM : public ::art::HGraphVisitor {
   uint32_t GetArtMethodEntryPointFromJniOffset();
   uint32_t GetThreadTopShadowFrameOffset();
   uint32_t GetThreadTopOfManagedStackOffset();
+  uint32_t GetThreadLocalPosOffset();
+  uint32_t GetThreadLocalEndOffset();
+  uint32_t GetThreadLocalObjectsOffset();
+  uint32_t GetThreadThinLockIdOffset();
+  uint32_t GetThreadLlvmCalledQuickOffset();
+  uint32_t GetThreadLlvmAllocFastPathOffset();
 
   Value* MaybeGenerateReadBarrierSlow(
       HInstruction* instruction,
@@ -500,11 +538,29 @@ class HGraphToLLVM : public ::art::HGraphVisitor {
   // e.g., block5 has SuspendCheck_block5 (which is only an LLVM block)
   std::map<BasicBlock*, BasicBlock*> phi_sc_additions_;
 
+  // last LLVM BB of an HGraph BB, when it was split (catch checks)
+  std::map<BasicBlock*, BasicBlock*> lblock_ends_;
+
   std::map<std::string, GlobalVariable*> art_method_globals_;
   // INFO not in use anymore?
   std::map<std::string, GlobalVariable*> bss_cache_;
 
   std::set<std::string> initialized_art_method_globals_;
+  // speculated classes that the InitInner methods resolve
+  std::set<std::string> initialized_spec_classes_;
+  // placeholder of the branch counters, and their sites:
+  // (block id, dex_pc, successor) triplets
+  GlobalVariable* branch_counters_ = nullptr;
+  std::vector<uint32_t> branch_sites_;
+  // debug locations (opt.line_table)
+  std::unique_ptr<DIBuilder> dib_;
+  DICompileUnit* di_unit_ = nullptr;
+  DISubprogram* di_inner_ = nullptr;
+  std::map<ArtMethod*, DISubprogram*> di_methods_;
+  DILocation* debug_loc_ = nullptr;
+  // suspend checks of the loops (opt.safepoints)
+  std::map<HLoopInformation*, SuspendCheckPolicy> suspend_policies_;
+  std::map<HLoopInformation*, AllocaInst*> suspend_counters_;
   std::set<Function*> initialized_inner_methods_;
   std::map<Function*, Value*> loaded_thread_;
   std::map<Function*, Value*> loaded_art_methods_;
@@ -594,6 +650,35 @@ class HGraphToLLVM : public ::art::HGraphVisitor {
   BasicBlock* GenerateBasicBlock(HBasicBlock* hblock);
   void LinkEntryBlock();
   void VisitBasicBlock(HBasicBlock* hblock) override;
+  // GC stack maps (hgraph_gc_stackmaps.cc)
+  void VisitBasicBlockWithStackMaps(HBasicBlock* hblock);
+  std::vector<Value*> GetLiveReferences(HInstruction* h);
+  void AddStackMaps(HInstruction* h, const std::vector<Value*>& refs,
+                    const std::vector<CallInst*>& calls);
+  // Branch profile (hgraph_branch_profile.cc)
+  void ProfileMethodEntry();
+  void ProfileBranch(HInstruction* h, Value* successor_index,
+                     uint32_t num_successors);
+  void IncrementBranchCounter(uint32_t block_id, uint32_t dex_pc,
+                              uint32_t successor);
+  void AddBranchSite(uint32_t block_id, uint32_t dex_pc, uint32_t successor);
+  void CreateCounterIncrement(Value* idx);
+  void FinalizeBranchProfile();
+  MDNode* GetBranchWeights(HInstruction* h, uint32_t num_successors);
+  uint64_t GetCallCount(HInvoke* hinvoke);
+  // Debug locations (hgraph_debug_info.cc)
+  void CreateDebugInfo();
+  DISubprogram* CreateDebugSubprogram(std::string pretty_method);
+  DISubprogram* GetDebugSubprogram(ArtMethod* method);
+  void ResetDebugLocation();
+  void SetDebugLocation(HInstruction* h);
+  void VisitBasicBlockWithDebugLocations(HBasicBlock* hblock);
+  void FinalizeDebugInfo();
+  // Safepoints (hgraph_safepoints.cc)
+  void PlanSuspendChecks();
+  SuspendCheckPolicy GetSuspendCheckPolicy(HLoopInformation* loop);
+  bool GeneratePlannedSuspendCheck(HBasicBlock* back_edge);
+  void GenerateSuspendCheckPoll(HBasicBlock* back_edge, AllocaInst* counter);
   // Instructions
   void VisitInstruction(HInstruction* h) override;
   void VisitCurrentMethod(HCurrentMethod* h) override;
@@ -695,21 +780,39 @@ FOR_EACH_CONDITION_INSTRUCTION(DEFINE_CONDITION_VISITORS)
   // SIMD operations
   Value* VecAddress(
       HVecMemoryOperation* instruction, size_t size, bool is_string_char_at);
+  Type* GetVecType(DataType::Type packed_type, size_t vector_length);
+  Value* VecShiftDistance(HVecBinaryOperation* h);
+  Value* VecFPToSISat(Value* v, VectorType* to_ty);
+  Value* VecSumToLength(Value* v, size_t from_length, size_t to_length);
+  Value* CallVecIntrinsic(Intrinsic::ID id, Type* vec_ty,
+                          std::vector<Value*> args);
   void VisitVecReplicateScalar(HVecReplicateScalar* hvec) override;
+  void VisitVecExtractScalar(HVecExtractScalar* h) override;
+  void VisitVecReduce(HVecReduce* h) override;
   void VisitVecLoad(HVecLoad* instruction) override;
   void VisitVecStore(HVecStore* instruction) override;
-  // void VisitVecSetScalars(HVecSetScalars* h) override;
+  void VisitVecSetScalars(HVecSetScalars* h) override;
+  void VisitVecMultiplyAccumulate(HVecMultiplyAccumulate* h) override;
+  void VisitVecSADAccumulate(HVecSADAccumulate* h) override;
+  void VisitVecDotProd(HVecDotProd* h) override;
 
   // Vec binops
   void HandleVecBinaryOp(HVecBinaryOperation* h);
 #define FOR_EACH_VEC_BINOP_INSTRUCTION(M)                          \
   M(Add)                                                           \
+  M(SaturationAdd)                                                 \
+  M(HalvingAdd)                                                    \
   M(Sub)                                                           \
+  M(SaturationSub)                                                 \
   M(Mul)                                                           \
   M(Div)                                                           \
   M(And)                                                           \
+  M(AndNot)                                                        \
   M(Or)                                                            \
   M(Xor)                                                           \
+  M(Shl)                                                           \
+  M(Shr)                                                           \
+  M(UShr)                                                          \
   M(Min)                                                           \
   M(Max)
 #define DEFINE_VEC_BINOP_VISITORS(Name)                             \
@@ -772,6 +875,13 @@ FOR_EACH_VEC_UNOP_INSTRUCTION(DEFINE_VEC_UNOP_VISITORS)
   void VisitThrow(HThrow* h) override;
   void VisitLoadException(HLoadException* instruction) override;
   void VisitClearException(HClearException* clear) override;
+  void GenerateCatchDispatch(HInstruction* h, Value* lexception);
+  void GenerateCatchCheck(HInvoke* invoke);
+  BasicBlock* GetLastBasicBlock(HBasicBlock* hblock);
+
+  // Implicit checks (opt.implicit_checks)
+  void GenerateImplicitNullCheck(HNullCheck* h, Value* receiver);
+  void GenerateStackOverflowProbe();
 
   // Invokes
   Value* GetArtMethodStaticOrDirect(HInvokeStaticOrDirect* invoke);
@@ -797,15 +907,18 @@ FOR_EACH_VEC_UNOP_INSTRUCTION(DEFINE_VEC_UNOP_VISITORS)
 
   void VisitInvokeStaticOrDirect(HInvokeStaticOrDirect* invoke) override {
     HandleInvoke(invoke);
+    GenerateCatchCheck(invoke);
   }
 
   void VisitInvokeVirtual(HInvokeVirtual* invoke) override {
     HandleInvoke(invoke);
+    GenerateCatchCheck(invoke);
   }
 
   void VisitInvokeInterface(HInvokeInterface* invoke) override {
     D2LOG(INFO) << "VisitInvokeInterface: " << prt_->GetInstruction(invoke);
     HandleInvoke(invoke);
+    GenerateCatchCheck(invoke);
   }
 
   void VisitInvokePolymorphic(HInvokePolymorphic* invoke) override {
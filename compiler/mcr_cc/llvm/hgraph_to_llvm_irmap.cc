@@ -168,24 +168,44 @@ GlobalVariable* HGraphToLLVM::GetGlobalArtMethod(
   return GetGlobalVariable(global_name, DataType::Type::kReference, define);
 }
 
+/**
+ * @brief In a region module (LlvmRegion) the global may already exist,
+ *        created by another method. It is then shared, like llvm-link
+ *        would do for the linkonce_odr definitions of separate modules.
+ */
+GlobalVariable* HGraphToLLVM::CreateGlobalVariable(
+    std::string global_name, Type* type, Constant* zero, bool define) {
+  GlobalVariable* global_var = mod_->getNamedGlobal(global_name);
+  if (global_var != nullptr && global_var->getValueType() == type) {
+    if (define && global_var->isDeclaration()) {
+      global_var->setLinkage(GlobalVariable::LinkOnceODRLinkage);
+      global_var->setInitializer(zero);
+    }
+    return global_var;
+  }
+
+  GlobalVariable::LinkageTypes linkage_type;
+  if (define) {
+    linkage_type = GlobalVariable::LinkOnceODRLinkage;
+  } else {
+    linkage_type = GlobalVariable::ExternalLinkage;
+  }
+
+  global_var = new GlobalVariable(*mod_, type,
+      false, linkage_type, nullptr, global_name);
+  if (define) {
+    global_var->setInitializer(zero);
+  }
+  return global_var;
+}
+
 GlobalVariable* HGraphToLLVM::GetGlobalVariable(
     std::string global_name, DataType::Type type, bool define) {
 
   // TODO OPTIMIZE: put stuff in cur_block (with std::map)
   GlobalVariable* global_var = nullptr;
   if (art_method_globals_.find(global_name) == art_method_globals_.end()) {
-    GlobalVariable::LinkageTypes linkage_type;
-    if (define) {
-      linkage_type = GlobalVariable::LinkOnceODRLinkage;
-    } else {
-      linkage_type = GlobalVariable::ExternalLinkage;
-    }
-
-    global_var = new GlobalVariable(*mod_, irb_->getType(type),
-        false, linkage_type, nullptr, global_name);
-    if (define) {
-      global_var->setInitializer(irb_->getJZero(type));
-    }
+    global_var = CreateGlobalVariable(global_name, irb_->getType(type), irb_->getJZero(type), define);
 
     art_method_globals_.insert(
         std::pair<std::string, GlobalVariable*>(
@@ -203,18 +223,7 @@ GlobalVariable* HGraphToLLVM::GetGlobalVariable(
   // TODO OPTIMIZE: put stuff in cur_block (with std::map)
   GlobalVariable* global_var = nullptr;
   if (art_method_globals_.find(global_name) == art_method_globals_.end()) {
-    GlobalVariable::LinkageTypes linkage_type;
-    if (define) {
-      linkage_type = GlobalVariable::LinkOnceODRLinkage;
-    } else {
-      linkage_type = GlobalVariable::ExternalLinkage;
-    }
-
-    global_var = new GlobalVariable(*mod_, type,
-        false, linkage_type, nullptr, global_name);
-    if (define) {
-      global_var->setInitializer(irb_->getJNull(type));
-    }
+    global_var = CreateGlobalVariable(global_name, type, irb_->getJNull(type), define);
 
     art_method_globals_.insert(
         std::pair<std::string, GlobalVariable*>(
@@ -19,6 +19,7 @@
 #include "hgraph_to_llvm-inl.h"
 #include "hgraph_to_llvm.h"
 
+#include <cmath>
 #include "asm_arm64.h"
 #include "asm_arm_thumb.h"
 #include "dex/dex_file.h"
@@ -37,13 +38,83 @@ using namespace ::llvm;
 namespace art {
 namespace LLVM {
 
-// TODO
-// VecSetScalars
-// VecMultiplyAccumulate (skipped normal mulacc)
-// SADAccumulate
-// VecDotProd
-// VisitVecReduce
-// VisitVecExtractScalar
+/**
+ * Vector types follow the packed type of an HVec operation. Lanes are
+ * exact (e.g. <16 x i8>), unlike scalars of narrow types, which are i32.
+ *
+ * HLoopOptimization peels and cleans up with scalar loops, and its vector
+ * loops have no predicates, so no masked tails are needed here.
+ */
+Type* HGraphToLLVM::GetVecType(DataType::Type packed_type, size_t vector_length) {
+  return VectorType::get(irb_->getTypeExact(packed_type), vector_length);
+}
+
+Value* HGraphToLLVM::CallVecIntrinsic(Intrinsic::ID id, Type* vec_ty,
+    std::vector<Value*> args) {
+  std::vector<Type*> ty(1, vec_ty);
+  Function* f = Intrinsic::getDeclaration(mod_, id, ty);
+  return irb_->CreateCall(f, args);
+}
+
+/**
+ * @brief Distance of a vector shift, masked like the scalar ones,
+ *        and replicated to all lanes.
+ */
+Value* HGraphToLLVM::VecShiftDistance(HVecBinaryOperation* h) {
+  HInstruction* hdistance = h->InputAt(1);
+  CHECK(hdistance->IsConstant()) << "Vector shift by a non constant: "
+    << GetTwine(h);
+  DataType::Type vecType = h->GetPackedType();
+  int64_t mask = DataType::Size(vecType) * kBitsPerByte - 1;
+  int64_t distance = Int64FromConstant(hdistance->AsConstant()) & mask;
+  return ConstantInt::get(GetVecType(vecType, h->GetVectorLength()), distance);
+}
+
+/**
+ * @brief FP to int lanes, as Java converts them (d2i, f2l, ..): NaN is 0,
+ *        and out of range values saturate. fptosi is poison for those
+ *        lanes, and LLVM 10 has no llvm.fptosi.sat, so they are selected.
+ */
+Value* HGraphToLLVM::VecFPToSISat(Value* v, VectorType* to_ty) {
+  const unsigned bits = to_ty->getScalarSizeInBits();
+  Type* from_ty = v->getType();
+  // -2^(bits-1) is exact in float and double
+  Constant* fmin = ConstantFP::get(from_ty, -std::ldexp(1.0, bits - 1));
+  Constant* fmax = ConstantFP::get(from_ty, std::ldexp(1.0, bits - 1));
+  Value* res = irb_->CreateFPToSI(v, to_ty);
+  res = irb_->CreateSelect(irb_->CreateFCmpOGE(v, fmax),
+      ConstantInt::get(to_ty, APInt::getSignedMaxValue(bits)), res);
+  res = irb_->CreateSelect(irb_->CreateFCmpOLT(v, fmin),
+      ConstantInt::get(to_ty, APInt::getSignedMinValue(bits)), res);
+  return irb_->CreateSelect(irb_->CreateFCmpUNO(v, v),
+      ConstantInt::get(to_ty, 0), res);
+}
+
+/**
+ * @brief Sums groups of consecutive lanes, so the result has to_length lanes,
+ *        e.g. 16 x i32 to 4 x i32: [ x0+..+x3, x4+..+x7, .. ].
+ *
+ * Used by SAD and dot product, whose accumulator has fewer (but wider)
+ * lanes than the operands. How the lanes are grouped is implementation
+ * dependent, as only the reduction of the accumulator is observed.
+ */
+Value* HGraphToLLVM::VecSumToLength(Value* v, size_t from_length, size_t to_length) {
+  CHECK(to_length > 0 && from_length % to_length == 0)
+    << "VecSumToLength: " << from_length << " to " << to_length;
+  size_t group = from_length / to_length;
+  if (group == 1) return v;
+
+  Value* sum = nullptr;
+  Value* undef = UndefValue::get(v->getType());
+  for (size_t k = 0; k < group; k++) {
+    SmallVector<uint32_t, 16> lanes;
+    for (size_t i = 0; i < to_length; i++) lanes.push_back(i * group + k);
+    Value* mask = ConstantDataVector::get(*ctx_, lanes);
+    Value* part = irb_->CreateShuffleVector(v, undef, mask);
+    sum = (sum == nullptr) ? part : irb_->CreateAdd(sum, part);
+  }
+  return sum;
+}
 
 void HGraphToLLVM::HandleVecUnaryOp(HVecUnaryOperation* h) {
   DataType::Type vecType = h->GetPackedType();
@@ -54,15 +125,41 @@ void HGraphToLLVM::HandleVecUnaryOp(HVecUnaryOperation* h) {
 
   bool is_signed = IRBuilder::IsSigned(vecType);
 
-  // ExtractScalar
-  // Reduce
-  // Cnv
-  // Abs
-  // Not
   Value* res = nullptr;
   if (h->IsVecNeg()) {
     res = irb_->mCreateNeg(is_fp, is_signed, lhs);
     // CHECK char does not need trunc?
+  } else if (h->IsVecAbs()) {
+    if (is_fp) {
+      res = CallVecIntrinsic(Intrinsic::fabs, lhs->getType(), {lhs});
+    } else {
+      Value* zero = Constant::getNullValue(lhs->getType());
+      Value* lcond = irb_->CreateICmpSLT(lhs, zero);
+      res = irb_->CreateSelect(lcond, irb_->CreateNeg(lhs), lhs);
+    }
+  } else if (h->IsVecNot()) {
+    if (vecType == DataType::Type::kBool) {
+      // boolean-not: lanes are 0 or 1
+      res = irb_->CreateXor(lhs, ConstantInt::get(lhs->getType(), 1));
+    } else {
+      res = irb_->CreateNot(lhs);
+    }
+  } else if (h->IsVecCnv()) {
+    HVecCnv* cnv = h->AsVecCnv();
+    DataType::Type from = cnv->GetInputType();
+    DataType::Type to = cnv->GetResultType();
+    Type* to_ty = GetVecType(to, h->GetVectorLength());
+    bool from_fp = DataType::IsFloatingPointType(from);
+    bool to_fp = DataType::IsFloatingPointType(to);
+    if (from_fp && to_fp) {
+      res = irb_->CreateFPCast(lhs, to_ty);
+    } else if (!from_fp && to_fp) {
+      res = irb_->CreateSIToFP(lhs, to_ty);
+    } else if (from_fp && !to_fp) {
+      res = VecFPToSISat(lhs, cast<VectorType>(to_ty));
+    } else {
+      res = irb_->CreateIntCast(lhs, to_ty, IRBuilder::IsSigned(from));
+    }
   } else {
     DIE_UNIMPLEMENTED_;
   }
@@ -71,26 +168,32 @@ void HGraphToLLVM::HandleVecUnaryOp(HVecUnaryOperation* h) {
   addValue(h, res);
 }
 
-
 void HGraphToLLVM::HandleVecBinaryOp(HVecBinaryOperation* h) {
   DataType::Type vecType = h->GetPackedType();
   const bool is_fp = DataType::IsFloatingPointType(vecType);
   VERIFY_LLVMD3("Type: " << vecType << " FP: " << is_fp);
 
   Value* lhs = getValue(h->InputAt(0));
-  Value* rhs = getValue(h->InputAt(1));
 
   bool is_signed = IRBuilder::IsSigned(vecType);
 
-  // TODO VecBinops
-  // SaturationAdd
-  // HalvingAdd 
-  // SaturationSub
-  // AndNot
-  // Shl
-  // Shr
-  // UShr
+  // shifts: the distance is a scalar constant
   Value* res = nullptr;
+  if (h->IsVecShl()) {
+    res = irb_->CreateShl(lhs, VecShiftDistance(h));
+    addValue(h, res);
+    return;
+  } else if (h->IsVecShr()) {
+    res = irb_->CreateAShr(lhs, VecShiftDistance(h));
+    addValue(h, res);
+    return;
+  } else if (h->IsVecUShr()) {
+    res = irb_->CreateLShr(lhs, VecShiftDistance(h));
+    addValue(h, res);
+    return;
+  }
+
+  Value* rhs = getValue(h->InputAt(1));
   if (h->IsVecAdd()) {
     res = irb_->mCreateAdd(is_fp, lhs, rhs);
   } else if (h->IsVecSub()) {
@@ -101,21 +204,45 @@ void HGraphToLLVM::HandleVecBinaryOp(HVecBinaryOperation* h) {
     res = irb_->mCreateDiv(is_fp, lhs, rhs);
   } else if (h->IsVecAnd()) {
     res = irb_->CreateAnd(lhs, rhs);
+  } else if (h->IsVecAndNot()) {
+    // [ ~x1 & y1, .. , ~xn & yn ]
+    res = irb_->CreateAnd(irb_->CreateNot(lhs), rhs);
   } else if (h->IsVecOr()) {
     res = irb_->CreateOr(lhs, rhs);
-  } else if (h->IsVecNeg()) {
-    res = irb_->mCreateNeg(is_fp, is_signed, lhs);
-    // CHECK char does not need trunc?
   } else if (h->IsVecXor()) {
     res = irb_->CreateXor(lhs, rhs); 
-  // } else if (IsVecShiftOperation(h)) { TODO Shift
-  //   res = GetVecShiftOperation(h, lhs, rhs);
-  // } else if (h->IsVecMin() || h->IsVecMax()) { TODO
-  //   if(is_fp) {
-  //     res = ih_->llvm_MaxOrMinf(this, h, lhs, rhs);
-  //   } else {
-  //     res = ih_->canonical_MaxOrMin(this, h, lhs, rhs);
-  //   }
+  } else if (h->IsVecSaturationAdd()) {
+    res = CallVecIntrinsic(is_signed ? Intrinsic::sadd_sat : Intrinsic::uadd_sat,
+        lhs->getType(), {lhs, rhs});
+  } else if (h->IsVecSaturationSub()) {
+    res = CallVecIntrinsic(is_signed ? Intrinsic::ssub_sat : Intrinsic::usub_sat,
+        lhs->getType(), {lhs, rhs});
+  } else if (h->IsVecHalvingAdd()) {
+    // (x + y [+ 1]) >> 1, without overflowing the lanes
+    size_t vecLen = h->GetVectorLength();
+    Type* lane_ty = irb_->getTypeExact(vecType);
+    Type* wide_ty = VectorType::get(
+        irb_->getIntNTy(lane_ty->getIntegerBitWidth() * 2), vecLen);
+    Value* wlhs = irb_->CreateIntCast(lhs, wide_ty, is_signed);
+    Value* wrhs = irb_->CreateIntCast(rhs, wide_ty, is_signed);
+    Value* sum = irb_->CreateAdd(wlhs, wrhs);
+    if (h->AsVecHalvingAdd()->IsRounded()) {
+      sum = irb_->CreateAdd(sum, ConstantInt::get(wide_ty, 1));
+    }
+    Value* one = ConstantInt::get(wide_ty, 1);
+    sum = is_signed ? irb_->CreateAShr(sum, one) : irb_->CreateLShr(sum, one);
+    res = irb_->CreateTrunc(sum, lhs->getType());
+  } else if (h->IsVecMin() || h->IsVecMax()) {
+    if (is_fp) {
+      // NaN propagating, and -0.0 < +0.0, like Math.min/max
+      res = CallVecIntrinsic(h->IsVecMin() ? Intrinsic::minimum : Intrinsic::maximum,
+          lhs->getType(), {lhs, rhs});
+    } else {
+      Value* lcond = irb_->mCreateCmpGT(false, is_signed, lhs, rhs);
+      res = h->IsVecMax()
+        ? irb_->CreateSelect(lcond, lhs, rhs)
+        : irb_->CreateSelect(lcond, rhs, lhs);
+    }
   } else {
     DIE_UNIMPLEMENTED_;
   }
@@ -124,6 +251,144 @@ void HGraphToLLVM::HandleVecBinaryOp(HVecBinaryOperation* h) {
   addValue(h, res);
 }
 
+/**
+ * @brief Only lane 0 is extracted (see HVecExtractScalar).
+ *        Narrow lanes are extended, as scalars are kept in i32.
+ */
+void HGraphToLLVM::VisitVecExtractScalar(HVecExtractScalar* h) {
+  VERIFY_LLVMD4(GetTwine(h));
+  DataType::Type vecType = h->GetPackedType();
+  Value* vec = getValue(h->InputAt(0));
+  Value* res = irb_->CreateExtractElement(vec, irb_->getJInt(0));
+  Type* scalar_ty = irb_->getType(vecType);
+  if (res->getType() != scalar_ty) {
+    res = irb_->CreateIntCast(res, scalar_ty, IRBuilder::IsSigned(vecType));
+  }
+  addValue(h, res);
+}
+
+/**
+ * @brief The reduction is placed in lane 0, the others are undefined
+ *        (see HVecReduce). Uses the vector reduce intrinsics.
+ */
+void HGraphToLLVM::VisitVecReduce(HVecReduce* h) {
+  VERIFY_LLVMD4(GetTwine(h));
+  DataType::Type vecType = h->GetPackedType();
+  CHECK(DataType::IsIntegralType(vecType))
+    << "Unsupported SIMD reduction: " << vecType;
+  bool is_signed = IRBuilder::IsSigned(vecType);
+  Value* vec = getValue(h->InputAt(0));
+
+  Value* reduced = nullptr;
+  switch (h->GetReductionKind()) {
+    case HVecReduce::kSum:
+      reduced = irb_->CreateAddReduce(vec);
+      break;
+    case HVecReduce::kMin:
+      reduced = irb_->CreateIntMinReduce(vec, is_signed);
+      break;
+    case HVecReduce::kMax:
+      reduced = irb_->CreateIntMaxReduce(vec, is_signed);
+      break;
+  }
+  CHECK(reduced != nullptr);
+
+  Value* res = irb_->CreateInsertElement(
+      UndefValue::get(vec->getType()), reduced, irb_->getJInt(0));
+  addValue(h, res);
+}
+
+/**
+ * @brief Scalars go to the first lanes, and the rest are zeroed
+ *        (e.g. the initial value of a reduction).
+ */
+void HGraphToLLVM::VisitVecSetScalars(HVecSetScalars* h) {
+  VERIFY_LLVMD4(GetTwine(h));
+  DataType::Type vecType = h->GetPackedType();
+  Type* vec_ty = GetVecType(vecType, h->GetVectorLength());
+  Type* lane_ty = irb_->getTypeExact(vecType);
+
+  Value* res = Constant::getNullValue(vec_ty);
+  for (size_t i = 0; i < h->InputCount(); i++) {
+    Value* scalar = getValue(h->InputAt(i));
+    if (scalar->getType() != lane_ty) {
+      if (DataType::IsFloatingPointType(vecType)) {
+        scalar = irb_->CreateFPCast(scalar, lane_ty);
+      } else {
+        scalar = irb_->CreateIntCast(scalar, lane_ty,
+            IRBuilder::IsSigned(vecType));
+      }
+    }
+    res = irb_->CreateInsertElement(res, scalar, irb_->getJInt(i));
+  }
+  addValue(h, res);
+}
+
+/**
+ * @brief acc +/- (x * y). Integral only: a fused FP version would
+ *        break the Java rounding rules.
+ */
+void HGraphToLLVM::VisitVecMultiplyAccumulate(HVecMultiplyAccumulate* h) {
+  VERIFY_LLVMD4(GetTwine(h));
+  Value* acc = getValue(h->InputAt(0));
+  Value* mul = irb_->CreateMul(getValue(h->InputAt(1)), getValue(h->InputAt(2)));
+  Value* res = nullptr;
+  if (h->GetOpKind() == HInstruction::InstructionKind::kAdd) {
+    res = irb_->CreateAdd(acc, mul);
+  } else {
+    res = irb_->CreateSub(acc, mul);
+  }
+  addValue(h, res);
+}
+
+/**
+ * @brief acc + sum(abs(x - y)), where the sub and abs are done in the
+ *        precision of the accumulator (see VectorizeSADIdiom).
+ */
+void HGraphToLLVM::VisitVecSADAccumulate(HVecSADAccumulate* h) {
+  VERIFY_LLVMD4(GetTwine(h));
+  HVecOperation* hleft = h->InputAt(1)->AsVecOperation();
+  DataType::Type accType = h->GetPackedType();
+  DataType::Type subType = hleft->GetPackedType();
+  size_t acc_len = h->GetVectorLength();
+  size_t sub_len = hleft->GetVectorLength();
+  Type* wide_ty = GetVecType(accType, sub_len);
+  bool is_signed = IRBuilder::IsSigned(subType);
+
+  Value* acc = getValue(h->InputAt(0));
+  Value* lhs = irb_->CreateIntCast(getValue(h->InputAt(1)), wide_ty, is_signed);
+  Value* rhs = irb_->CreateIntCast(getValue(h->InputAt(2)), wide_ty, is_signed);
+
+  Value* diff = irb_->CreateSub(lhs, rhs);
+  Value* lcond = irb_->CreateICmpSLT(diff, Constant::getNullValue(wide_ty));
+  Value* abs = irb_->CreateSelect(lcond, irb_->CreateNeg(diff), diff);
+
+  Value* res = irb_->CreateAdd(acc, VecSumToLength(abs, sub_len, acc_len));
+  addValue(h, res);
+}
+
+/**
+ * @brief acc + sum(x * y), where the operands are extended to the
+ *        precision of the accumulator.
+ */
+void HGraphToLLVM::VisitVecDotProd(HVecDotProd* h) {
+  VERIFY_LLVMD4(GetTwine(h));
+  HVecOperation* hleft = h->InputAt(1)->AsVecOperation();
+  DataType::Type accType = h->GetPackedType();
+  size_t acc_len = h->GetVectorLength();
+  size_t op_len = hleft->GetVectorLength();
+  Type* wide_ty = GetVecType(accType, op_len);
+  bool is_signed = !h->IsZeroExtending();
+
+  Value* acc = getValue(h->InputAt(0));
+  Value* lhs = irb_->CreateIntCast(getValue(h->InputAt(1)), wide_ty, is_signed);
+  Value* rhs = irb_->CreateIntCast(getValue(h->InputAt(2)), wide_ty, is_signed);
+  Value* mul = irb_->CreateMul(lhs, rhs);
+
+  Value* res = irb_->CreateAdd(acc, VecSumToLength(mul, op_len, acc_len));
+  addValue(h, res);
+}
+
 /**
  * Examples:
  *    4x32: https://godbolt.org/z/kkUazD
@@ -235,7 +235,13 @@ void IntrinsicHelper::HandleIntrinsic(
       result = llvm_count_zeros(invoke, intrinsic, callee_args, false);
     } break;
     case Intrinsics::kStringCompareTo: {
-      f = fh_->__StringCompareTo();
+      // inline fast path of the runtime library (same or compressed strings)
+      f = fh_->__StringCompareToFast();
+      FunctionType* fty = f->getFunctionType();
+      for (size_t i = 0; i < callee_args.size(); i++) {
+        callee_args[i] = irb_->CreateBitCast(callee_args[i],
+                                             fty->getParamType(i));
+      }
 #ifdef CODE_UNUSED
       // INFO enable this only if I manage to inline the call in plugin code
       // pop arguments
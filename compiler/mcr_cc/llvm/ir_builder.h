@@ -164,6 +164,8 @@ class IRBuilder : public LLVMIRBuilder {
   PointerSize GetPointerSize() {
     if(IsCompilingArm64()) {
       return kArm64PointerSize;
+    } else if (IsCompilingX86_64()) {
+      return kX86_64PointerSize;
     } else {
       return kArmPointerSize;
     }
@@ -418,6 +420,11 @@ class IRBuilder : public LLVMIRBuilder {
     return instruction_set_ == InstructionSet::kArm64;
   }
 
+  // Linux host (asm_x86_64.h)
+  bool IsCompilingX86_64() {
+    return instruction_set_ == InstructionSet::kX86_64;
+  }
+
   Value* mCreateGlobalStringPtr(std::string str);
 
   Value* CallInlineAsm(FunctionType* fty, std::string cmd,
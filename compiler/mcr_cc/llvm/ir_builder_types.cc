@@ -1,7 +1,7 @@
 /**
  * Dalvik type mapping to LLVM types.
  * It also provides some upcasting/downcasting ops, and loads some
- * types from art_module.ll (generated/)
+ * types from the runtime library (art_runtime_lib.cc)
  *
  * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
  *
@@ -0,0 +1,121 @@
+/**
+ * Translates the .debug_line of hf.so (the debug locations of
+ * opt.line_table) to the line table of the native profiler of the runtime
+ * (mcr::LlvmProfiler): each address gets its dex method and dex_pc, and
+ * the LLVM function that it was inlined in.
+ *
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "line_table.h"
+
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/DebugInfo/DIContext.h>
+#include <llvm/DebugInfo/DWARF/DWARFContext.h>
+#include <llvm/Object/ObjectFile.h>
+#include <map>
+#include <unordered_map>
+#include "dex/dex_file_types.h"
+#include "llvm_pipeline.h"
+#include "mcr_rt/llvm_profiler.h"
+#include "mcr_rt/mcr_rt.h"
+
+using namespace ::llvm;
+
+namespace art {
+namespace LLVM {
+
+typedef mcr::LlvmProfiler::Row Row;
+
+template <typename T>
+static void Append(SmallVectorImpl<char>* out, T value) {
+  const char* bytes = reinterpret_cast<const char*>(&value);
+  out->append(bytes, bytes + sizeof(T));
+}
+
+bool LineTable::Translate(std::string file_so, std::string file_lines) {
+  Expected<object::OwningBinary<object::ObjectFile>> binary =
+    object::ObjectFile::createObjectFile(file_so);
+  if (!binary) {
+    DLOG(ERROR) << "LineTable: " << file_so << ": "
+                << toString(binary.takeError());
+    return false;
+  }
+  std::unique_ptr<DWARFContext> dwarf =
+    DWARFContext::create(*binary->getBinary());
+
+  std::vector<std::string> strings;
+  std::unordered_map<std::string, uint32_t> ids;
+  auto intern = [&](const std::string& str) -> uint32_t {
+    auto it = ids.find(str);
+    if (it != ids.end()) return it->second;
+    uint32_t id = strings.size();
+    strings.push_back(str);
+    ids.emplace(str, id);
+    return id;
+  };
+
+  // the start of a sequence overrides the end of the previous one
+  std::map<uint64_t, Row> rows;
+  const DILineInfoSpecifier spec(
+      DILineInfoSpecifier::FileLineInfoKind::None,
+      DILineInfoSpecifier::FunctionNameKind::ShortName);
+  for (const auto& cu : dwarf->compile_units()) {
+    const DWARFDebugLine::LineTable* table =
+      dwarf->getLineTableForUnit(cu.get());
+    if (table == nullptr) continue;
+    for (const DWARFDebugLine::Row& line : table->Rows) {
+      const uint64_t address = line.Address.Address;
+      if (line.EndSequence) {
+        rows.emplace(address, Row { address, dex::kDexNoIndex,
+            mcr::LlvmProfiler::kNoString, mcr::LlvmProfiler::kNoString, 0 });
+        continue;
+      }
+      DIInliningInfo frames = dwarf->getInliningInfoForAddress(
+          { address, line.Address.SectionIndex }, spec);
+      const uint32_t num_frames = frames.getNumberOfFrames();
+      if (num_frames == 0) continue;
+      const DILineInfo& inner = frames.getFrame(0);
+      rows[address] = Row { address,
+          inner.Line == 0 ? dex::kDexNoIndex : inner.Line - 1,
+          intern(inner.FunctionName),
+          intern(frames.getFrame(num_frames - 1).FunctionName), 0 };
+    }
+  }
+
+  SmallVector<char, 0> out;
+  Append<uint32_t>(&out, mcr::LlvmProfiler::kMagic);
+  Append<uint32_t>(&out, strings.size());
+  size_t strings_size = 0;
+  for (const std::string& str : strings) {
+    out.append(str.begin(), str.end());
+    out.push_back('\0');
+    strings_size += str.size() + 1;
+  }
+  for (; strings_size % sizeof(uint32_t) != 0; strings_size++) {
+    out.push_back('\0');
+  }
+  Append<uint32_t>(&out, rows.size());
+  for (const auto& it : rows) {
+    Append<Row>(&out, it.second);
+  }
+
+  D1LOG(INFO) << "LineTable: " << rows.size() << " rows of "
+              << strings.size() << " methods: " << file_so;
+  return LlvmPipeline::WriteFile(file_lines, out);
+}
+
+}  // namespace LLVM
+}  // namespace art
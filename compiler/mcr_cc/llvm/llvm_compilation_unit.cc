@@ -38,6 +38,8 @@
 #include "function_helper.h"
 #include "ir_builder.h"
 #include "llvm_compiler.h"
+#include "llvm_region.h"
+#include "runtime_library.h"
 #include "mcr_cc/linker_interface.h"
 #include "mcr_cc/mcr_cc.h"
 #include "mcr_rt/mcr_rt.h"
@@ -47,38 +49,45 @@ using namespace ::llvm;
 namespace art {
 namespace LLVM {
 
-Module* makeLLVMModuleContents(Module* module);
-
 LLVMCompilationUnit::LLVMCompilationUnit(
     CodeGenerator* codegen,
     art::HGraphFilePrettyPrinter* prt,
     const std::vector<const DexFile*>* app_dex_files,
-    std::string main_hf, bool is_outer)
+    std::string main_hf, bool is_outer, LlvmRegion* region)
     : codegen_(codegen),
       prt_(prt),
       main_hf_(main_hf),
       is_outer_(is_outer),
+      region_(region),
       app_dex_files_(app_dex_files) {
 
   D2LOG(INFO) << __func__ << ": "
-    << (is_outer?"outer":"inner") << ": " << main_hf;
+    << (is_outer?"outer":"inner") << ": " << main_hf
+    << (InRegion() ? " (region)" : "");
 
   CHECK_PTHREAD_CALL(pthread_key_create,
       (&llvm_tls_key_, nullptr), "LLVM: tls key: create");
 
-  if (llvm_info_ == nullptr) {
-    CompilerTls* tls = GetTls();
-    llvm_info_ = static_cast<LLVMInfo*>(tls->GetLLVMInfo());
+  if (InRegion()) {
+    // The region owns both, and has the runtime declarations already
+    context_.reset(region_->GetContext());
+    mod_ = region_->GetModule();
+  } else {
     if (llvm_info_ == nullptr) {
-      llvm_info_ = new LLVMInfo();
-      tls->SetLLVMInfo(llvm_info_);
+      CompilerTls* tls = GetTls();
+      llvm_info_ = static_cast<LLVMInfo*>(tls->GetLLVMInfo());
+      if (llvm_info_ == nullptr) {
+        llvm_info_ = new LLVMInfo();
+        tls->SetLLVMInfo(llvm_info_);
+      }
     }
-  }
 
-  context_.reset(llvm_info_->GetLLVMContext());
+    context_.reset(llvm_info_->GetLLVMContext());
 
-  mod_=new Module(
-      (is_outer_ ? "outer" : "inner"), *GetContext());
+    // Initialize module with the runtime library (code that belongs to RT)
+    mod_ = RuntimeLibrary::CreateModule(
+        (is_outer_ ? "outer" : "inner"), GetContext()).release();
+  }
   fh_.reset(new FunctionHelper(*GetContext(), *GetModule()));
   irb_.reset(new IRBuilder(*GetContext(), *GetModule(),
         *GetFunctionHelper(), GetInstructionSet()));
@@ -91,12 +100,10 @@ LLVMCompilationUnit::LLVMCompilationUnit(
 
   D3LOG(INFO) << "Target Triple: " << target_machine_->getTargetTriple().str();
   mod_->setTargetTriple(target_machine_->getTargetTriple().str());
+  mod_->setDataLayout(target_machine_->createDataLayout());
 
   UNUSED(using_api_for_opt);
 
-  // Initialize module with plugin code (code that belongs to runtime)
-  D5LOG(INFO) << "makeLLVMModuleContents";
-  makeLLVMModuleContents(mod_);
   irb_->LoadFromArtModule();
 }
 
@@ -118,6 +125,34 @@ bool LLVMCompilationUnit::VerifyModule() {
   return true;
 }
 
+/**
+ * @brief The module of a region (LlvmRegion) holds all the methods that
+ *        were generated so far: only those of this method are verified.
+ *        The whole module is verified once, when the region is stored.
+ */
+bool LLVMCompilationUnit::VerifyNewFunctions(
+    const std::set<const Function*>& previous) {
+  std::string module=(is_outer_ ? "Outer" : "Inner");
+  std::string s;
+  raw_string_ostream OS(s);
+  bool broken = false;
+  for (const Function& F : *mod_) {
+    if (F.isDeclaration() || previous.find(&F) != previous.end()) continue;
+    broken |= verifyFunction(F, &OS);
+  }
+
+  if (broken) {
+    std::stringstream ss;
+    ss << module << " Function Verification Error:" << std::endl;
+    ss << module << "Method:" << main_hf_ << std::endl;
+    ss << OS.str();
+    PrettyPrintBitcode(OS.str());
+    LlvmCompiler::LogError(ss.str());
+    return false;
+  }
+  return true;
+}
+
 LLVMCompilationUnit::~LLVMCompilationUnit() {
   D5LOG(INFO) << __func__ << ": " << (is_outer_?"outer":"inner");
 
@@ -235,8 +270,17 @@ void LLVMCompilationUnit::StoreBitcode(std::string postfix) {
   out_file->keep();
 
   if (!is_outer_) {
-    mcr::LinkerInterface::StoreDependencies(main_hf_);
+    mcr::LinkerInterface::StoreDependencies(main_hf_, link_dependencies_);
+  }
+}
+
+void LLVMCompilationUnit::AddLinkDependency(std::string callee) {
+  if (!main_hf_.compare(callee)) {
+    D2LOG(INFO) << "AddLinkDependency: skipping self: " << main_hf_;
+    return;
   }
+  D4LOG(INFO) << "AddLinkDependency: " << main_hf_;
+  link_dependencies_.insert(callee);
 }
 
 const DexFile* LLVMCompilationUnit::GetDexFile(
@@ -17,6 +17,9 @@
 #ifndef ART_COMPILER_LLVM_COMPILATION_UNIT_H_
 #define ART_COMPILER_LLVM_COMPILATION_UNIT_H_
 
+#include <set>
+#include <string>
+
 #include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/Module.h>
 #include <llvm/Target/TargetMachine.h>
@@ -36,6 +39,7 @@ namespace LLVM {
 
 class HGraph;
 class IRBuilder;
+class LlvmRegion;
 class FunctionHelper;
 class IntrinsicHelper;
 
@@ -45,8 +49,11 @@ class LLVMCompilationUnit {
                                HGraphFilePrettyPrinter* prt,
                                const std::vector<const DexFile*>* app_dex_files,
                                std::string main_hf_,
-                               bool is_outer);
+                               bool is_outer,
+                               LlvmRegion* region = nullptr);
   bool VerifyModule();
+  // Verifies only the functions defined after previous (a shared module)
+  bool VerifyNewFunctions(const std::set<const Function*>& previous);
   void PrettyPrintBitcode(std::string error_msg = "");
   std::string GetPrettyBitcodeErrorFile();
   void StoreBitcode(std::string postfix = "");
@@ -74,13 +81,21 @@ class LLVMCompilationUnit {
 
   // whether this is the outer entrypoint, as we have both inner and outer CUs
   bool IsOuter() const { return is_outer_; }
+  // whether it generates into the shared module of the hot region
+  bool InRegion() const { return region_ != nullptr; }
+
+  // hot callees whose bitcode has to be linked with this method (deps.lnk)
+  void AddLinkDependency(std::string callee);
+  const std::set<std::string>& GetLinkDependencies() const {
+    return link_dependencies_;
+  }
 
   const DexFile* GetDexFile(std::string dexFile, std::string dexLoc);
   CompilerTls* GetTls();
-  void InstructionSetToLLVMTarget(InstructionSet instruction_set,
-                                  std::string* target_triple,
-                                  std::string* target_cpu,
-                                  std::string* target_attr);
+  static void InstructionSetToLLVMTarget(InstructionSet instruction_set,
+                                         std::string* target_triple,
+                                         std::string* target_cpu,
+                                         std::string* target_attr);
   static std::string PrettyMethod(art::HGraph* graph);
 
  private:
@@ -89,6 +104,8 @@ class LLVMCompilationUnit {
   // Main hf of the compilation unit
   std::string main_hf_;
   bool is_outer_;
+  LlvmRegion* region_;
+  std::set<std::string> link_dependencies_;
   std::unique_ptr<LLVMContext> context_;
   Module* mod_ = nullptr;
   std::unique_ptr<IRBuilder> irb_;
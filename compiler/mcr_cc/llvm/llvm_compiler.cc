@@ -20,6 +20,7 @@
 #include "llvm_compiler.h"
 #include "mcr_rt/mcr_rt.h"
 
+#include <mutex>
 #include <sstream>
 #include <llvm/LinkAllPasses.h>
 #include <llvm/InitializePasses.h>
@@ -46,6 +47,12 @@ bool LlvmCompiler::GenerateInvokeHistogram() {
 #endif
 
 void LlvmCompiler::Initialize() {
+  // Called by every region (LlvmRegion, LlvmPipeline), possibly concurrently
+  static std::once_flag initialized;
+  std::call_once(initialized, InitializeOnce);
+}
+
+void LlvmCompiler::InitializeOnce() {
   D4LOG(INFO) << "LlvmCompiler::Initialize:";
 
   // TimePassesIsEnabled = true;
@@ -81,11 +88,16 @@ void LlvmCompiler::Initialize() {
   initializeTarget(registry);
 }
 
+// methods (and regions) are generated concurrently
+static std::mutex log_lock_;
+
 void LlvmCompiler::LogError(std::string msg) {
+  std::lock_guard<std::mutex> lock(log_lock_);
   errors_.insert(msg);
 }
 
 void LlvmCompiler::LogWarning(std::string msg) {
+  std::lock_guard<std::mutex> lock(log_lock_);
   warnings_.insert(msg);
 }
 
@@ -64,6 +64,8 @@ class LlvmCompiler final {
   static std::set<std::string> warnings_;
 
  private:
+  static void InitializeOnce();
+
   static bool gen_invoke_histogram_;
 };
 
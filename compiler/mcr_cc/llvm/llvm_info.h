@@ -18,6 +18,7 @@
 #define ART_COMPILER_LLVM_INFO_H_
 
 #include <llvm/IR/IRBuilder.h>
+#include <vector>
 
 using namespace ::llvm;
 namespace art {
@@ -38,7 +39,7 @@ class LLVMInfo {
 
 class LlvmInserter: public IRBuilderDefaultInserter {
  public:
-  LlvmInserter() : node_(NULL) { }
+  LlvmInserter() : node_(NULL), calls_fn_(nullptr), calls_(nullptr) { }
 
   void InsertHelper(::llvm::Instruction* I, const Twine& Name,
                     BasicBlock* BB,
@@ -47,12 +48,24 @@ class LlvmInserter: public IRBuilderDefaultInserter {
     if (node_ != NULL) {
       // set particular metadata here (if needed)
     }
+    if (calls_ != nullptr && BB != nullptr && BB->getParent() == calls_fn_) {
+      if (CallInst* call = dyn_cast<CallInst>(I)) calls_->push_back(call);
+    }
   }
 
   void SetDexOffset(MDNode* node) { node_ = node; }
 
+  // Records the calls that are created in F (not in helper functions).
+  // Stopped with a nullptr calls.
+  void RecordCalls(Function* F, std::vector<CallInst*>* calls) {
+    calls_fn_ = F;
+    calls_ = calls;
+  }
+
  private:
   MDNode* node_;
+  Function* calls_fn_;
+  std::vector<CallInst*>* calls_;
 };
 
 typedef ::llvm::IRBuilder<ConstantFolder, LlvmInserter> LLVMIRBuilder;
@@ -0,0 +1,153 @@
+/**
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "llvm_jit.h"
+
+#include <llvm/ADT/Triple.h>
+#include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
+#include <llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h>
+#include <llvm/ExecutionEngine/Orc/ThreadSafeModule.h>
+#include <llvm/IR/Verifier.h>
+#include <llvm/Support/raw_ostream.h>
+#include <sstream>
+#include <vector>
+#include "base/time_utils.h"
+#include "llvm_compilation_unit.h"
+#include "llvm_compiler.h"
+#include "llvm_pipeline.h"
+#include "llvm_region.h"
+#include "mcr_cc/llc_interface.h"
+#include "mcr_rt/mcr_rt.h"
+
+using namespace ::llvm;
+
+namespace art {
+namespace LLVM {
+
+std::mutex LlvmJit::jit_lock_;
+LlvmJit* LlvmJit::jit_ = nullptr;
+
+LlvmJit* LlvmJit::Get(InstructionSet instruction_set) {
+  std::lock_guard<std::mutex> lock(jit_lock_);
+  if (jit_ == nullptr) {
+    LlvmCompiler::Initialize();
+    std::unique_ptr<LlvmJit> jit(new LlvmJit(instruction_set));
+    if (!jit->Initialize()) return nullptr;
+    jit_ = jit.release();
+  }
+  return jit_;
+}
+
+LlvmJit::LlvmJit(InstructionSet instruction_set)
+    : instruction_set_(instruction_set) {}
+
+/**
+ * @brief Same target as LlvmPipeline (and the llc tool) uses for hf.so.
+ */
+bool LlvmJit::Initialize() {
+  std::string target_triple;
+  std::string target_cpu;
+  std::string target_attr;
+  LLVMCompilationUnit::InstructionSetToLLVMTarget(
+      instruction_set_, &target_triple, &target_cpu, &target_attr);
+
+  std::vector<std::string> features;
+  std::istringstream iss(target_attr);
+  for (std::string feature; std::getline(iss, feature, ',');) {
+    if (!feature.empty()) features.push_back(feature);
+  }
+
+  orc::JITTargetMachineBuilder jtmb{Triple(target_triple)};
+  jtmb.setCPU(target_cpu);
+  jtmb.addFeatures(features);
+  jtmb.setRelocationModel(Reloc::PIC_);
+  jtmb.setCodeModel(CodeModel::Small);
+  jtmb.setCodeGenOptLevel(CodeGenOpt::Default);
+
+  auto lljit = orc::LLJITBuilder()
+    .setJITTargetMachineBuilder(std::move(jtmb))
+    .create();
+  if (!lljit) {
+    DLOG(ERROR) << "LlvmJit: " << target_triple << ": "
+                << toString(lljit.takeError());
+    return false;
+  }
+  lljit_ = std::move(*lljit);
+  D1LOG(INFO) << "LlvmJit: " << target_triple << " cpu:" << target_cpu
+              << " attr:" << target_attr;
+  return true;
+}
+
+void* LlvmJit::AddMethod(std::string pretty_method, LlvmRegion* region) {
+  uint64_t s = NanoTime();
+  // Only the functions of the method were verified (GenerateInRegion)
+  std::string errors;
+  raw_string_ostream os(errors);
+  if (verifyModule(*region->GetModule(), &os)) {
+    DLOG(ERROR) << "LlvmJit: verification failed: " << pretty_method
+                << "\n" << os.str();
+    return nullptr;
+  }
+
+  LlvmPipeline pipeline(instruction_set_, LLVM_JIT_BASELINE, OPT_FLAGS, "");
+  if (!pipeline.Adopt(region->ReleaseContext(), region->ReleaseModule()) ||
+      !pipeline.EliminateDeadCode() || !pipeline.Optimize()) {
+    DLOG(ERROR) << "LlvmJit: failed to optimize: " << pretty_method;
+    return nullptr;
+  }
+  uint64_t t_opt = NanoTime() - s;
+
+  std::lock_guard<std::mutex> lock(lock_);
+  auto jd = lljit_->createJITDylib("llvm_jit_" + std::to_string(num_methods_++));
+  if (!jd) {
+    DLOG(ERROR) << "LlvmJit: " << pretty_method << ": "
+                << toString(jd.takeError());
+    return nullptr;
+  }
+  // runtime symbols (e.g. of the runtime library declarations)
+  auto generator = orc::DynamicLibrarySearchGenerator::GetForCurrentProcess(
+      lljit_->getDataLayout().getGlobalPrefix());
+  if (!generator) {
+    DLOG(ERROR) << "LlvmJit: " << toString(generator.takeError());
+    return nullptr;
+  }
+  jd->addGenerator(std::move(*generator));
+
+  orc::ThreadSafeModule tsm(pipeline.ReleaseModule(), pipeline.ReleaseContext());
+  if (Error err = lljit_->addIRModule(*jd, std::move(tsm))) {
+    DLOG(ERROR) << "LlvmJit: " << pretty_method << ": "
+                << toString(std::move(err));
+    return nullptr;
+  }
+
+  // The lookup compiles the module (outer entrypoint of HGraphToLLVM)
+  auto symbol = lljit_->lookup(*jd, "llvm_live_");
+  if (!symbol) {
+    DLOG(ERROR) << "LlvmJit: " << pretty_method << ": "
+                << toString(symbol.takeError());
+    return nullptr;
+  }
+  void* code = reinterpret_cast<void*>(
+      static_cast<uintptr_t>(symbol->getAddress()));
+
+  DLOG(INFO) << "LlvmJit: " << pretty_method << ": " << code << " in "
+             << PrettyDuration(NanoTime() - s)
+             << " (opt: " << PrettyDuration(t_opt) << ")";
+  return code;
+}
+
+}  // namespace LLVM
+}  // namespace art
@@ -0,0 +1,73 @@
+/**
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef ART_COMPILER_LLVM_JIT_H_
+#define ART_COMPILER_LLVM_JIT_H_
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <llvm/ExecutionEngine/Orc/LLJIT.h>
+#include "arch/instruction_set.h"
+#include "base/macros.h"
+
+// opt level of the methods of the JIT tier (there is no PassManager plan)
+#define LLVM_JIT_BASELINE "-O2"
+
+namespace art {
+namespace LLVM {
+
+class LlvmRegion;
+
+/**
+ * @brief The LLVM JIT tier: compiles the module of a hot method in the app
+ *        process with ORC (LLJIT), instead of to an hf.so.
+ *
+ * The module is generated like a hot region of a single method
+ * (LlvmRegion::Create), so it has its inner and outer methods, and it is
+ * optimized by LlvmPipeline. Each method gets its own JITDylib, as every
+ * one has an llvm_live_ entrypoint. Runtime symbols resolve in the process.
+ *
+ * The code is owned by ORC, and not by the JitCodeCache: it is never freed.
+ */
+class LlvmJit final {
+ public:
+  // Created on the first method of the tier
+  static LlvmJit* Get(InstructionSet instruction_set);
+
+  // Returns the llvm_live_ entrypoint of the method, or nullptr
+  void* AddMethod(std::string pretty_method, LlvmRegion* region);
+
+ private:
+  explicit LlvmJit(InstructionSet instruction_set);
+  bool Initialize();
+
+  static std::mutex jit_lock_;
+  static LlvmJit* jit_;
+
+  const InstructionSet instruction_set_;
+  std::mutex lock_;
+  std::unique_ptr<::llvm::orc::LLJIT> lljit_;
+  uint32_t num_methods_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(LlvmJit);
+};
+
+}  // namespace LLVM
+}  // namespace art
+
+#endif  // ART_COMPILER_LLVM_JIT_H_
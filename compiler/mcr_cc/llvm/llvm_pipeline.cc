@@ -0,0 +1,550 @@
+/**
+ * Links, optimizes and generates code for the bitcode of a hot region
+ * within dex2oat, using the LLVM API instead of the external tools.
+ *
+ * The opt flags (as given to the opt tool) are mapped on the new pass
+ * manager: pass names become pipeline elements, and any other flag
+ * is handled as an LLVM command line option.
+ *
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "llvm_pipeline.h"
+
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/CodeGen/BuiltinGCs.h>
+#include <llvm/IR/DIBuilder.h>
+#include <llvm/IR/DebugInfoMetadata.h>
+#include <llvm/IR/LegacyPassManager.h>
+#include <llvm/IRReader/IRReader.h>
+#include <llvm/Linker/Linker.h>
+#include <llvm/Passes/PassBuilder.h>
+#include <llvm/Support/CommandLine.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/SourceMgr.h>
+#include <llvm/Support/TargetRegistry.h>
+#include <llvm/Support/raw_ostream.h>
+#include <llvm/Transforms/Scalar/DCE.h>
+#include <llvm/Transforms/Scalar/RewriteStatepointsForGC.h>
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+#include <sstream>
+#include "base/time_utils.h"
+#include "debug.h"
+#include "llvm_compilation_unit.h"
+#include "llvm_compiler.h"
+#include "mcr_cc/llc_interface.h"
+#include "mcr_rt/mcr_rt.h"
+#include "region_inliner.h"
+
+using namespace ::llvm;
+
+namespace art {
+namespace LLVM {
+
+namespace {
+
+// The analysis managers of the new pass manager, registered and
+// cross-registered in the order PassBuilder expects.
+struct AnalysisManagers {
+  explicit AnalysisManagers(PassBuilder& pb) {
+    pb.registerModuleAnalyses(mam_);
+    pb.registerCGSCCAnalyses(cgam_);
+    pb.registerFunctionAnalyses(fam_);
+    pb.registerLoopAnalyses(lam_);
+    pb.crossRegisterProxies(lam_, fam_, cgam_, mam_);
+  }
+
+  LoopAnalysisManager lam_;
+  FunctionAnalysisManager fam_;
+  CGSCCAnalysisManager cgam_;
+  ModuleAnalysisManager mam_;
+};
+
+inline bool IsOptLevel(const std::string& flag) {
+  return flag.size() == 3 && flag.compare(0, 2, "-O") == 0;
+}
+
+inline bool IsTargetFlag(const std::string& flag) {
+  return flag.compare(0, 6, "-mcpu=") == 0 || flag.compare(0, 7, "-mattr=") == 0;
+}
+
+// The name of a cl option, as registered (-name=value)
+inline std::string GetOptionName(const std::string& flag) {
+  const size_t start = flag.find_first_not_of('-');
+  if (start == std::string::npos) return "";
+  const size_t end = flag.find('=');
+  return flag.substr(start, end == std::string::npos ? end : end - start);
+}
+
+// opt passes are given as -<pass-name>
+bool AddPass(PassBuilder& pb, ModulePassManager& mpm, const std::string& flag) {
+  const size_t start = flag.find_first_not_of('-');
+  if (start == std::string::npos || flag.find('=') != std::string::npos) {
+    return false;
+  }
+  if (Error err = pb.parsePassPipeline(mpm, flag.substr(start))) {
+    consumeError(std::move(err));
+    return false;
+  }
+  return true;
+}
+
+// The cl options are global to the process (see LlvmPipeline::AcquireOptions)
+std::shared_mutex cl_lock;
+std::once_flag cl_base_once;
+bool cl_base_ok = false;
+
+/**
+ * @brief Equivalent of the -O<level> of the opt tool.
+ *        -O0 adds nothing, like in the Android6 flow.
+ */
+bool AddDefaultPipeline(PassBuilder& pb, ModulePassManager& mpm,
+                        const std::string& level) {
+  if (level.compare("-O1") == 0) {
+    mpm.addPass(pb.buildPerModuleDefaultPipeline(PassBuilder::OptimizationLevel::O1));
+  } else if (level.compare("-O2") == 0) {
+    mpm.addPass(pb.buildPerModuleDefaultPipeline(PassBuilder::OptimizationLevel::O2));
+  } else if (level.compare("-O3") == 0) {
+    mpm.addPass(pb.buildPerModuleDefaultPipeline(PassBuilder::OptimizationLevel::O3));
+  } else if (level.compare("-Os") == 0) {
+    mpm.addPass(pb.buildPerModuleDefaultPipeline(PassBuilder::OptimizationLevel::Os));
+  } else if (level.compare("-Oz") == 0) {
+    mpm.addPass(pb.buildPerModuleDefaultPipeline(PassBuilder::OptimizationLevel::Oz));
+  } else if (level.compare("-O0") != 0) {
+    DLOG(ERROR) << "LlvmPipeline: unknown optimization level: " << level;
+    return false;
+  }
+  return true;
+}
+
+inline CodeGenOpt::Level GetCodeGenOptLevel(const std::string& level) {
+  if (level.compare("-O0") == 0) {
+    return CodeGenOpt::None;
+  } else if (level.compare("-O1") == 0) {
+    return CodeGenOpt::Less;
+  } else if (level.compare("-O3") == 0) {
+    return CodeGenOpt::Aggressive;
+  }
+  return CodeGenOpt::Default;
+}
+
+}  // namespace
+
+LlvmPipeline::LlvmPipeline(InstructionSet instruction_set,
+                           std::string baseline,
+                           std::string opt_flags,
+                           std::string llc_flags)
+    : instruction_set_(instruction_set),
+      baseline_(baseline),
+      opt_flags_(opt_flags),
+      llc_flags_(llc_flags) {
+  LlvmCompiler::Initialize();
+  context_.reset(new LLVMContext());
+
+  // The flags that are cl options, and not the same for every region
+  const std::vector<std::string> base = GetBaseOptions();
+  auto add_option = [&](const std::string& flag) {
+    if (std::find(base.begin(), base.end(), flag) == base.end()) {
+      cl_options_.push_back(flag);
+    }
+  };
+  for (const std::string& flag : Tokenize(llc_flags_)) {
+    if (!IsOptLevel(flag) && !IsTargetFlag(flag)) add_option(flag);
+  }
+  PassBuilder pb;
+  ModulePassManager mpm;
+  for (const std::string& flag : Tokenize(opt_flags_)) {
+    if (!IsOptLevel(flag) && !AddPass(pb, mpm, flag)) add_option(flag);
+  }
+}
+
+LlvmPipeline::~LlvmPipeline() {
+  // The module must go before its context
+  target_machine_.reset();
+  mod_.reset();
+  context_.reset();
+  ReleaseOptions();
+}
+
+std::vector<std::string> LlvmPipeline::Tokenize(std::string flags) {
+  std::vector<std::string> tokens;
+  std::istringstream iss(flags);
+  for (std::string token; iss >> token;) {
+    tokens.push_back(token);
+  }
+  return tokens;
+}
+
+/**
+ * @brief cl options that are the same for every region (ARCH_CL_FLAGS,
+ *        OPT_FLAGS): they are given once for the whole process.
+ */
+std::vector<std::string> LlvmPipeline::GetBaseOptions() {
+  std::vector<std::string> options(
+      Tokenize(std::string(ARCH_CL_FLAGS) + " " + OPT_FLAGS));
+  // folds the make.implicit null checks into faulting loads (.llvm_faultmaps)
+  // INFO arm64 has it in ARCH_CL_FLAGS: a cl option can be given once
+  const std::string implicit_checks = "-enable-implicit-null-checks";
+  if (McrDebug::ImplicitChecks() &&
+      std::find(options.begin(), options.end(), implicit_checks) ==
+      options.end()) {
+    options.push_back(implicit_checks);
+  }
+  return options;
+}
+
+bool LlvmPipeline::ParseOptions(const std::vector<std::string>& options) {
+  if (options.empty()) return true;
+
+  std::vector<const char*> argv;
+  argv.push_back("dex2oat");
+  std::stringstream ss;
+  for (const std::string& option : options) {
+    argv.push_back(option.c_str());
+    ss << " " << option;
+  }
+  D3LOG(INFO) << "LlvmPipeline: cl options:" << ss.str();
+
+  std::string errors;
+  raw_string_ostream os(errors);
+  if (!cl::ParseCommandLineOptions(argv.size(), argv.data(), "", &os)) {
+    DLOG(ERROR) << "LlvmPipeline: invalid options:" << ss.str()
+                << "\n" << os.str();
+    return false;
+  }
+  return true;
+}
+
+// Back to their default values, as if they were never given
+void LlvmPipeline::ResetOptions(const std::vector<std::string>& options) {
+  StringMap<cl::Option*>& registered = cl::getRegisteredOptions();
+  for (const std::string& option : options) {
+    auto it = registered.find(GetOptionName(option));
+    if (it != registered.end()) it->second->reset();
+  }
+}
+
+/**
+ * @brief The opt and llc flags of a region that are cl options are global
+ *        to the process, and regions are compiled concurrently.
+ *
+ * The base options are parsed once. A region with options of its own holds
+ * the cl lock exclusively from parsing them until it has its object
+ * (ReleaseOptions), and then restores their defaults. The rest of the
+ * regions share the lock, so they still compile in parallel, but never
+ * while another region's options are in effect.
+ */
+bool LlvmPipeline::AcquireOptions() {
+  if (options_acquired_) return true;
+  std::call_once(cl_base_once, []() {
+    std::unique_lock<std::shared_mutex> lock(cl_lock);
+    cl_base_ok = ParseOptions(GetBaseOptions());
+  });
+  if (!cl_base_ok) return false;
+
+  options_acquired_ = true;
+  if (cl_options_.empty()) {
+    shared_options_ = std::shared_lock<std::shared_mutex>(cl_lock);
+    return true;
+  }
+  exclusive_options_ = std::unique_lock<std::shared_mutex>(cl_lock);
+  // they may override base options
+  ResetOptions(cl_options_);
+  return ParseOptions(cl_options_);
+}
+
+void LlvmPipeline::ReleaseOptions() {
+  if (exclusive_options_.owns_lock()) {
+    ResetOptions(cl_options_);
+    // base options that the region overrode
+    std::vector<std::string> overridden;
+    for (const std::string& flag : GetBaseOptions()) {
+      for (const std::string& option : cl_options_) {
+        if (GetOptionName(flag) == GetOptionName(option)) {
+          overridden.push_back(flag);
+          break;
+        }
+      }
+    }
+    ParseOptions(overridden);
+    exclusive_options_.unlock();
+  } else if (shared_options_.owns_lock()) {
+    shared_options_.unlock();
+  }
+  options_acquired_ = false;
+}
+
+/**
+ * @brief Same target as the llc tool would use with the flags of
+ *        llc_interface.h (ARCH_FLAGS, RELOCATION_FLAGS).
+ */
+bool LlvmPipeline::CreateTargetMachine() {
+  std::string target_triple;
+  std::string target_cpu;
+  std::string target_attr;
+  LLVMCompilationUnit::InstructionSetToLLVMTarget(
+      instruction_set_, &target_triple, &target_cpu, &target_attr);
+
+  CodeGenOpt::Level opt_level = GetCodeGenOptLevel(baseline_);
+  for (std::string flag : Tokenize(llc_flags_)) {
+    if (IsOptLevel(flag)) {
+      opt_level = GetCodeGenOptLevel(flag);
+    } else if (flag.compare(0, 6, "-mcpu=") == 0) {
+      target_cpu = flag.substr(6);
+    } else if (flag.compare(0, 7, "-mattr=") == 0) {
+      if (!target_attr.empty()) target_attr += ",";
+      target_attr += flag.substr(7);
+    }
+  }
+  // Both opt and llc options: in place before any pass reads them
+  if (!AcquireOptions()) return false;
+
+  std::string errmsg;
+  const Target* target = TargetRegistry::lookupTarget(target_triple, errmsg);
+  if (target == nullptr) {
+    DLOG(ERROR) << "LlvmPipeline: " << target_triple << ": " << errmsg;
+    return false;
+  }
+
+  TargetOptions target_options;
+  target_machine_.reset(target->createTargetMachine(
+        target_triple, target_cpu, target_attr, target_options,
+        Reloc::PIC_, CodeModel::Small, opt_level));
+  if (target_machine_ == nullptr) {
+    DLOG(ERROR) << "LlvmPipeline: failed to create target machine: "
+                << target_triple;
+    return false;
+  }
+
+  D3LOG(INFO) << "LlvmPipeline: " << target_triple << " cpu:" << target_cpu
+              << " attr:" << target_attr;
+  if (mod_->getTargetTriple().empty()) {
+    mod_->setTargetTriple(target_triple);
+  }
+  mod_->setDataLayout(target_machine_->createDataLayout());
+  return true;
+}
+
+int LlvmPipeline::Link(const std::set<std::string>& bitcodes) {
+  uint64_t s = NanoTime();
+  mod_.reset(new Module("hf", *context_));
+  ::llvm::Linker linker(*mod_);
+
+  int cnt = 0;
+  for (const std::string& bitcode : bitcodes) {
+    D3LOG(INFO) << "LlvmPipeline: link: " << bitcode;
+    SMDiagnostic diag;
+    std::unique_ptr<Module> mod = parseIRFile(bitcode, diag, *context_);
+    if (mod == nullptr) {
+      std::string errors;
+      raw_string_ostream os(errors);
+      diag.print("dex2oat", os);
+      DLOG(ERROR) << "LlvmPipeline: failed to load: " << bitcode
+                  << "\n" << os.str();
+      return 0;
+    }
+    if (linker.linkInModule(std::move(mod))) {
+      DLOG(ERROR) << "LlvmPipeline: failed to link: " << bitcode;
+      return 0;
+    }
+    cnt++;
+  }
+
+  if (!CreateTargetMachine()) return 0;
+  timings_.link_ = NanoTime() - s;
+  return cnt;
+}
+
+bool LlvmPipeline::Adopt(std::unique_ptr<LLVMContext> context,
+                         std::unique_ptr<Module> mod) {
+  uint64_t s = NanoTime();
+  mod_.reset();
+  context_ = std::move(context);
+  mod_ = std::move(mod);
+  if (!CreateTargetMachine()) return false;
+  timings_.link_ = NanoTime() - s;
+  return true;
+}
+
+/**
+ * @brief Right after linking, when all methods of the region are in the
+ *        module, and before opt inlines any of them.
+ */
+bool LlvmPipeline::InlineRegion(std::string entrypoint, std::string report) {
+  uint64_t s = NanoTime();
+  RegionInliner inliner(mod_.get());
+  inliner.Run();
+  timings_.inline_ = NanoTime() - s;
+  D1LOG(INFO) << "RegionInliner: " << entrypoint << ": "
+              << inliner.PrettySummary();
+  return inliner.WriteReport(entrypoint, report);
+}
+
+bool LlvmPipeline::EliminateDeadCode() {
+  uint64_t s = NanoTime();
+  PassBuilder pb(target_machine_.get());
+  AnalysisManagers am(pb);
+  ModulePassManager mpm;
+  mpm.addPass(createModuleToFunctionPassAdaptor(DCEPass()));
+  mpm.run(*mod_, am.mam_);
+  timings_.dce_ = NanoTime() - s;
+  return true;
+}
+
+bool LlvmPipeline::Optimize() {
+  uint64_t s = NanoTime();
+  PassBuilder pb(target_machine_.get());
+  AnalysisManagers am(pb);
+  ModulePassManager mpm;
+
+  // The rest of the flags are cl options (AcquireOptions)
+  std::string level = baseline_;
+  for (std::string flag : Tokenize(opt_flags_)) {
+    if (IsOptLevel(flag)) {
+      level = flag;
+    } else if (AddPass(pb, mpm, flag)) {
+      D4LOG(INFO) << "LlvmPipeline: pass: " << flag;
+    }
+  }
+  if (!AddDefaultPipeline(pb, mpm, level)) return false;
+
+  mpm.run(*mod_, am.mam_);
+  timings_.opt_ = NanoTime() - s;
+  return true;
+}
+
+/**
+ * @brief Turns the calls into statepoints, after opt (like the rest of
+ *        the statepoint users), so llc records in .llvm_stackmaps where
+ *        it spilled the references of their deopt bundles
+ *        (see HGraphToLLVM::AddStackMaps).
+ *
+ * References are not in a GC address space (addrspace(1)), so they get no
+ * gc.relocate: they are reported, but can not be moved (LlvmStackMaps).
+ * Frame pointers are kept for the runtime's walk of LLVM frames.
+ */
+bool LlvmPipeline::RewriteStatepoints() {
+  uint64_t s = NanoTime();
+  linkAllBuiltinGCs();
+  for (Function& F : *mod_) {
+    if (F.isDeclaration()) continue;
+    F.setGC("statepoint-example");
+    F.addFnAttr("frame-pointer", "all");
+  }
+
+  PassBuilder pb(target_machine_.get());
+  AnalysisManagers am(pb);
+  ModulePassManager mpm;
+  mpm.addPass(RewriteStatepointsForGC());
+  mpm.run(*mod_, am.mam_);
+  timings_.opt_ += NanoTime() - s;
+  return true;
+}
+
+/**
+ * @brief Debug locations of opt.line_table (HGraphToLLVM::CreateDebugInfo)
+ *        are only on the inner methods. The rest of the functions get an
+ *        artificial subprogram, and code without a location of its function
+ *        (e.g. helpers) gets line 0, so the inliner can nest the locations
+ *        of inner methods, and llc emits a line table for all the code.
+ */
+void LlvmPipeline::CompleteDebugInfo() {
+  if (mod_->debug_compile_units().empty()) return;
+  DIBuilder dib(*mod_);
+  DICompileUnit* unit = nullptr;
+  DISubroutineType* type = nullptr;
+  size_t num_functions = 0;
+  for (Function& F : *mod_) {
+    if (F.isDeclaration()) continue;
+    DISubprogram* sp = F.getSubprogram();
+    if (sp == nullptr) {
+      if (unit == nullptr) {
+        unit = dib.createCompileUnit(dwarf::DW_LANG_C, dib.createFile("hf", ""),
+            "mcr_cc", true, "", 0, "", DICompileUnit::LineTablesOnly);
+        type = dib.createSubroutineType(dib.getOrCreateTypeArray({}));
+      }
+      sp = dib.createFunction(unit, F.getName(), "", unit->getFile(), 0, type,
+          0, DINode::FlagArtificial, DISubprogram::SPFlagDefinition);
+      F.setSubprogram(sp);
+      num_functions++;
+    }
+    for (BasicBlock& BB : F) {
+      for (Instruction& I : BB) {
+        const DILocation* loc = I.getDebugLoc().get();
+        if (loc == nullptr || loc->getInlinedAtScope()->getSubprogram() != sp) {
+          I.setDebugLoc(DILocation::get(*context_, 0, 0, sp));
+        }
+      }
+    }
+  }
+  dib.finalize();
+  D2LOG(INFO) << "LlvmPipeline: " << num_functions
+              << " functions without debug info";
+}
+
+bool LlvmPipeline::EmitObject(SmallVectorImpl<char>* object) {
+  uint64_t s = NanoTime();
+  raw_svector_ostream os(*object);
+  legacy::PassManager pm;
+  if (target_machine_->addPassesToEmitFile(pm, os, nullptr, CGFT_ObjectFile)) {
+    DLOG(ERROR) << "LlvmPipeline: target can't emit an object file";
+    return false;
+  }
+  pm.run(*mod_);
+  timings_.llc_ = NanoTime() - s;
+  return true;
+}
+
+bool LlvmPipeline::WriteBitcode(std::string filename) {
+  std::error_code ec;
+  raw_fd_ostream out(filename, ec, sys::fs::F_None);
+  if (ec) {
+    DLOG(ERROR) << "LlvmPipeline: " << filename << ": " << ec.message();
+    return false;
+  }
+  WriteBitcodeToFile(*mod_, out);
+  return true;
+}
+
+void LlvmPipeline::GetBitcode(SmallVectorImpl<char>* bitcode) {
+  raw_svector_ostream out(*bitcode);
+  WriteBitcodeToFile(*mod_, out);
+}
+
+bool LlvmPipeline::WriteFile(std::string filename, const SmallVectorImpl<char>& data) {
+  std::error_code ec;
+  raw_fd_ostream out(filename, ec, sys::fs::F_None);
+  if (ec) {
+    DLOG(ERROR) << "LlvmPipeline: " << filename << ": " << ec.message();
+    return false;
+  }
+  out.write(data.data(), data.size());
+  return true;
+}
+
+std::string LlvmPipeline::PrettyTimings() const {
+  std::stringstream ss;
+  ss << "link: " << PrettyDuration(timings_.link_)
+     << " inline: " << PrettyDuration(timings_.inline_)
+     << " dce: " << PrettyDuration(timings_.dce_)
+     << " opt: " << PrettyDuration(timings_.opt_)
+     << " llc: " << PrettyDuration(timings_.llc_);
+  return ss.str();
+}
+
+}  // namespace LLVM
+}  // namespace art
@@ -0,0 +1,116 @@
+/**
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef ART_COMPILER_LLVM_PIPELINE_H_
+#define ART_COMPILER_LLVM_PIPELINE_H_
+
+#include <memory>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Target/TargetMachine.h>
+#include "arch/instruction_set.h"
+
+using namespace ::llvm;
+
+namespace art {
+namespace LLVM {
+
+/**
+ * @brief In-process version of the llvm-link, opt -dce, opt, llc chain.
+ *
+ * The linked module stays in memory through all stages. Only the final
+ * object file leaves the process (lld still links it to hf.so).
+ * The flags that are LLVM cl options (global) are in effect from the
+ * target machine until ReleaseOptions (see AcquireOptions).
+ */
+class LlvmPipeline final {
+ public:
+  struct Timings {
+    uint64_t link_ = 0;
+    uint64_t inline_ = 0;
+    uint64_t dce_ = 0;
+    uint64_t opt_ = 0;
+    uint64_t llc_ = 0;
+  };
+
+  LlvmPipeline(InstructionSet instruction_set,
+               std::string baseline,
+               std::string opt_flags,
+               std::string llc_flags);
+  ~LlvmPipeline();
+
+  // Returns the number of linked modules, or 0 on failure.
+  int Link(const std::set<std::string>& bitcodes);
+  // Takes a module that was generated in memory (e.g. LlvmRegion::Create)
+  bool Adopt(std::unique_ptr<LLVMContext> context, std::unique_ptr<Module> mod);
+  // Profile-driven inline hints of the region (RegionInliner), and its report
+  bool InlineRegion(std::string entrypoint, std::string report);
+  bool EliminateDeadCode();
+  bool Optimize();
+  bool RewriteStatepoints();
+  void CompleteDebugInfo();
+  bool EmitObject(SmallVectorImpl<char>* object);
+  bool WriteBitcode(std::string filename);
+  // Serialized module (e.g. to key mcr::CompilationCache)
+  void GetBitcode(SmallVectorImpl<char>* bitcode);
+
+  Module* GetModule() { return mod_.get(); }
+  // The optimized module leaves the pipeline (e.g. to LlvmJit)
+  std::unique_ptr<LLVMContext> ReleaseContext() { return std::move(context_); }
+  std::unique_ptr<Module> ReleaseModule() { return std::move(mod_); }
+  // Once the object is emitted: other regions may set their cl options
+  void ReleaseOptions();
+  const Timings& GetTimings() const { return timings_; }
+  std::string PrettyTimings() const;
+
+  static bool WriteFile(std::string filename, const SmallVectorImpl<char>& data);
+
+ private:
+  static std::vector<std::string> Tokenize(std::string flags);
+  static std::vector<std::string> GetBaseOptions();
+  static bool ParseOptions(const std::vector<std::string>& options);
+  static void ResetOptions(const std::vector<std::string>& options);
+  bool AcquireOptions();
+  bool CreateTargetMachine();
+
+  const InstructionSet instruction_set_;
+  const std::string baseline_;
+  const std::string opt_flags_;
+  const std::string llc_flags_;
+
+  std::unique_ptr<LLVMContext> context_;
+  std::unique_ptr<Module> mod_;
+  std::unique_ptr<TargetMachine> target_machine_;
+  Timings timings_;
+
+  // opt/llc flags of this pipeline that are cl options (not base ones)
+  std::vector<std::string> cl_options_;
+  bool options_acquired_ = false;
+  std::unique_lock<std::shared_mutex> exclusive_options_;
+  std::shared_lock<std::shared_mutex> shared_options_;
+};
+
+}  // namespace LLVM
+}  // namespace art
+
+#endif  // ART_COMPILER_LLVM_PIPELINE_H_
@@ -0,0 +1,132 @@
+/**
+ * Generates the whole hot region in one LLVM module, instead of writing
+ * an inner and an outer bitcode file per method, that are read back and
+ * linked (with the runtime declarations of each one) by llvm-base.
+ *
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "llvm_region.h"
+
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/IR/Verifier.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/raw_ostream.h>
+#include <sys/stat.h>
+#include "base/time_utils.h"
+#include "llvm_compiler.h"
+#include "runtime_library.h"
+#include "mcr_cc/mcr_cc.h"
+#include "mcr_rt/mcr_rt.h"
+#include "mcr_rt/utils.h"
+
+namespace art {
+namespace LLVM {
+
+std::mutex LlvmRegion::regions_lock_;
+std::map<std::string, LlvmRegion*> LlvmRegion::regions_;
+
+LlvmRegion* LlvmRegion::Get(std::string entrypoint) {
+  std::lock_guard<std::mutex> lock(regions_lock_);
+  auto it = regions_.find(entrypoint);
+  if (it != regions_.end()) return it->second;
+  LlvmRegion* region = new LlvmRegion(entrypoint);
+  regions_.insert(std::make_pair(entrypoint, region));
+  return region;
+}
+
+std::unique_ptr<LlvmRegion> LlvmRegion::Create(std::string entrypoint) {
+  return std::unique_ptr<LlvmRegion>(new LlvmRegion(entrypoint));
+}
+
+LlvmRegion::LlvmRegion(std::string entrypoint) : entrypoint_(entrypoint) {
+  uint64_t s = NanoTime();
+  LlvmCompiler::Initialize();
+  context_.reset(new LLVMContext());
+
+  // Runtime library: once for all methods
+  mod_ = RuntimeLibrary::CreateModule("region", context_.get());
+  D1LOG(INFO) << "LlvmRegion: " << entrypoint_ << ": runtime module in "
+    << PrettyDuration(NanoTime() - s);
+}
+
+std::string LlvmRegion::GetBitcodeFilename(std::string entrypoint) {
+  return mcr::GetFileSrc(entrypoint, HFregionbc);
+}
+
+void LlvmRegion::AddMethod(std::string pretty_method, bool verified,
+    const std::set<std::string>& link_dependencies) {
+  methods_.insert(pretty_method);
+  link_dependencies_.insert(link_dependencies.begin(), link_dependencies.end());
+  if (!verified) failed_methods_++;
+}
+
+bool LlvmRegion::StoreAll() {
+  std::lock_guard<std::mutex> lock(regions_lock_);
+  bool ok = true;
+  for (auto& it : regions_) {
+    ok &= it.second->Store();
+  }
+  return ok;
+}
+
+bool LlvmRegion::Store() {
+  std::lock_guard<std::mutex> lock(lock_);
+  mcr::HotRegion* hot_region = mcr::McrCC::GetRegion(entrypoint_);
+  CHECK(hot_region != nullptr) << "LlvmRegion: not a hot region: " << entrypoint_;
+
+  if (failed_methods_ > 0) {
+    DLOG(ERROR) << "LlvmRegion: not storing: " << entrypoint_ << ": "
+      << failed_methods_ << "/" << methods_.size()
+      << " methods failed verification";
+    return false;
+  }
+
+  // Hot callees have to be in the same module, as nothing else is linked
+  bool complete = true;
+  for (std::string callee : link_dependencies_) {
+    if (methods_.find(callee) == methods_.end()) {
+      DLOG(ERROR) << "LlvmRegion: " << entrypoint_
+        << ": hot method is not part of the region: " << callee;
+      hot_region->AddRecompilationReason("Add to region: " + callee);
+      complete = false;
+    }
+  }
+  if (!complete) return false;
+
+  std::string errors;
+  raw_string_ostream os(errors);
+  if (verifyModule(*mod_, &os)) {
+    DLOG(ERROR) << "LlvmRegion: verification failed:\n" << os.str();
+    return false;
+  }
+
+  std::string filename = GetBitcodeFilename(entrypoint_);
+  std::error_code ec;
+  raw_fd_ostream out(filename, ec, sys::fs::F_None);
+  if (ec) {
+    DLOG(ERROR) << "LlvmRegion: " << filename << ": " << ec.message();
+    return false;
+  }
+  WriteBitcodeToFile(*mod_, out);
+  out.close();
+  chmod(filename.c_str(), 0644);
+
+  DLOG(INFO) << "LlvmRegion: " << methods_.size() << " methods: " << filename;
+  return true;
+}
+
+}  // namespace LLVM
+}  // namespace art
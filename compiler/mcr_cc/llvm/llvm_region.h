@@ -0,0 +1,98 @@
+/**
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef ART_COMPILER_LLVM_REGION_H_
+#define ART_COMPILER_LLVM_REGION_H_
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include "base/macros.h"
+
+using namespace ::llvm;
+
+namespace art {
+namespace LLVM {
+
+/**
+ * @brief A hot region (mcr::HotRegion), generated in a single LLVM module
+ *        that is kept in memory for the whole dex2oat run
+ *        (option: opt.region_module).
+ *
+ * All inner methods of the region, and the outer of its LLVM entrypoint,
+ * are emitted in the same context and module, so the runtime library
+ * (RuntimeLibrary) is materialised once per region.
+ * At the end of the compilation a single bitcode file is stored (HFregionbc)
+ * instead of an inner/outer file per method, and the deps.lnk files.
+ *
+ * Each region has its own context, so regions are generated in parallel
+ * by the threads of the compiler driver.
+ */
+class LlvmRegion final {
+ public:
+  // Lazily created on the first method of the region
+  static LlvmRegion* Get(std::string entrypoint);
+  // Not registered (never stored): a method of the LLVM JIT tier (LlvmJit)
+  static std::unique_ptr<LlvmRegion> Create(std::string entrypoint);
+  // Stores the bitcode of all regions that generated any methods
+  static bool StoreAll();
+  static std::string GetBitcodeFilename(std::string entrypoint);
+
+  const std::string& GetEntrypoint() const { return entrypoint_; }
+  LLVMContext* GetContext() { return context_.get(); }
+  Module* GetModule() { return mod_.get(); }
+  // Once generated, the module (and its context) can be compiled elsewhere
+  std::unique_ptr<LLVMContext> ReleaseContext() { return std::move(context_); }
+  std::unique_ptr<Module> ReleaseModule() { return std::move(mod_); }
+
+  // An LLVMContext is not thread-safe: the methods of a region are
+  // generated one by one.
+  // INFO not an art Mutex: it is held while generating code,
+  // which takes the mutator lock.
+  std::mutex& GetLock() { return lock_; }
+
+  // Called with the lock held, once a method is generated and verified
+  void AddMethod(std::string pretty_method, bool verified,
+                 const std::set<std::string>& link_dependencies);
+  bool Store();
+
+ private:
+  explicit LlvmRegion(std::string entrypoint);
+
+  static std::mutex regions_lock_;
+  static std::map<std::string, LlvmRegion*> regions_;
+
+  const std::string entrypoint_;
+  std::mutex lock_;
+  std::unique_ptr<LLVMContext> context_;
+  std::unique_ptr<Module> mod_;
+  // hot methods that were generated in the module, and those called
+  std::set<std::string> methods_;
+  std::set<std::string> link_dependencies_;
+  uint32_t failed_methods_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(LlvmRegion);
+};
+
+}  // namespace LLVM
+}  // namespace art
+
+#endif  // ART_COMPILER_LLVM_REGION_H_
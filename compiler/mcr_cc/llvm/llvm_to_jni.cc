@@ -186,7 +186,7 @@ Value* FunctionHelper::LLVMtoJNI(
   StructType* managed_stack_type = irb->GetManagedStackTy();
   AllocaInst* managed_stack = irb->CreateAlloca(managed_stack_type);
   managed_stack->setName("ManagedStack");
-  HL->ArtCallPushQuickFrame(managed_stack);
+  HL->ArtCallPushQuickFrame(managed_stack, lmethod);
   if(McrDebug::DebugLlvmCode3()) {
     irb->AndroidLogPrint(WARNING, "===== LL2 LtJ: PushQuickFrame ========");
     HL->ArtCallVerifyStackFrameCurrent();
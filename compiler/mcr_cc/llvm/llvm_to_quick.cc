@@ -23,6 +23,7 @@
 
 #include "hgraph_to_llvm-inl.h"
 #include "hgraph_to_llvm.h"
+#include "thread.h"
 
 #include "llvm_macros_irb.h"
 
@@ -59,6 +60,20 @@ Value* FunctionHelper::LLVMtoQuick(
     receiver->setName("receiver");
   }
 
+  if (McrDebug::DirectQuickCalls() &&
+      CanCallQuickDirect(irb, shorty, shorty_len, is_static)) {
+    if (McrDebug::VerifyInvokeQuickLlvmToQuick()) {
+      irb->AndroidLogPrint(WARNING, "-> QuickDirect:" + call_info + ": " + pretty_method);
+    }
+    Value* result = LLVMtoQuickDirect(HL, irb, art_method_or_idx, receiver,
+        is_static, callee_args, ret_type, shorty, shorty_len);
+    if (McrDebug::VerifyInvokeQuickLlvmToQuick()) {
+      irb->AndroidLogPrint(WARNING, "<- QuickDirect:" + call_info + ": "
+          + pretty_method + "\n");
+    }
+    return result;
+  }
+
   // removes return type
   size_t num_slots = shorty_len - 1;
 
@@ -128,7 +143,7 @@ Value* FunctionHelper::LLVMtoQuick(
   StructType* managed_stack_type = irb->GetManagedStackTy();
   AllocaInst* managed_stack = irb->CreateAlloca(managed_stack_type);
   managed_stack->setName("ManagedStack");
-  HL->ArtCallPushQuickFrame(managed_stack);
+  HL->ArtCallPushQuickFrame(managed_stack, art_method_or_idx);
 
   if(McrDebug::DebugLlvmCode3()) {
     irb->AndroidLogPrintHex(WARNING, "Alloca: ManagedStack", managed_stack);
@@ -176,6 +191,135 @@ Value* FunctionHelper::LLVMtoQuick(
   return result;
 }
 
+/**
+ * @brief Whether all args fit in the registers of the quick ABI, which for
+ *        those is the same as the C ABI of LLVM (AAPCS64, SysV x86_64).
+ *        Otherwise the quick code would read the rest from the frame of its
+ *        caller, at offsets that LLVM does not know about.
+ *
+ * arm: the quick ABI of thumb is not the AAPCS, so it is not supported.
+ */
+bool FunctionHelper::CanCallQuickDirect(IRBuilder* irb, const char* shorty,
+                                        uint32_t shorty_len, bool is_static) {
+  uint32_t max_core;
+  constexpr uint32_t max_fp = 8;
+  if (irb->IsCompilingArm64()) {
+    max_core = 7;  // x1-x7 (x0: ArtMethod*)
+  } else if (irb->IsCompilingX86_64()) {
+    max_core = 5;  // rsi, rdx, rcx, r8, r9 (rdi: ArtMethod*)
+  } else {
+    return false;
+  }
+
+  uint32_t num_core = is_static ? 0 : 1;
+  uint32_t num_fp = 0;
+  for (size_t i = 1; i < shorty_len; ++i) {
+    if (shorty[i] == 'F' || shorty[i] == 'D') {
+      num_fp++;
+    } else {
+      num_core++;
+    }
+  }
+  return num_core <= max_core && num_fp <= max_fp;
+}
+
+/**
+ * @brief Calls the quick code of a method with the quick ABI, through
+ *        art_llvm_call_quick (pushes a ManagedStack fragment, and refreshes
+ *        the Marking Register). There are no args array, JValue, or
+ *        runtime calls to push/pop a quick frame.
+ *
+ * Args as the quick code expects them: references are 32-bit (compressed),
+ * and sub-word values are extended to an int.
+ *
+ * llvm_called_quick is set while quick code runs, so a checkpoint on that
+ * thread walks the quick frames (see LLVM_CALLED_QUICK).
+ */
+Value* FunctionHelper::LLVMtoQuickDirect(
+    HGraphToLLVM* HL, IRBuilder* irb, Value* art_method,
+    Value* receiver, bool is_static, std::vector<Value*> callee_args,
+    DataType::Type ret_type, const char* shorty, uint32_t shorty_len) {
+  D2LOG(INFO) << __func__ << ": " << shorty;
+
+  std::vector<Type*> params;
+  std::vector<Value*> args;
+  params.push_back(irb->getVoidPointerType());
+  args.push_back(irb->CreateBitCast(art_method, irb->getVoidPointerType()));
+
+  auto add_reference = [&](Value* ref) {
+    Value* ref32 = irb->CreateTrunc(
+        irb->CreatePtrToInt(ref, irb->getJLongTy()), irb->getJIntTy());
+    params.push_back(irb->getJIntTy());
+    args.push_back(ref32);
+  };
+
+  if (!is_static) {
+    add_reference(receiver);
+  }
+  for (size_t i = 1; i < shorty_len; ++i) {
+    Value* arg = callee_args.at(i-1);
+    switch (shorty[i]) {
+      case 'L':
+        add_reference(arg);
+        break;
+      case 'F':
+      case 'D':
+      case 'J':
+        params.push_back(arg->getType());
+        args.push_back(arg);
+        break;
+      default:
+        arg = irb->UpcastInt(arg, DataType::FromShorty(shorty[i]));
+        params.push_back(irb->getJIntTy());
+        args.push_back(arg);
+        break;
+    }
+  }
+
+  Type* retTy;
+  switch (ret_type) {
+    case DataType::Type::kVoid:
+      retTy = irb->getJVoidTy();
+      break;
+    case DataType::Type::kInt64:
+      retTy = irb->getJLongTy();
+      break;
+    case DataType::Type::kFloat32:
+    case DataType::Type::kFloat64:
+      retTy = irb->getType(ret_type);
+      break;
+    default:
+      // int, sub-word values, and (compressed) references
+      retTy = irb->getJIntTy();
+      break;
+  }
+
+  Value* called_quick = irb->CreatePtrDisp(HL->GetLoadedThread(),
+      irb->getPtrEquivInt(HL->GetThreadLlvmCalledQuickOffset()),
+      irb->getJIntTy()->getPointerTo());
+  called_quick->setName("llvm_called_quick");
+  irb->CreateStore(irb->getJInt(1), called_quick, true);
+
+  Value* result = HL->ArtCallQuick(retTy, params, args);
+
+  irb->CreateStore(irb->getJInt(0), called_quick, true);
+
+  if (ret_type == DataType::Type::kVoid) {
+    return nullptr;
+  }
+
+  if (ret_type == DataType::Type::kReference) {
+    result = irb->CreateIntToPtr(
+        irb->CreateZExt(result, irb->getJLongTy()),
+        irb->getType(ret_type));
+  } else if (retTy == irb->getJIntTy() &&
+             irb->getType(ret_type) != retTy) {
+    result = irb->CreateTrunc(result, irb->getType(ret_type));
+  }
+  result->setName("result");
+  return result;
+}
+
 #include "llvm_macros_undef.h"
 
 }  // namespace LLVM
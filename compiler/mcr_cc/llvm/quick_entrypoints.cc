@@ -143,6 +143,35 @@ void HGraphToLLVM::ArtCallDeliverException(Value* lexception) {
   artCall(kQuickDeliverException, retTy, params, args);
 }
 
+/**
+ * @brief Finds the catch block of the pending exception (or of lexception,
+ *        which is made pending), at dex_pc of art_method.
+ *
+ * @return the dex pc of the handler + 1. When there is none, the runtime
+ *         delivers the exception, and it does not return.
+ */
+Value* HGraphToLLVM::ArtCallFindCatchBlock(
+    Value* art_method, uint32_t dex_pc, Value* lexception) {
+  std::vector<Value*> args{ art_method, irb_->getJInt(dex_pc), lexception };
+  std::vector<Type*> params{ irb_->getVoidPointerType(), irb_->getJIntTy(),
+    irb_->getVoidPointerType() };
+  Type* retTy = irb_->getJLongTy();
+
+  return artCall(kQuickLLVMFindCatchBlock, retTy, params, args);
+}
+
+/**
+ * @brief The NullPointerException of a null check at dex_pc of art_method
+ *        (not pending).
+ */
+Value* HGraphToLLVM::ArtCallNewNullPointer(Value* art_method, uint32_t dex_pc) {
+  std::vector<Value*> args{ art_method, irb_->getJUnsignedInt(dex_pc) };
+  std::vector<Type*> params{ irb_->getVoidPointerType(), irb_->getJIntTy() };
+  Type* retTy = irb_->getVoidPointerType();
+
+  return artCall(kQuickLLVMNewNullPointer, retTy, params, args);
+}
+
 /**
  *    called by:
  *        - CheckInstanceOf (qpoint: CheckInstanceOf) VERIFY_LLVM 
@@ -311,6 +340,42 @@ Value* HGraphToLLVM::ArtCallResolveExternalMethod(
                                       dex_location, ldex_method_idx, linvoke_type);
 }
 
+// art_llvm_resolve_spec_class
+Value* HGraphToLLVM::ArtCallResolveSpecClass(
+    Value* referrer, Value* dex_filename, Value* dex_location,
+    uint32_t type_idx, Value* slot) {
+  std::vector<Value*> args{ referrer,
+                            dex_filename,
+                            dex_location,
+                            irb_->getJUnsignedInt(type_idx),
+                            irb_->CreateBitCast(slot,
+                                irb_->getVoidPointerType()) };
+  std::vector<Type*> params{ irb_->getVoidPointerType(),
+                             irb_->getVoidPointerType(),  // const char*
+                             irb_->getVoidPointerType(),  // const char*
+                             irb_->getJIntTy(),
+                             irb_->getVoidPointerType() };
+  Type* retTy = irb_->getVoidPointerType();
+
+  return artCall(kQuickLLVMResolveSpecClass, retTy, params, args);
+}
+
+// art_llvm_register_branch_profile
+Value* HGraphToLLVM::ArtCallRegisterBranchProfile(
+    Value* referrer, Value* counters, Value* sites, uint32_t num_sites) {
+  std::vector<Value*> args{ referrer,
+                            counters,
+                            sites,
+                            irb_->getJUnsignedInt(num_sites) };
+  std::vector<Type*> params{ irb_->getVoidPointerType(),
+                             irb_->getVoidPointerType(),  // uint32_t*
+                             irb_->getVoidPointerType(),  // const Site*
+                             irb_->getJIntTy() };
+  Type* retTy = irb_->getVoidPointerType();
+
+  return artCall(kQuickLLVMRegisterBranchProfile, retTy, params, args);
+}
+
 // art_llvm_resolve_internal_method
 Value* HGraphToLLVM::ArtCallResolveInternalMethod(
     Value* referrer, Value* ldex_method_idx, Value* linvoke_type) {
@@ -372,6 +437,18 @@ Value* HGraphToLLVM::ArtCallResolveInterfaceMethod(
   return resolved_method;
 }
 
+// art_llvm_inline_cache_miss
+Value* HGraphToLLVM::ArtCallInlineCacheMiss(
+    Value* receiver, Value* interface_method, Value* inline_cache) {
+  std::vector<Type*> params{ 3, irb_->getVoidPointerType() };
+  std::vector<Value*> args { receiver, interface_method, inline_cache };
+  Type* retTy = irb_->getVoidPointerType();
+  Value* resolved_method =
+      artCall(kQuickLLVMInlineCacheMiss, retTy, params, args);
+  resolved_method->setName("ic_miss_method");
+  return resolved_method;
+}
+
 // art_llvm_resolve_string
 Value* HGraphToLLVM::ArtCallResolveString(
     Value* caller, uint32_t string_idx, Value* llvm_bss_slot) {
@@ -424,13 +501,16 @@ void HGraphToLLVM::ArtCallQuickTestSuspend() {
 }
 
 // art_llvm_push_quick_frame
-void HGraphToLLVM::ArtCallPushQuickFrame(Value* fragment) {
+// callee: the quick or JNI method (counted by the runtime)
+void HGraphToLLVM::ArtCallPushQuickFrame(Value* fragment, Value* callee) {
   VERIFIED_;
 
   fragment=irb_->CreateBitCast(fragment, irb_->getVoidPointerType());
+  callee=irb_->CreateBitCast(callee, irb_->getVoidPointerType());
 
-  std::vector<Value*> args {fragment};
-  std::vector<Type*> params {irb_->getVoidPointerType()};
+  std::vector<Value*> args {fragment, callee};
+  std::vector<Type*> params {irb_->getVoidPointerType(),
+                             irb_->getVoidPointerType()};
   Type* retTy = irb_->getVoidPointerType();
   artCall(kQuickLLVMPushQuickFrame, retTy, params, args);
 }
@@ -499,6 +579,15 @@ void HGraphToLLVM::ArtCallInvokeQuick__(
   artCall(entrypoint, retTy, params, args);
 }
 
+/**
+ * art_llvm_call_quick: args[0] is the ArtMethod*, and the rest are
+ * passed in the registers of the quick ABI (see FunctionHelper::LLVMtoQuick).
+ */
+Value* HGraphToLLVM::ArtCallQuick(Type* retTy, std::vector<Type*> params,
+                                  std::vector<Value*> args) {
+  return artCall(kQuickLLVMCallQuick, retTy, params, args);
+}
+
 }  // namespace LLVM
 }  // namespace art
 
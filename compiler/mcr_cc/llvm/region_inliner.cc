@@ -0,0 +1,207 @@
+/**
+ * Inline hints of a linked hot region: ART's inliner runs per method,
+ * before the methods are generated in LLVM, and opt only sees a single
+ * -O level for the whole region. With opt.region_inline the calls between
+ * LLVM methods get their own hint, from the profiled call counts:
+ * hot calls to small methods are always inlined, and calls that were rare
+ * while profiling are not inlined at all. Calls without a count (not
+ * annotated) are left to opt.
+ *
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "region_inliner.h"
+
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/IntrinsicInst.h>
+#include <llvm/IR/Metadata.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/raw_ostream.h>
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include "debug.h"
+
+using namespace ::llvm;
+
+namespace art {
+namespace LLVM {
+
+// call count and dex pc of a call to an LLVM method
+static constexpr const char* kCallMetadata = "mcr.call";
+
+// callees of up to this many instructions are left to opt
+static constexpr size_t kTinyMaxSize = 24;
+// max callee size of hot calls that are always inlined
+static constexpr size_t kAlwaysMaxSize = 400;
+// hot: at least 1/kHotShare of the hottest call of the region
+static constexpr uint64_t kHotShare = 10;
+// warm: at least 1/kWarmShare of it. Below that calls are cold.
+static constexpr uint64_t kWarmShare = 1000;
+
+void RegionInliner::AnnotateCall(CallInst* call, uint64_t call_count,
+                                 uint32_t dex_pc) {
+  LLVMContext& ctx = call->getContext();
+  Metadata* ops[] = {
+    ConstantAsMetadata::get(ConstantInt::get(Type::getInt64Ty(ctx), call_count)),
+    ConstantAsMetadata::get(ConstantInt::get(Type::getInt32Ty(ctx), dex_pc))
+  };
+  call->setMetadata(kCallMetadata, MDNode::get(ctx, ops));
+}
+
+static size_t GetSize(const Function& F) {
+  size_t size = 0;
+  for (const BasicBlock& BB : F) {
+    for (const Instruction& I : BB) {
+      if (!isa<DbgInfoIntrinsic>(I)) size++;
+    }
+  }
+  return size;
+}
+
+void RegionInliner::Run() {
+  std::map<const Function*, size_t> sizes;
+  std::vector<CallInst*> calls;
+  uint64_t max_count = 0;
+  for (Function& F : *mod_) {
+    if (F.isDeclaration()) continue;
+    sizes[&F] = GetSize(F);
+    for (BasicBlock& BB : F) {
+      for (Instruction& I : BB) {
+        CallInst* call = dyn_cast<CallInst>(&I);
+        if (call == nullptr) continue;
+        MDNode* md = call->getMetadata(kCallMetadata);
+        Function* callee = call->getCalledFunction();
+        if (md == nullptr || callee == nullptr || callee->isDeclaration()) {
+          continue;
+        }
+        InlineSite site;
+        site.caller_ = F.getName().str();
+        site.callee_ = callee->getName().str();
+        site.count_ =
+          mdconst::extract<ConstantInt>(md->getOperand(0))->getZExtValue();
+        site.dex_pc_ = static_cast<uint32_t>(
+            mdconst::extract<ConstantInt>(md->getOperand(1))->getZExtValue());
+        site.callee_size_ = 0;
+        site.decision_ = Decision::kNone;
+        sites_.push_back(site);
+        calls.push_back(call);
+        max_count = std::max(max_count, site.count_);
+      }
+    }
+  }
+
+  // Without any profile there is nothing to go by
+  if (max_count == 0) {
+    D1LOG(INFO) << "RegionInliner: no call counts";
+    return;
+  }
+
+  for (size_t i = 0; i < calls.size(); i++) {
+    CallInst* call = calls[i];
+    InlineSite& site = sites_[i];
+    Function* callee = call->getCalledFunction();
+    site.callee_size_ = sizes[callee];
+    site.decision_ = Decide(site, max_count);
+    switch (site.decision_) {
+      case Decision::kNone:
+        break;
+      case Decision::kAlways:
+        call->addAttribute(AttributeList::FunctionIndex, Attribute::AlwaysInline);
+        break;
+      case Decision::kHint:
+        // INFO only for this call, not for the other callers of the callee.
+        //      The inline cost of LLVM 10 reads only the hint of the callee.
+        call->addAttribute(AttributeList::FunctionIndex, Attribute::InlineHint);
+        break;
+      case Decision::kNever:
+        call->addAttribute(AttributeList::FunctionIndex, Attribute::NoInline);
+        break;
+    }
+    D3LOG(INFO) << "RegionInliner: " << PrettyDecision(site.decision_)
+      << ": " << site.caller_ << " -> " << site.callee_
+      << " count: " << site.count_ << " size: " << site.callee_size_;
+  }
+}
+
+RegionInliner::Decision RegionInliner::Decide(const InlineSite& site,
+                                               uint64_t max_count) const {
+  // recursive calls are tail calls
+  if (site.caller_ == site.callee_) return Decision::kNone;
+  if (site.callee_size_ <= kTinyMaxSize) return Decision::kNone;
+  const bool small = site.callee_size_ <= kAlwaysMaxSize;
+  if (site.count_ * kHotShare >= max_count) {
+    return small ? Decision::kAlways : Decision::kHint;
+  }
+  if (site.count_ * kWarmShare >= max_count) {
+    return small ? Decision::kHint : Decision::kNone;
+  }
+  return Decision::kNever;
+}
+
+const char* RegionInliner::PrettyDecision(Decision decision) {
+  switch (decision) {
+    case Decision::kNone: return "none";
+    case Decision::kAlways: return "always";
+    case Decision::kHint: return "hint";
+    case Decision::kNever: return "never";
+  }
+  return "?";
+}
+
+std::string RegionInliner::PrettySummary() const {
+  size_t num[4] = {0, 0, 0, 0};
+  for (const InlineSite& site : sites_) {
+    num[static_cast<size_t>(site.decision_)]++;
+  }
+  std::stringstream ss;
+  ss << sites_.size() << " calls: "
+     << "always: " << num[static_cast<size_t>(Decision::kAlways)]
+     << " hint: " << num[static_cast<size_t>(Decision::kHint)]
+     << " never: " << num[static_cast<size_t>(Decision::kNever)]
+     << " none: " << num[static_cast<size_t>(Decision::kNone)];
+  return ss.str();
+}
+
+/**
+ * @brief One line per call of the region, hottest first:
+ *        decision count callee_size dex_pc caller callee
+ */
+bool RegionInliner::WriteReport(std::string entrypoint,
+                                std::string filename) const {
+  std::vector<const InlineSite*> sorted;
+  for (const InlineSite& site : sites_) {
+    sorted.push_back(&site);
+  }
+  std::stable_sort(sorted.begin(), sorted.end(),
+      [](const InlineSite* a, const InlineSite* b) { return a->count_ > b->count_; });
+
+  std::error_code ec;
+  raw_fd_ostream out(filename, ec, sys::fs::F_None);
+  if (ec) {
+    DLOG(ERROR) << "RegionInliner: " << filename << ": " << ec.message();
+    return false;
+  }
+  out << "# " << entrypoint << ": " << PrettySummary() << "\n";
+  for (const InlineSite* site : sorted) {
+    out << PrettyDecision(site->decision_) << " " << site->count_
+        << " " << site->callee_size_ << " " << site->dex_pc_
+        << " " << site->caller_ << " " << site->callee_ << "\n";
+  }
+  return true;
+}
+
+}  // namespace LLVM
+}  // namespace art
@@ -0,0 +1,81 @@
+/**
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef ART_COMPILER_LLVM_REGION_INLINER_H_
+#define ART_COMPILER_LLVM_REGION_INLINER_H_
+
+#include <string>
+#include <vector>
+
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/Module.h>
+
+#define HFinline "hf.inline"
+
+using namespace ::llvm;
+
+namespace art {
+namespace LLVM {
+
+/**
+ * @brief Inlining decisions for the calls between the methods of a linked
+ *        hot region (opt.region_inline), before opt runs on it.
+ *
+ * Calls from an LLVM method to another are annotated when generated
+ * (AnnotateCall) with their profiled call count, when there is one.
+ * Once linked, each annotated call gets alwaysinline, inlinehint or
+ * noinline by its share of the hottest call of the region and the size
+ * of its callee.
+ * The decisions are reported in hf.inline.
+ */
+class RegionInliner final {
+ public:
+  enum class Decision {
+    kNone,    // left to the inliner of opt
+    kAlways,  // alwaysinline
+    kHint,    // inlinehint
+    kNever,   // noinline
+  };
+
+  struct InlineSite {
+    std::string caller_;
+    std::string callee_;
+    uint32_t dex_pc_;
+    uint64_t count_;
+    size_t callee_size_;
+    Decision decision_;
+  };
+
+  explicit RegionInliner(Module* mod) : mod_(mod) {}
+
+  static void AnnotateCall(CallInst* call, uint64_t call_count, uint32_t dex_pc);
+
+  void Run();
+  bool WriteReport(std::string entrypoint, std::string filename) const;
+  std::string PrettySummary() const;
+
+ private:
+  Decision Decide(const InlineSite& site, uint64_t max_count) const;
+  static const char* PrettyDecision(Decision decision);
+
+  Module* const mod_;
+  std::vector<InlineSite> sites_;
+};
+
+}  // namespace LLVM
+}  // namespace art
+
+#endif  // ART_COMPILER_LLVM_REGION_INLINER_H_
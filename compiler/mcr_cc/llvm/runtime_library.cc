@@ -0,0 +1,98 @@
+/**
+ * Loads the runtime bitcode library that the build generated from
+ * art_runtime_lib.cc (see runtime_library.h).
+ *
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "runtime_library.h"
+
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/IR/Function.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Transforms/Utils/Cloning.h>
+#include "art_runtime_lib_bc.h"  // generated: mcr_art_runtime_lib_bc
+#include "base/logging.h"
+#include "base/time_utils.h"
+#include "mcr_rt/mcr_rt.h"
+
+namespace art {
+namespace LLVM {
+
+// Only instantiates the runtime code of the library
+static constexpr const char* kAnchor = "art_llvm_rt_anchor";
+
+std::mutex RuntimeLibrary::lock_;
+std::map<LLVMContext*, Module*> RuntimeLibrary::prototypes_;
+
+std::unique_ptr<Module> RuntimeLibrary::CreateModule(std::string name,
+                                                     LLVMContext* context) {
+  std::unique_ptr<Module> mod = CloneModule(*GetPrototype(context));
+  mod->setModuleIdentifier(name);
+  mod->setSourceFileName(name);
+  return mod;
+}
+
+/**
+ * @brief A context is used by a single thread at a time (the one of its
+ *        LLVMInfo, or the one that holds the lock of its region), so only
+ *        the map needs the lock.
+ */
+const Module* RuntimeLibrary::GetPrototype(LLVMContext* context) {
+  {
+    std::lock_guard<std::mutex> lock(lock_);
+    auto it = prototypes_.find(context);
+    if (it != prototypes_.end()) return it->second;
+  }
+
+  uint64_t s = NanoTime();
+  MemoryBufferRef buffer(
+      StringRef(reinterpret_cast<const char*>(kArtRuntimeLibBitcode),
+                kArtRuntimeLibBitcodeSize),
+      "art_runtime_lib.bc");
+  Expected<std::unique_ptr<Module>> parsed = parseBitcodeFile(buffer, *context);
+  if (!parsed) {
+    LOG(FATAL) << "RuntimeLibrary: " << toString(parsed.takeError());
+    UNREACHABLE();
+  }
+  Module* mod = parsed->release();
+
+  if (Function* anchor = mod->getFunction(kAnchor)) {
+    anchor->eraseFromParent();
+  }
+  for (Function& F : *mod) {
+    if (!F.isDeclaration() && F.hasExternalLinkage()) {
+      F.setLinkage(GlobalValue::LinkOnceODRLinkage);
+    }
+    // of the host that built the library: the inliner refuses to inline
+    // into the hot regions a callee with other target features
+    F.removeFnAttr("target-cpu");
+    F.removeFnAttr("target-features");
+  }
+  // set by each module, from its target machine
+  mod->setTargetTriple("");
+  mod->setDataLayout("");
+
+  D2LOG(INFO) << "RuntimeLibrary: " << mod->size() << " functions, "
+    << mod->getIdentifiedStructTypes().size() << " types in "
+    << PrettyDuration(NanoTime() - s);
+
+  std::lock_guard<std::mutex> lock(lock_);
+  prototypes_.emplace(context, mod);
+  return mod;
+}
+
+}  // namespace LLVM
+}  // namespace art
@@ -0,0 +1,63 @@
+/**
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef ART_COMPILER_LLVM_RUNTIME_LIBRARY_H_
+#define ART_COMPILER_LLVM_RUNTIME_LIBRARY_H_
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+
+using namespace ::llvm;
+
+namespace art {
+namespace LLVM {
+
+/**
+ * @brief The runtime bitcode library (art_runtime_lib.cc), that the build
+ *        embeds in the compiler (art_runtime_lib_bc.h).
+ *
+ * It is parsed lazily, once per LLVMContext, on its first module.
+ * Every module of that context is a clone of it, so they all share the
+ * runtime types (e.g., class.art::ShadowFrame), and have the runtime
+ * declarations and fast paths that the backend looks up by name.
+ * The definitions are linkonce_odr: the unused ones are dropped by opt,
+ * and the inner/outer modules of a region link without conflicts.
+ * It has no target attributes, triple or data layout: those of the host
+ * that built it would stop the inliner, so each module sets its own.
+ */
+class RuntimeLibrary final {
+ public:
+  // A new module with the runtime library
+  static std::unique_ptr<Module> CreateModule(std::string name,
+                                              LLVMContext* context);
+
+ private:
+  static const Module* GetPrototype(LLVMContext* context);
+
+  static std::mutex lock_;
+  // by context: released with their contexts (kept for the whole run)
+  static std::map<LLVMContext*, Module*> prototypes_;
+};
+
+}  // namespace LLVM
+}  // namespace art
+
+#endif  // ART_COMPILER_LLVM_RUNTIME_LIBRARY_H_
@@ -0,0 +1,291 @@
+/**
+ * Translates the statepoints of hf.so (.llvm_stackmaps, v3) to the stack
+ * maps of ART (CodeInfo), so the runtime can find the GC roots of LLVM
+ * frames (mcr::LlvmStackMaps).
+ *
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "stack_maps.h"
+
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/Object/ELFObjectFile.h>
+#include <llvm/Object/ObjectFile.h>
+#include <llvm/Object/StackMapParser.h>
+#include <algorithm>
+#include <map>
+#include "base/arena_bit_vector.h"
+#include "base/malloc_arena_pool.h"
+#include "base/scoped_arena_allocator.h"
+#include "dex/dex_file_types.h"
+#include "llvm_pipeline.h"
+#include "mcr_rt/llvm_stack_maps.h"
+#include "mcr_rt/mcr_rt.h"
+#include "optimizing/stack_map_stream.h"
+
+using namespace ::llvm;
+
+namespace art {
+namespace LLVM {
+
+typedef StackMapParser<support::little> Parser;
+
+static constexpr const char* kStackMapsSection = ".llvm_stackmaps";
+// header: version, reserved, num functions, constants, records (16 bytes)
+static constexpr uint64_t kHeaderSize = 16;
+// function: address, stack size, record count (24 bytes)
+static constexpr uint64_t kFunctionSize = 24;
+// a statepoint starts with: calling convention, flags, number of deopt args
+static constexpr unsigned kStatepointHeader = 3;
+
+// DWARF register numbers
+static uint16_t GetStackPointer(InstructionSet isa) {
+  return isa == InstructionSet::kX86_64 ? 7 : 31;
+}
+
+static uint16_t GetFramePointer(InstructionSet isa) {
+  return isa == InstructionSet::kX86_64 ? 6 : 29;
+}
+
+template <typename T>
+static void Append(SmallVectorImpl<char>* out, T value) {
+  const char* bytes = reinterpret_cast<const char*>(&value);
+  out->append(bytes, bytes + sizeof(T));
+}
+
+static bool GetConstant(const Parser& parser,
+                        const Parser::LocationAccessor& loc, uint64_t* value) {
+  switch (loc.getKind()) {
+    case Parser::LocationKind::Constant:
+      *value = loc.getSmallConstant();
+      return true;
+    case Parser::LocationKind::ConstantIndex:
+      *value = parser.getConstant(loc.getConstantIndex()).getValue();
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * @brief The address fields of a PIC hf.so are zero, and they are set by
+ *        dynamic relocations (R_*_RELATIVE, or a symbol plus an addend).
+ */
+void GetRelocatedAddresses(const object::ObjectFile* obj,
+                           uint64_t begin, uint64_t end,
+                           std::map<uint64_t, uint64_t>* relocated) {
+  const auto* elf = dyn_cast<object::ELFObjectFileBase>(obj);
+  if (elf == nullptr) return;
+  for (const object::SectionRef& section : elf->dynamic_relocation_sections()) {
+    for (const object::RelocationRef& reloc : section.relocations()) {
+      const uint64_t offset = reloc.getOffset();
+      if (offset < begin || offset >= end) continue;
+
+      uint64_t value = 0;
+      Expected<int64_t> addend = object::ELFRelocationRef(reloc).getAddend();
+      if (addend) {
+        value = *addend;
+      } else {
+        consumeError(addend.takeError());
+      }
+      object::symbol_iterator symbol = reloc.getSymbol();
+      if (symbol != obj->symbol_end() && symbol != elf->dynamic_symbol_end()) {
+        Expected<uint64_t> address = symbol->getAddress();
+        if (address) {
+          value += *address;
+        } else {
+          consumeError(address.takeError());
+        }
+      }
+      (*relocated)[offset] = value;
+    }
+  }
+}
+
+/**
+ * @brief The stack mask of a statepoint: its deopt locations that are
+ *        spilled references (Indirect). Constants are nulls.
+ *
+ * Offsets are SP-based (getFrameIndexReferencePreferSP). An rbp-based one
+ * is converted with the x86_64 frame (rbp is pushed right below the return
+ * address).
+ * The rest (e.g. Register locations, with -use-registers-for-deopt-values)
+ * cannot be visited by the runtime: a missed root is a dangling reference,
+ * so the statepoint fails the translation.
+ *
+ * @return the number of such locations
+ */
+static size_t AddStackMask(const Parser& parser,
+                           const Parser::RecordAccessor& record,
+                           InstructionSet isa, uint64_t stack_size,
+                           ArenaBitVector* stack_mask) {
+  uint64_t num_deopt = 0;
+  if (record.getNumLocations() < kStatepointHeader ||
+      !GetConstant(parser, record.getLocation(kStatepointHeader - 1),
+                   &num_deopt)) {
+    return 0;  // not a statepoint
+  }
+
+  size_t unsupported = 0;
+  const uint64_t end = std::min<uint64_t>(record.getNumLocations(),
+                                          kStatepointHeader + num_deopt);
+  for (unsigned i = kStatepointHeader; i < end; i++) {
+    const Parser::LocationAccessor loc = record.getLocation(i);
+    switch (loc.getKind()) {
+      case Parser::LocationKind::Constant:
+      case Parser::LocationKind::ConstantIndex:
+        break;
+      case Parser::LocationKind::Indirect: {
+        int64_t offset = loc.getOffset();
+        if (loc.getDwarfRegNum() == GetFramePointer(isa) &&
+            isa == InstructionSet::kX86_64) {
+          offset += stack_size - 8;
+        } else if (loc.getDwarfRegNum() != GetStackPointer(isa)) {
+          unsupported++;
+          break;
+        }
+        if (offset < 0 || offset % kFrameSlotSize != 0) {
+          unsupported++;
+          break;
+        }
+        stack_mask->SetBit(offset / kFrameSlotSize);
+        break;
+      }
+      default:
+        unsupported++;
+        break;
+    }
+  }
+  return unsupported;
+}
+
+bool StackMaps::Translate(std::string file_so, InstructionSet isa,
+                          std::string file_stackmaps) {
+  Expected<object::OwningBinary<object::ObjectFile>> binary =
+    object::ObjectFile::createObjectFile(file_so);
+  if (!binary) {
+    DLOG(ERROR) << "StackMaps: " << file_so << ": "
+                << toString(binary.takeError());
+    return false;
+  }
+  const object::ObjectFile* obj = binary->getBinary();
+
+  StringRef contents;
+  uint64_t section_address = 0;
+  for (const object::SectionRef& section : obj->sections()) {
+    Expected<StringRef> name = section.getName();
+    if (!name) {
+      consumeError(name.takeError());
+      continue;
+    }
+    if (*name != kStackMapsSection) continue;
+    Expected<StringRef> data = section.getContents();
+    if (!data) {
+      DLOG(ERROR) << "StackMaps: " << toString(data.takeError());
+      return false;
+    }
+    contents = *data;
+    section_address = section.getAddress();
+  }
+
+  SmallVector<char, 0> out;
+  Append<uint32_t>(&out, mcr::LlvmStackMaps::kMagic);
+  if (contents.empty()) {
+    D1LOG(INFO) << "StackMaps: no statepoints: " << file_so;
+    Append<uint32_t>(&out, 0);
+    return LlvmPipeline::WriteFile(file_stackmaps, out);
+  }
+  if (contents[0] != 3) {
+    DLOG(ERROR) << "StackMaps: unsupported version: "
+                << static_cast<int>(contents[0]);
+    return false;
+  }
+
+  ArrayRef<uint8_t> bytes(
+      reinterpret_cast<const uint8_t*>(contents.data()), contents.size());
+  Parser parser(bytes);
+  std::map<uint64_t, uint64_t> relocated;
+  GetRelocatedAddresses(obj, section_address,
+                        section_address + contents.size(), &relocated);
+
+  MallocArenaPool pool;
+  ArenaStack arena_stack(&pool);
+  Append<uint32_t>(&out, parser.getNumFunctions());
+  unsigned first_record = 0;
+  for (unsigned f = 0; f < parser.getNumFunctions(); f++) {
+    const Parser::FunctionAccessor fn = parser.getFunction(f);
+    const unsigned num_records = fn.getRecordCount();
+    uint64_t address = fn.getFunctionAddress();
+    if (address == 0) {
+      address = relocated[section_address + kHeaderSize + kFunctionSize * f];
+    }
+    // x86_64 frames also have the return address (as in quick frames)
+    const uint64_t stack_size = fn.getStackSize();
+    const size_t frame_size = stack_size +
+      (isa == InstructionSet::kX86_64 ? sizeof(uint64_t) : 0);
+
+    std::vector<unsigned> records;
+    for (unsigned r = first_record; r < first_record + num_records; r++) {
+      records.push_back(r);
+    }
+    first_record += num_records;
+    std::sort(records.begin(), records.end(), [&parser](unsigned a, unsigned b) {
+      return parser.getRecord(a).getInstructionOffset() <
+        parser.getRecord(b).getInstructionOffset();
+    });
+
+    ScopedArenaAllocator allocator(&arena_stack);
+    StackMapStream stream(&allocator, isa);
+    stream.BeginMethod(frame_size, 0, 0, 0);
+    bool first = true;
+    uint32_t last_offset = 0;
+    for (unsigned r : records) {
+      const Parser::RecordAccessor record = parser.getRecord(r);
+      const uint32_t offset = record.getInstructionOffset();
+      // a single stack map at a pc (a call can also be at offset 0)
+      if (!first && offset == last_offset) continue;
+      first = false;
+      last_offset = offset;
+
+      ArenaBitVector* stack_mask = ArenaBitVector::Create(
+          &allocator, 0, true, kArenaAllocStackMapStream);
+      if (AddStackMask(parser, record, isa, stack_size, stack_mask) != 0) {
+        DLOG(ERROR) << "StackMaps: a statepoint has references that are not "
+                    << "in stack slots (id: " << record.getID() << "): "
+                    << file_so;
+        return false;
+      }
+      // statepoint-id is the dex pc (HGraphToLLVM::AddStackMaps)
+      const uint64_t id = record.getID();
+      const uint32_t dex_pc = id <= UINT32_MAX ?
+        static_cast<uint32_t>(id) : dex::kDexNoIndex;
+      stream.BeginStackMapEntry(dex_pc, offset, 0, stack_mask);
+      stream.EndStackMapEntry();
+    }
+    stream.EndMethod();
+    ScopedArenaVector<uint8_t> code_info = stream.Encode();
+
+    Append<uint64_t>(&out, address);
+    Append<uint32_t>(&out, code_info.size());
+    out.append(code_info.begin(), code_info.end());
+  }
+
+  D1LOG(INFO) << "StackMaps: " << parser.getNumRecords() << " statepoints in "
+              << parser.getNumFunctions() << " functions: " << file_so;
+  return LlvmPipeline::WriteFile(file_stackmaps, out);
+}
+
+}  // namespace LLVM
+}  // namespace art
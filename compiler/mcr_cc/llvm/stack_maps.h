@@ -0,0 +1,52 @@
+/**
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef ART_COMPILER_LLVM_STACK_MAPS_H_
+#define ART_COMPILER_LLVM_STACK_MAPS_H_
+
+#include <map>
+#include <string>
+#include "arch/instruction_set.h"
+
+namespace llvm {
+namespace object {
+class ObjectFile;
+}  // namespace object
+}  // namespace llvm
+
+namespace art {
+namespace LLVM {
+
+// Dynamic relocations in [begin, end) of an hf.so: offset -> address
+void GetRelocatedAddresses(const ::llvm::object::ObjectFile* obj,
+                           uint64_t begin, uint64_t end,
+                           std::map<uint64_t, uint64_t>* relocated);
+
+/**
+ * @brief Translates the .llvm_stackmaps of an hf.so (the statepoints of
+ *        RewriteStatepointsForGC) to ART's CodeInfo, one for each function.
+ *        They are read by mcr::LlvmStackMaps (see its file format).
+ */
+class StackMaps final {
+ public:
+  static bool Translate(std::string file_so, InstructionSet isa,
+                        std::string file_stackmaps);
+};
+
+}  // namespace LLVM
+}  // namespace art
+
+#endif  // ART_COMPILER_LLVM_STACK_MAPS_H_
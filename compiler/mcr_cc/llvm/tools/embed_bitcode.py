@@ -0,0 +1,42 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Embeds the runtime bitcode library (art_runtime_lib.cc) in a header."""
+
+import sys
+
+def main():
+  if len(sys.argv) != 3:
+    sys.exit("usage: embed_bitcode.py <bitcode> <header>")
+  with open(sys.argv[1], "rb") as f:
+    data = f.read()
+  if data[:4] != b"BC\xc0\xde":
+    sys.exit("embed_bitcode.py: not a bitcode file: " + sys.argv[1])
+
+  with open(sys.argv[2], "w") as out:
+    out.write("// Generated by embed_bitcode.py from %s\n" % sys.argv[1])
+    out.write("#ifndef ART_COMPILER_MCR_CC_LLVM_ART_RUNTIME_LIB_BC_H_\n")
+    out.write("#define ART_COMPILER_MCR_CC_LLVM_ART_RUNTIME_LIB_BC_H_\n\n")
+    out.write("#include <stddef.h>\n\n")
+    out.write("alignas(4) static const unsigned char kArtRuntimeLibBitcode[] = {\n")
+    for i in range(0, len(data), 16):
+      out.write("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",\n")
+    out.write("};\n")
+    out.write("static const size_t kArtRuntimeLibBitcodeSize = %d;\n\n" % len(data))
+    out.write("#endif  // ART_COMPILER_MCR_CC_LLVM_ART_RUNTIME_LIB_BC_H_\n")
+
+if __name__ == "__main__":
+  main()
@@ -45,9 +45,9 @@
 namespace art {
 namespace mcr {
 
-long McrCC::compiled_optimizing_=0;
-std::string McrCC::llvm_entrypoint_function_;
-bool McrCC::recompile_=false;
+std::atomic<long> McrCC::compiled_optimizing_(0);
+std::vector<std::unique_ptr<HotRegion>> McrCC::regions_;
+std::mutex McrCC::recompile_lock_;
 std::set<std::string> McrCC::recompile_reasons_;
 std::set<std::string> McrCC::compilation_warnings_;
 const bool McrCC::auto_update_profiles=true;
@@ -117,8 +117,8 @@ void McrCC::StoreMethodBytecode(const MethodReference method_ref,
 
 /**
  * @brief Read the profile that contains the list of methods to compile.
- *        All these methods constitute a hot region, and the first
- *        method is the entrypoint to that region.
+ *        The methods are grouped in hot regions (see REGION_SEPARATOR),
+ *        and the first method of each region is its entrypoint.
  *
  * This had more complex configuration files that were driving a static
  * bytecode analysis. That analysis is a string-based and slow, therefore
@@ -136,6 +136,10 @@ void McrCC::ReadLlvmProfile() {
     exit(EXIT_FAILURE);
   }
 
+  regions_.clear();
+  HotRegion* region = nullptr;
+  // the rest of a region whose entrypoint is a duplicate
+  bool skip_region = false;
   mcr::FileReader fr(__func__, filename, false, true, true);
   if (fr.exists()) {
     std::vector<std::string> data = fr.GetData();
@@ -144,15 +148,36 @@ void McrCC::ReadLlvmProfile() {
       // ignore empty lines and comments
       if(method.size() == 0) continue;
       else if (method.rfind("#", 0) == 0) continue;
+      else if (method.compare(REGION_SEPARATOR) == 0) {
+        region = nullptr;
+        skip_region = false;
+        continue;
+      }
+      if (skip_region) {
+        DLOG(ERROR) << "Region of a duplicate LLVM entrypoint: skipping: "
+          << method;
+        continue;
+      }
+
+      // the first method of a region is its entrypoint
+      if (region == nullptr && GetRegion(method) != nullptr) {
+        DLOG(ERROR) << "Duplicate LLVM entrypoint: skipping its region: "
+          << method;
+        skip_region = true;
+        continue;
+      }
 
       addedMethods++;
       if(addedMethods <= maxHFs) {
         // Add method to profile
         McrRT::hot_functions_.insert(method);
 
-        // the first method is the entrypoint
-        if(addedMethods==1) SetLlvmEntrypoint(method);
-
+        if (region == nullptr) {
+          regions_.emplace_back(new HotRegion(method));
+          region = regions_.back().get();
+        } else {
+          region->AddMethod(method);
+        }
       } else { 
         DLOG(ERROR) << "maxHFs reached: skipping: " << method;
       }
@@ -164,7 +189,29 @@ void McrCC::ReadLlvmProfile() {
     exit(EXIT_FAILURE);
   }
 
-  DLOG(INFO) << "LLVM entrypoint method: '" << GetLlvmEntrypoint() << "'";
+  for (const std::unique_ptr<HotRegion>& r : regions_) {
+    DLOG(INFO) << "LLVM entrypoint method: '" << r->GetEntrypoint() << "'"
+      << " (" << r->GetMethods().size() << " hot methods)";
+  }
+}
+
+HotRegion* McrCC::GetRegion(std::string entrypoint) {
+  for (const std::unique_ptr<HotRegion>& region : regions_) {
+    if (region->GetEntrypoint().compare(entrypoint) == 0) {
+      return region.get();
+    }
+  }
+  return nullptr;
+}
+
+std::vector<HotRegion*> McrCC::GetRegionsOf(std::string pretty_method) {
+  std::vector<HotRegion*> regions;
+  for (const std::unique_ptr<HotRegion>& region : regions_) {
+    if (region->Contains(pretty_method)) {
+      regions.push_back(region.get());
+    }
+  }
+  return regions;
 }
 
 bool McrCC::isHot(std::string pretty_method) {
@@ -217,12 +264,24 @@ void McrCC::AppendToProfile(std::set<std::string> newmethods) {
 }
 
 void McrCC::AddRecompilationReason(std::string reason) {
-  recompile_ = true;
+  std::lock_guard<std::mutex> lock(recompile_lock_);
   recompile_reasons_.insert(reason);
 }
 
+bool McrCC::MustRecompile() {
+  {
+    std::lock_guard<std::mutex> lock(recompile_lock_);
+    if (!recompile_reasons_.empty()) return true;
+  }
+  for (const std::unique_ptr<HotRegion>& region : regions_) {
+    if (!region->GetRecompilationReasons().empty()) return true;
+  }
+  return false;
+}
+
 inline void PrintCentered(std::stringstream &ss, std::string str, int width) {
   int spaces=(width-str.size())/2;
+  if (spaces < 0) spaces = 0;
   ss << "\n||" << std::string(spaces, ' ');
   ss << str;
   ss << std::string(spaces, ' ');
@@ -231,13 +290,24 @@ inline void PrintCentered(std::stringstream &ss, std::string str, int width) {
 }
 
 void McrCC::DieWithRecompilationReport() {
-  if(recompile_) {
+  if(MustRecompile()) {
     const int linewidth = 50;
     std::stringstream ss;
     ss << "\n++" << std::string(linewidth, '=') << "++";
     PrintCentered(ss, "RECOMPILATION NEEDED:", linewidth);
-    for(std::string reason: mcr::McrCC::recompile_reasons_) {
-      PrintCentered(ss, reason, linewidth);
+    {
+      std::lock_guard<std::mutex> lock(recompile_lock_);
+      for(std::string reason: recompile_reasons_) {
+        PrintCentered(ss, reason, linewidth);
+      }
+    }
+    for (const std::unique_ptr<HotRegion>& region : regions_) {
+      std::set<std::string> reasons = region->GetRecompilationReasons();
+      if (reasons.empty()) continue;
+      PrintCentered(ss, "region: " + region->GetEntrypointStripped(), linewidth);
+      for(std::string reason: reasons) {
+        PrintCentered(ss, reason, linewidth);
+      }
     }
     ss << "\n++" << std::string(linewidth, '=') << "++";
 
@@ -317,7 +387,7 @@ void McrCC::StoreMethodsToFile(std::set<std::string> methods, std::string filena
 }
 
 bool McrCC::IsLlvmEntrypoint(std::string method) {
-  return (method.compare(llvm_entrypoint_function_) == 0);
+  return GetRegion(method) != nullptr;
 }
 
 std::string McrCC::PrettyMethod(art::HGraph* graph) {
@@ -17,13 +17,18 @@
 #ifndef ART_COMPILER_MCR_CC_H_
 #define ART_COMPILER_MCR_CC_H_
 
+#include <atomic>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <vector>
 #include <android-base/logging.h>
 
 #include "base/macros.h"
 #include "dex/dex_file.h"
 #include "dex/method_reference.h"
+#include "mcr_cc/hot_region.h"
 #include "mcr_rt/invoke_info.h"
 #include "mcr_rt/mcr_rt.h"
 
@@ -31,11 +36,10 @@
 #define SMALLEST_CODE_SIZE 0
 #define MCR_MAX_HFS 500
 
-#define F_LLVM_PROFILE "/profile"
-
 #define COMP_TYPE_GEN_LLVM_BITCODE "llvm-gen-bitcode"
 #define COMP_TYPE_LLVM_BASELINE "llvm-base"
 
+#define HFregionbc "hf.region.bc"
 #define HFlnkbc "hf.lnk.bc"
 #define HFdcebc "hf.lnk.dce.bc"
 #define HFoptbc "hf.lnk.opt.bc"
@@ -74,7 +78,7 @@ class McrCC final {
   static bool isHot(std::string pretty_method);
   static void AppendToProfile(std::set<std::string> methods);
   static void AddRecompilationReason(std::string reason);
-  static bool MustRecompile() { return recompile_; }
+  static bool MustRecompile();
   static void DieWithRecompilationReport();
   static std::string popTopHotFunction(std::set<std::string>* profileDataRaw);
 
@@ -87,29 +91,22 @@ class McrCC final {
   }
 
   /**
-   * This method will be the outermost method of an LLVM hot region
-   * (or the entrypoint to LLVM).
-   * During an LLVM compilation, one such hot region is targetted.
-   *
-   * Multiple compilations could be performed with some adaptations
-   * to the codethough, for generating LLVM bitcode for multiple hot regions.
+   * The profile lists the hot regions of an app. The first method of
+   * each region is its LLVM entrypoint (the outermost method),
+   * and regions are separated by a line with REGION_SEPARATOR.
+   * A profile without separators is a single hot region.
    *
-   * i.e., having a list of llvm_entrypoint methods, and a separate list
-   * for the hot methods (which could also be derived with some static analysis,
-   * or dynamic through the InvokeHistograms)
+   * Each region is generated, linked and compiled to its own hf.so.
    */
-  static void SetLlvmEntrypoint(std::string hf) {
-    llvm_entrypoint_function_=hf;
+  static const std::vector<std::unique_ptr<HotRegion>>& GetRegions() {
+    return regions_;
   }
 
-  static std::string GetLlvmEntrypoint() {
-    return llvm_entrypoint_function_;
-  }
-
-  static std::string GetLlvmEntrypointStripped() {
-    return StripHf(GetLlvmEntrypoint());
-  }
+  static HotRegion* GetRegion(std::string entrypoint);
+  // regions that list pretty_method as hot
+  static std::vector<HotRegion*> GetRegionsOf(std::string pretty_method);
 
+  // whether it is the LLVM entrypoint of any region
   static bool IsLlvmEntrypoint(std::string method);
 
   static std::string GetProfileMain();
@@ -128,14 +125,15 @@ class McrCC final {
 
   static std::string PrettyMethod(art::HGraph* graph);
 
-  static long compiled_optimizing_;
-  static bool recompile_;
-  static std::set<std::string> recompile_reasons_;
+  static std::atomic<long> compiled_optimizing_;
   static std::set<std::string> compilation_warnings_;
   static const bool auto_update_profiles;
 
  private: 
-  static std::string llvm_entrypoint_function_;
+  static std::vector<std::unique_ptr<HotRegion>> regions_;
+  // reasons that are not about a specific region (see HotRegion)
+  static std::mutex recompile_lock_;
+  static std::set<std::string> recompile_reasons_;
 };
 
 }  // namespace mcr
@@ -47,7 +47,57 @@ void PassManager::LoadLlvmCompilationFlags() {
   // IR-to-IR translation
   mcr::PassManager::SetBackend("hgraph-llvm");
 
-  // Here one could load additional flags (i.e., for iterative compilation)
+  std::string plan = GetFileApp(FILE_COMPILE_PLAN);
+  if (ReadPlan(plan, &ic_flags_opt_, &ic_flags_llc_)) {
+    DLOG(INFO) << "PassManager: " << plan << ": opt: " << ic_flags_opt_
+      << " llc: " << ic_flags_llc_;
+  }
+}
+
+std::string PassManager::GetCompilationFlagsOPT(std::string entrypoint) {
+  std::string opt_flags, llc_flags;
+  if (ReadPlan(GetFileSrc(entrypoint, FILE_COMPILE_PLAN),
+               &opt_flags, &llc_flags)) {
+    return opt_flags;
+  }
+  return ic_flags_opt_;
+}
+
+std::string PassManager::GetCompilationFlagsLLC(std::string entrypoint) {
+  std::string opt_flags, llc_flags;
+  if (ReadPlan(GetFileSrc(entrypoint, FILE_COMPILE_PLAN),
+               &opt_flags, &llc_flags)) {
+    return llc_flags;
+  }
+  return ic_flags_llc_;
+}
+
+bool PassManager::ReadPlan(std::string filename, std::string* opt_flags,
+                           std::string* llc_flags) {
+  std::ifstream in(filename);
+  if (!in) return false;
+  opt_flags->clear();
+  llc_flags->clear();
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.compare(0, 4, "opt:") == 0) {
+      *opt_flags = line.substr(4);
+    } else if (line.compare(0, 4, "llc:") == 0) {
+      *llc_flags = line.substr(4);
+    }
+  }
+  return true;
+}
+
+bool PassManager::WritePlan(std::string filename, std::string opt_flags,
+                            std::string llc_flags) {
+  std::ofstream out(filename, std::ios::trunc);
+  if (!out) {
+    DLOG(ERROR) << "PassManager: can't write: " << filename;
+    return false;
+  }
+  out << "opt: " << opt_flags << "\n" << "llc: " << llc_flags << "\n";
+  return static_cast<bool>(out);
 }
 
 }  // namespace mcr
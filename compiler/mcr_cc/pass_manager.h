@@ -20,7 +20,10 @@
 #include <string>
 #include <vector>
 
-// This could be used in an iterative-compilation scenario to set the ic_flags
+// Flags of an iterative-compilation scenario (ic_flags). The one of the app
+// applies to all regions, unless a region has its own (in its src dir).
+//   opt: <opt flags>
+//   llc: <llc flags>
 #define FILE_COMPILE_PLAN "plan.comp"
 
 namespace art {
@@ -38,6 +41,15 @@ class PassManager {
     return ic_flags_llc_;
   }
 
+  // The plan of the region, or the one of the app
+  static std::string GetCompilationFlagsOPT(std::string entrypoint);
+  static std::string GetCompilationFlagsLLC(std::string entrypoint);
+
+  static bool WritePlan(std::string filename, std::string opt_flags,
+                        std::string llc_flags);
+  static bool ReadPlan(std::string filename, std::string* opt_flags,
+                       std::string* llc_flags);
+
   static void SetBaseline(std::string baseline);
   
   static void SetBackend(std::string backend) {
@@ -71,10 +71,14 @@
 #ifdef ART_MCR_COMPILE_OS_METHODS
 #include "mcr_cc/os_comp.h"
 #endif
+#include "class_linker.h"
+#include "mcr_cc/compilation_cache.h"
 #include "mcr_cc/llvm/hgraph_to_llvm-inl.h"
 #include "mcr_cc/llvm/hgraph_to_llvm.h"
 #include "mcr_cc/llvm/llvm_compilation_unit.h"
 #include "mcr_cc/llvm/llvm_compiler.h"
+#include "mcr_cc/llvm/llvm_jit.h"
+#include "mcr_cc/llvm/llvm_region.h"
 #include "mcr_cc/match.h"
 #include "mcr_rt/oat_aux.h"
 #endif
@@ -304,7 +308,26 @@ class OptimizingCompiler final : public Compiler {
       ArtMethod* method,
       bool baseline,
       bool osr,
-      VariableSizedHandleScope* handles) const;
+      VariableSizedHandleScope* handles,
+      LLVM::LlvmRegion* jit_region = nullptr,
+      const std::vector<const DexFile*>* jit_dex_files = nullptr) const;
+
+  bool CompileToLLVMRegion(
+      CodeGenerator* codegen,
+      HGraphFilePrettyPrinter* hgraph_printer,
+      HGraph* graph,
+      const DexCompilationUnit& dex_compilation_unit,
+      std::string pretty_method) const;
+
+  bool GenerateInRegion(
+      CodeGenerator* codegen,
+      HGraphFilePrettyPrinter* hgraph_printer,
+      HGraph* graph,
+      const DexCompilationUnit& dex_compilation_unit,
+      std::string pretty_method,
+      LLVM::LlvmRegion* region,
+      const std::vector<const DexFile*>* app_dex_files,
+      std::set<std::string>* link_dependencies) const;
 #endif
 
   CompiledMethod* JniCompile(uint32_t access_flags,
@@ -327,6 +350,12 @@ class OptimizingCompiler final : public Compiler {
       override
       REQUIRES_SHARED(Locks::mutator_lock_);
 
+#ifdef ART_MCR
+  void* JitCompileLLVM(Thread* self, ArtMethod* method)
+      override
+      REQUIRES_SHARED(Locks::mutator_lock_);
+#endif
+
  private:
   bool RunOptimizations(HGraph* graph,
                         CodeGenerator* codegen,
@@ -1099,7 +1128,9 @@ bool OptimizingCompiler::CompileToLLVM(
     ArtMethod* method,
     bool baseline,
     bool osr,
-    VariableSizedHandleScope* handles) const { 
+    VariableSizedHandleScope* handles,
+    LLVM::LlvmRegion* jit_region,
+    const std::vector<const DexFile*>* jit_dex_files) const {
   MaybeRecordStat(compilation_stats_.get(), MethodCompilationStat::kAttemptBytecodeCompilation);
   const CompilerOptions& compiler_options = GetCompilerOptions();
   InstructionSet instruction_set = compiler_options.GetInstructionSet();
@@ -1135,6 +1166,17 @@ bool OptimizingCompiler::CompileToLLVM(
     return false;
   }
 
+  // The region module is kept in memory: nothing is cached per method
+  std::string cache_key;
+  if (mcr::CompilationCache::IsEnabled() && !McrDebug::RegionModule() &&
+      jit_region == nullptr) {
+    cache_key = mcr::CompilationCache::GetMethodKey(
+        dex_file, method_idx, code_item, compiler_options);
+    if (mcr::CompilationCache::LoadMethod(cache_key, pretty_method)) {
+      return true;
+    }
+  }
+
   CodeItemDebugInfoAccessor code_item_accessor(dex_file, code_item, method_idx);
 
   bool dead_reference_safe;
@@ -1262,6 +1304,27 @@ bool OptimizingCompiler::CompileToLLVM(
                     regalloc_strategy,
                     compilation_stats_.get());
 
+  // LLVM JIT tier: a region of a single method, compiled by LLVM::LlvmJit
+  if (jit_region != nullptr) {
+    std::set<std::string> link_dependencies;
+    if (!GenerateInRegion(codegen.get(), &hgraph_printer, graph,
+          dex_compilation_unit, pretty_method, jit_region, jit_dex_files,
+          &link_dependencies)) {
+      return false;
+    }
+    // nothing else is in the module
+    for (const std::string& callee : link_dependencies) {
+      DLOG(ERROR) << "LlvmJit: " << pretty_method
+        << ": calls a hot method: " << callee;
+    }
+    return link_dependencies.empty();
+  }
+
+  if (McrDebug::RegionModule()) {
+    return CompileToLLVMRegion(codegen.get(), &hgraph_printer, graph,
+        dex_compilation_unit, pretty_method);
+  }
+
   DLOG(INFO) << "Creating innerCU: "
     << invType << ":" << pretty_method;
   LLVM::LLVMCompilationUnit innerCU =
@@ -1292,8 +1355,84 @@ bool OptimizingCompiler::CompileToLLVM(
       outerCU.StoreBitcode();
     }
   }
+  if (OK && !cache_key.empty()) {
+    mcr::CompilationCache::StoreMethod(cache_key, pretty_method);
+  }
+  return OK;
+}
+
+/**
+ * @brief Generates the method into the shared module of each hot region
+ *        that lists it (see LLVM::LlvmRegion). Nothing is stored per method.
+ *        Only the LLVM entrypoint of a region needs an outer method.
+ */
+bool OptimizingCompiler::CompileToLLVMRegion(
+    CodeGenerator* codegen,
+    HGraphFilePrettyPrinter* hgraph_printer,
+    HGraph* graph,
+    const DexCompilationUnit& dex_compilation_unit,
+    std::string pretty_method) const {
+  const CompilerOptions& compiler_options = GetCompilerOptions();
+  bool OK = true;
+  for (mcr::HotRegion* hot_region : mcr::McrCC::GetRegionsOf(pretty_method)) {
+    LLVM::LlvmRegion* region = LLVM::LlvmRegion::Get(hot_region->GetEntrypoint());
+    std::lock_guard<std::mutex> lock(region->GetLock());
+
+    std::set<std::string> link_dependencies;
+    bool verified = GenerateInRegion(codegen, hgraph_printer, graph,
+        dex_compilation_unit, pretty_method, region,
+        compiler_options.GetAppDexFiles(), &link_dependencies);
+    region->AddMethod(pretty_method, verified, link_dependencies);
+    OK &= verified;
+  }
   return OK;
 }
+
+/**
+ * @brief Generates the inner method in the module of a region, and its
+ *        outer method if it is the LLVM entrypoint of the region.
+ *        Returns whether its functions verify (the module is verified
+ *        once, in LlvmRegion::Store).
+ */
+bool OptimizingCompiler::GenerateInRegion(
+    CodeGenerator* codegen,
+    HGraphFilePrettyPrinter* hgraph_printer,
+    HGraph* graph,
+    const DexCompilationUnit& dex_compilation_unit,
+    std::string pretty_method,
+    LLVM::LlvmRegion* region,
+    const std::vector<const DexFile*>* app_dex_files,
+    std::set<std::string>* link_dependencies) const {
+  const std::string& entrypoint = region->GetEntrypoint();
+  std::set<const ::llvm::Function*> previous;
+  for (const ::llvm::Function& F : *region->GetModule()) {
+    if (!F.isDeclaration()) previous.insert(&F);
+  }
+
+  DLOG(INFO) << "Creating innerCU (region): " << pretty_method
+    << "\nRegion: " << entrypoint;
+  LLVM::LLVMCompilationUnit innerCU =
+    LLVM::LLVMCompilationUnit(
+        codegen, hgraph_printer, app_dex_files,
+        pretty_method, false, region);
+  LLVM::HGraphToLLVM gen_inner(
+      graph, dex_compilation_unit, &innerCU);
+  gen_inner.ExpandIR();
+
+  if (entrypoint.compare(pretty_method) == 0) {
+    DLOG(INFO) << "Creating outerCU (region): " << pretty_method;
+    LLVM::LLVMCompilationUnit outerCU =
+      LLVM::LLVMCompilationUnit(
+          codegen, hgraph_printer, app_dex_files,
+          pretty_method, true, region);
+    LLVM::HGraphToLLVM gen_outer(
+        graph, dex_compilation_unit, &outerCU, &innerCU);
+    gen_outer.ExpandIR();
+  }
+
+  *link_dependencies = innerCU.GetLinkDependencies();
+  return innerCU.VerifyNewFunctions(previous);
+}
 #endif
 
 CompiledMethod* OptimizingCompiler::Compile(const dex::CodeItem* code_item,
@@ -1805,6 +1944,87 @@ bool OptimizingCompiler::JitCompile(Thread* self,
   return true;
 }
 
+#ifdef ART_MCR
+/**
+ * @brief The LLVM JIT tier: generates a hot method (that has JIT code
+ *        already) like a hot region of its own (LLVM::LlvmRegion::Create),
+ *        and compiles it in the process with LLVM::LlvmJit.
+ *        Returns its LLVM entrypoint (llvm_live_), or nullptr.
+ *
+ * Hot callees are not in the module: only methods that call none are
+ * compiled (their invokes go through the runtime).
+ */
+void* OptimizingCompiler::JitCompileLLVM(Thread* self, ArtMethod* method) {
+  StackHandleScope<2> hs(self);
+  Handle<mirror::ClassLoader> class_loader(hs.NewHandle(
+      method->GetDeclaringClass()->GetClassLoader()));
+  Handle<mirror::DexCache> dex_cache(hs.NewHandle(method->GetDexCache()));
+  DCHECK(method->IsCompilable());
+  if (method->IsNative()) {
+    return nullptr;
+  }
+
+  const DexFile* dex_file = method->GetDexFile();
+  const dex::CodeItem* code_item = dex_file->GetCodeItem(method->GetCodeItemOffset());
+  const std::string pretty_method = method->PrettyMethod();
+
+  Runtime* runtime = Runtime::Current();
+  ClassLinker* class_linker = runtime->GetClassLinker();
+  // There is no dex2oat: speculated callees are in the loaded app dex files
+  std::vector<const DexFile*> app_dex_files;
+  {
+    ReaderMutexLock mu(self, *Locks::dex_lock_);
+    for (const ClassLinker::DexCacheData& data : class_linker->GetDexCachesData()) {
+      if (data.IsValid() &&
+          !mcr::McrRT::IsFrameworkDexLocation(data.dex_file->GetLocation())) {
+        app_dex_files.push_back(data.dex_file);
+      }
+    }
+  }
+
+  ArenaAllocator allocator(runtime->GetJitArenaPool());
+  ArenaStack arena_stack(runtime->GetJitArenaPool());
+  CodeVectorAllocator code_allocator(&allocator);
+  VariableSizedHandleScope handles(self);
+  std::unique_ptr<LLVM::LlvmRegion> region(LLVM::LlvmRegion::Create(pretty_method));
+
+  Handle<mirror::Class> compiling_class = handles.NewHandle(method->GetDeclaringClass());
+  DexCompilationUnit dex_compilation_unit(
+      class_loader,
+      class_linker,
+      *dex_file,
+      code_item,
+      method->GetClassDefIndex(),
+      method->GetDexMethodIndex(),
+      method->GetAccessFlags(),
+      /*verified_method=*/ nullptr,
+      dex_cache,
+      compiling_class);
+
+  // Go to native so that we don't block GC during compilation.
+  ScopedThreadSuspension sts(self, kNative);
+  if (!CompileToLLVM(&allocator,
+                     &arena_stack,
+                     &code_allocator,
+                     dex_compilation_unit,
+                     method,
+                     /* baseline= */ false,
+                     /* osr= */ false,
+                     &handles,
+                     region.get(),
+                     &app_dex_files)) {
+    return nullptr;
+  }
+
+  LLVM::LlvmJit* llvm_jit =
+    LLVM::LlvmJit::Get(GetCompilerOptions().GetInstructionSet());
+  if (llvm_jit == nullptr) {
+    return nullptr;
+  }
+  return llvm_jit->AddMethod(pretty_method, region.get());
+}
+#endif
+
 void OptimizingCompiler::GenerateJitDebugInfo(ArtMethod* method ATTRIBUTE_UNUSED,
                                               const debug::MethodDebugInfo& info) {
   const CompilerOptions& compiler_options = GetCompilerOptions();
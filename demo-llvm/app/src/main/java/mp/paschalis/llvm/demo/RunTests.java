@@ -59,6 +59,7 @@ public class RunTests {
     TestConditions.RunTests();
     BinaryOperations.RunTests();
     TestLoops.RunTests();
+    TestSafepoints.RunTests();
 
     TestPackedSwitch.Run();
   }
@@ -92,6 +93,11 @@ public class RunTests {
   public void CheckNull() {
     TestNullCheck.RunTest();
   }
+
+  // needs opt.implicit_checks
+  public void CheckImplicit() {
+    TestImplicitChecks.RunTest();
+  }
   public void ChecksOutOfBounds(int n) {
     TestOutOfBounds.RunTest(n) ;
   }
@@ -136,6 +142,7 @@ public class RunTests {
     TestVecLong.main(null);
     TestVecFloat.main(null);
     TestVecDouble.main(null);
+    TestVecIdioms.main(null);
   }
 
   public void Exceptions() {
@@ -151,6 +158,11 @@ public class RunTests {
     TestNewInstance.RunTests();
   }
 
+  // needs llvm.jit
+  public void LlvmJit() {
+    TestLlvmJit.RunTests();
+  }
+
   private String res(int resource) {
     return ctx.getString(resource);
   }
@@ -219,6 +231,8 @@ public class RunTests {
       CheckDivZero(4);
     } else if (Match(value, R.string.test_check_null)) {
       CheckNull();
+    } else if (Match(value, R.string.test_check_implicit)) {
+      CheckImplicit();
     } else if (Match(value, R.string.test_check_outofbounds)) {
       ChecksOutOfBounds(0);
     } else if (Match(value, R.string.test_check_outofbounds_t0)) {
@@ -253,6 +267,8 @@ public class RunTests {
       TryCatch();
     } else if (Match(value, R.string.test_newinstance)) {
       NewInstance();
+    } else if (Match(value, R.string.test_llvm_jit)) {
+      LlvmJit();
     } else if (Match(value, R.string.DIVISOR_LINE)) {
       // ignore the ------
       return;
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2021 Paschalis Mpeis
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package mp.paschalis.llvm.demo;
+
+/**
+ * Implicit checks of LLVM code (opt.implicit_checks): null checks that
+ * throw a NullPointerException (caught in the method, or by the caller),
+ * and a StackOverflowError of the stack probe of a recursive method.
+ *
+ * Without the option the null checks of LLVM code are elided: it dies.
+ */
+public class TestImplicitChecks {
+  int value;
+
+  TestImplicitChecks(int value) {
+    this.value = value;
+  }
+
+  // the NullPointerException goes to the catch block of the method
+  static int fieldInTry(TestImplicitChecks t) {
+    try {
+      return t.value;
+    } catch (NullPointerException e) {
+      return -1;
+    }
+  }
+
+  // the NullPointerException leaves the LLVM frames
+  static int field(TestImplicitChecks t) {
+    return t.value + 1;
+  }
+
+  static int recurse(int n) {
+    return recurse(n + 1) + 1;
+  }
+
+  static void RunTest() {
+    TestImplicitChecks t = new TestImplicitChecks(7);
+    check(fieldInTry(t) == 7, "fieldInTry");
+    check(fieldInTry(null) == -1, "fieldInTry: null");
+
+    check(field(t) == 8, "field");
+    boolean thrown = false;
+    try {
+      field(null);
+    } catch (NullPointerException e) {
+      thrown = true;
+    }
+    check(thrown, "field: null");
+
+    thrown = false;
+    try {
+      recurse(0);
+    } catch (StackOverflowError e) {
+      thrown = true;
+    }
+    check(thrown, "recurse: StackOverflowError");
+  }
+
+  private static void check(boolean passed, String msg) {
+    CheckTest.Run("TestImplicitChecks", msg, passed);
+  }
+}
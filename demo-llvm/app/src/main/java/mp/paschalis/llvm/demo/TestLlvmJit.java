@@ -0,0 +1,98 @@
+/*
+ * Copyright 2021 Paschalis Mpeis
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package mp.paschalis.llvm.demo;
+
+import android.util.Log;
+
+import static mp.paschalis.llvm.demo.Debug.TAG;
+
+/**
+ * The LLVM JIT tier (llvm.jit, without llvm.enabled): hot methods that
+ * allocate, read static fields, and load classes and strings.
+ *
+ * The JIT sharpens these loads to kJitBootImageAddress (boot image classes
+ * and strings) and kJitTableAddress (the rest, through the runtime in LLVM
+ * code). The methods run in rounds, so that they get hot and are compiled by
+ * LLVM in the background while the results are checked.
+ */
+public class TestLlvmJit {
+  static final int ROUNDS = 40;
+  static final int CALLS = 5000;
+
+  static final String NAME = "llvm-jit";
+
+  // another class than the referrer, so not kReferrersClass
+  static class Holder {
+    static int counter = 3;
+    int value;
+  }
+  static Holder last;  // the allocation escapes
+
+  // new-instance of an app class (kJitTableAddress)
+  static int newInstance(int v) {
+    Holder h = new Holder();
+    h.value = v;
+    last = h;
+    return h.value * 2;
+  }
+
+  // static field of an app class (kJitTableAddress, clinit check)
+  static int staticField(int v) {
+    return Holder.counter + v;
+  }
+
+  // a boot image class (kJitBootImageAddress)
+  static boolean bootClass(Object o) {
+    return o instanceof String;
+  }
+
+  // a boot image string and an app string
+  static int strings(int v) {
+    String s = (v & 1) == 0 ? "" : NAME;
+    return s.length();
+  }
+
+  static void RunTests() {
+    int failed = 0;
+    for (int r = 0; r < ROUNDS && failed == 0; r++) {
+      for (int i = 0; i < CALLS; i++) {
+        if (newInstance(i) != i * 2) failed++;
+        if (staticField(i) != 3 + i) failed++;
+        if (!bootClass(NAME) || bootClass(i)) failed++;
+        if (strings(i) != ((i & 1) == 0 ? 0 : NAME.length())) failed++;
+      }
+      try {
+        Thread.sleep(10);  // the JIT compiles in the background
+      } catch (InterruptedException e) {
+        break;
+      }
+    }
+    Log.i(TAG, "TestLlvmJit: rounds: " + ROUNDS + ": failed: " + failed);
+    check(failed == 0, "newInstance/staticField/bootClass/strings");
+  }
+
+  private static void check(boolean passed, String msg) {
+    Class thisClass = new Object(){}.getClass();
+    String className = thisClass.getEnclosingClass().getSimpleName();
+    msg = className + ": " + msg;
+    if (!passed) {
+      CheckTest.RunAndroidTestFailed(msg);
+    } else {
+      CheckTest.RunAndroidTestPassedSilent(msg);
+    }
+  }
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright 2021 Paschalis Mpeis
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package mp.paschalis.llvm.demo;
+
+import android.util.Log;
+
+import static mp.paschalis.llvm.demo.Debug.TAG;
+
+/**
+ * Suspend checks of LLVM loops (opt.safepoints): a short loop (no check),
+ * an inner loop that relies on the check of its outer loop, and a long
+ * loop that polls with a counter.
+ *
+ * The pause latency is measured while a worker thread spins in a tight
+ * hot loop: each getStackTrace of the worker runs a checkpoint on it,
+ * which waits until the worker reaches a suspend check.
+ */
+public class TestSafepoints {
+  static final int OUTER = 300;
+  static final int INNER = 512;
+  static final long SPIN = 1L << 31;
+  static final int ROUNDS = 20;
+  static final long MAX_PAUSE_MS = 500;
+
+  // trip count 8: no suspend check
+  static int shortLoop(int x) {
+    int res = x;
+    for (int i = 0; i < 8; i++) {
+      res = res * 31 + i;
+    }
+    return res;
+  }
+
+  // the inner loop relies on the suspend check of the outer loop
+  static long nestedLoop(int[] a) {
+    long res = 0;
+    for (int i = 0; i < OUTER; i++) {
+      for (int j = 0; j < INNER; j++) {
+        res += a[j] ^ i;
+      }
+    }
+    return res;
+  }
+
+  // unknown trip count: polls every few iterations
+  static long spin(long n) {
+    long res = 1;
+    for (long i = 0; i < n; i++) {
+      res = res * 6364136223846793005L + i;
+    }
+    return res;
+  }
+
+  public static void RunTests() {
+    int expected = 5;
+    for (int i = 0; i < 8; i++) {
+      expected = expected * 31 + i;
+    }
+    expectEquals(expected, shortLoop(5), "shortLoop");
+
+    int[] a = new int[INNER];
+    for (int j = 0; j < INNER; j++) {
+      a[j] = j * 7 - 100;
+    }
+    long nested = 0;
+    for (int i = 0; i < OUTER; i++) {
+      for (int j = 0; j < INNER; j++) {
+        nested += a[j] ^ i;
+      }
+    }
+    expectEquals(nested, nestedLoop(a), "nestedLoop");
+
+    long small = 1;
+    for (long i = 0; i < 1000; i++) {
+      small = small * 6364136223846793005L + i;
+    }
+    expectEquals(small, spin(1000), "spin");
+
+    RunPauseLatency();
+  }
+
+  static void RunPauseLatency() {
+    Thread worker = new Thread(new Runnable() {
+      @Override
+      public void run() {
+        spin(SPIN);
+      }
+    });
+    worker.start();
+
+    long maxPause = 0;
+    int rounds = 0;
+    try {
+      Thread.sleep(50);
+      while (worker.isAlive() && rounds < ROUNDS) {
+        long start = System.nanoTime();
+        worker.getStackTrace();  // checkpoint on the worker
+        long pause = (System.nanoTime() - start) / 1000000;
+        maxPause = Math.max(maxPause, pause);
+        rounds++;
+        Thread.sleep(10);
+      }
+      worker.join();
+    } catch (InterruptedException e) {
+      check(false, "interrupted");
+      return;
+    }
+
+    Log.i(TAG, "TestSafepoints: pauses: " + rounds + ": max: " + maxPause
+        + "ms");
+    check(maxPause <= MAX_PAUSE_MS, "Pause latency: " + maxPause + "ms");
+    check(!worker.isAlive(), "worker done");
+  }
+
+  private static void expectEquals(long expected, long result, String action) {
+    check(expected == result, "Expected: " + expected + ", found: " + result
+        + " for " + action);
+  }
+
+  private static void check(boolean passed, String msg) {
+    Class thisClass = new Object(){}.getClass();
+    String className = thisClass.getEnclosingClass().getSimpleName();
+    msg = className + ": " + msg;
+    if (!passed) {
+      CheckTest.RunAndroidTestFailed(msg);
+    } else {
+      CheckTest.RunAndroidTestPassedSilent(msg);
+    }
+  }
+}
@@ -0,0 +1,393 @@
+package mp.paschalis.llvm.demo;
+
+/*
+ * Copyright (C) 2021 Paschalis Mpeis
+ * Copyright (C) 2017 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Functional tests for the SIMD idioms of HLoopOptimization:
+ * halving add, SAD, dot product, reductions, min/max, abs, and
+ * multiply-accumulate (from art/test 646, 660, 661, 679, 684, 550).
+ *
+ * The kernels are the hot methods (compiled with LLVM), while the
+ * expected values are computed by the test driver (quick code),
+ * one element at a time.
+ */
+public class TestVecIdioms {
+  static final int N = 259;  // not a multiple of any vector length
+
+  //
+  // Halving add.
+  //
+
+  /// CHECK-START-ARM64: void Main.halving_add_signed(byte[], byte[], byte[]) loop_optimization (after)
+  /// CHECK-DAG: VecHalvingAdd [{{d\d+}},{{d\d+}}] packed_type:Int8 rounded:false loop:<<Loop:B\d+>> outer_loop:none
+  static void halving_add_signed(byte[] b1, byte[] b2, byte[] bo) {
+    int min_length = Math.min(bo.length, Math.min(b1.length, b2.length));
+    for (int i = 0; i < min_length; i++) {
+      bo[i] = (byte) ((b1[i] + b2[i]) >> 1);
+    }
+  }
+
+  /// CHECK-START-ARM64: void Main.halving_add_unsigned(byte[], byte[], byte[]) loop_optimization (after)
+  /// CHECK-DAG: VecHalvingAdd [{{d\d+}},{{d\d+}}] packed_type:Uint8 rounded:false loop:<<Loop:B\d+>> outer_loop:none
+  static void halving_add_unsigned(byte[] b1, byte[] b2, byte[] bo) {
+    int min_length = Math.min(bo.length, Math.min(b1.length, b2.length));
+    for (int i = 0; i < min_length; i++) {
+      bo[i] = (byte) (((b1[i] & 0xff) + (b2[i] & 0xff)) >> 1);
+    }
+  }
+
+  /// CHECK-START-ARM64: void Main.rounding_halving_add_signed(short[], short[], short[]) loop_optimization (after)
+  /// CHECK-DAG: VecHalvingAdd [{{d\d+}},{{d\d+}}] packed_type:Int16 rounded:true loop:<<Loop:B\d+>> outer_loop:none
+  static void rounding_halving_add_signed(short[] s1, short[] s2, short[] so) {
+    int min_length = Math.min(so.length, Math.min(s1.length, s2.length));
+    for (int i = 0; i < min_length; i++) {
+      so[i] = (short) ((s1[i] + s2[i] + 1) >> 1);
+    }
+  }
+
+  /// CHECK-START-ARM64: void Main.rounding_halving_add_unsigned(char[], char[], char[]) loop_optimization (after)
+  /// CHECK-DAG: VecHalvingAdd [{{d\d+}},{{d\d+}}] packed_type:Uint16 rounded:true loop:<<Loop:B\d+>> outer_loop:none
+  static void rounding_halving_add_unsigned(char[] c1, char[] c2, char[] co) {
+    int min_length = Math.min(co.length, Math.min(c1.length, c2.length));
+    for (int i = 0; i < min_length; i++) {
+      co[i] = (char) ((c1[i] + c2[i] + 1) >> 1);
+    }
+  }
+
+  //
+  // SAD.
+  //
+
+  /// CHECK-START-ARM64: int Main.sadByte2Int(byte[], byte[]) loop_optimization (after)
+  /// CHECK-DAG: VecSADAccumulate loop:<<Loop:B\d+>> outer_loop:none
+  /// CHECK-DAG: VecReduce        loop:none
+  /// CHECK-DAG: VecExtractScalar loop:none
+  static int sadByte2Int(byte[] b1, byte[] b2) {
+    int min_length = Math.min(b1.length, b2.length);
+    int sad = 0;
+    for (int i = 0; i < min_length; i++) {
+      sad += Math.abs(b1[i] - b2[i]);
+    }
+    return sad;
+  }
+
+  /// CHECK-START-ARM64: long Main.sadShort2Long(short[], short[]) loop_optimization (after)
+  /// CHECK-DAG: VecSADAccumulate loop:<<Loop:B\d+>> outer_loop:none
+  static long sadShort2Long(short[] s1, short[] s2) {
+    int min_length = Math.min(s1.length, s2.length);
+    long sad = 0;
+    for (int i = 0; i < min_length; i++) {
+      long x = s1[i];
+      long y = s2[i];
+      sad += Math.abs(x - y);
+    }
+    return sad;
+  }
+
+  /// CHECK-START-ARM64: int Main.sadInt2Int(int[], int[]) loop_optimization (after)
+  /// CHECK-DAG: VecSADAccumulate loop:<<Loop:B\d+>> outer_loop:none
+  static int sadInt2Int(int[] x, int[] y) {
+    int min_length = Math.min(x.length, y.length);
+    int sad = 0;
+    for (int i = 0; i < min_length; i++) {
+      sad += Math.abs(x[i] - y[i]);
+    }
+    return sad;
+  }
+
+  //
+  // Dot product.
+  //
+
+  /// CHECK-START-ARM64: int Main.dotProdByte(byte[], byte[]) loop_optimization (after)
+  /// CHECK-DAG: VecDotProd type:Int8 loop:<<Loop:B\d+>> outer_loop:none
+  static int dotProdByte(byte[] a, byte[] b) {
+    int s = 1;
+    for (int i = 0; i < b.length; i++) {
+      int temp = a[i] * b[i];
+      s += temp;
+    }
+    return s - 1;
+  }
+
+  /// CHECK-START-ARM64: int Main.dotProdByteUnsigned(byte[], byte[]) loop_optimization (after)
+  /// CHECK-DAG: VecDotProd type:Uint8 loop:<<Loop:B\d+>> outer_loop:none
+  static int dotProdByteUnsigned(byte[] a, byte[] b) {
+    int s = 1;
+    for (int i = 0; i < b.length; i++) {
+      int temp = (a[i] & 0xff) * (b[i] & 0xff);
+      s += temp;
+    }
+    return s - 1;
+  }
+
+  /// CHECK-START-ARM64: int Main.dotProdShort(short[], short[]) loop_optimization (after)
+  /// CHECK-DAG: VecDotProd type:Int16 loop:<<Loop:B\d+>> outer_loop:none
+  static int dotProdShort(short[] a, short[] b) {
+    int s = 1;
+    for (int i = 0; i < b.length; i++) {
+      int temp = a[i] * b[i];
+      s += temp;
+    }
+    return s - 1;
+  }
+
+  //
+  // Reductions.
+  //
+
+  /// CHECK-START-ARM64: int Main.reductionInt(int[]) loop_optimization (after)
+  /// CHECK-DAG: VecSetScalars    loop:none
+  /// CHECK-DAG: VecAdd           loop:<<Loop:B\d+>> outer_loop:none
+  /// CHECK-DAG: VecReduce        loop:none
+  /// CHECK-DAG: VecExtractScalar loop:none
+  static int reductionInt(int[] x) {
+    int sum = 0;
+    for (int i = 0; i < x.length; i++) {
+      sum += x[i];
+    }
+    return sum;
+  }
+
+  /// CHECK-START-ARM64: long Main.reductionLong(long[]) loop_optimization (after)
+  /// CHECK-DAG: VecReduce loop:none
+  static long reductionLong(long[] x) {
+    long sum = 0;
+    for (int i = 0; i < x.length; i++) {
+      sum += x[i];
+    }
+    return sum;
+  }
+
+  /// CHECK-START-ARM64: int Main.reductionMinInt(int[]) loop_optimization (after)
+  /// CHECK-DAG: VecMin    loop:<<Loop:B\d+>> outer_loop:none
+  /// CHECK-DAG: VecReduce loop:none
+  static int reductionMinInt(int[] x) {
+    int min = Integer.MAX_VALUE;
+    for (int i = 0; i < x.length; i++) {
+      min = Math.min(min, x[i]);
+    }
+    return min;
+  }
+
+  /// CHECK-START-ARM64: int Main.reductionMaxInt(int[]) loop_optimization (after)
+  /// CHECK-DAG: VecMax    loop:<<Loop:B\d+>> outer_loop:none
+  /// CHECK-DAG: VecReduce loop:none
+  static int reductionMaxInt(int[] x) {
+    int max = Integer.MIN_VALUE;
+    for (int i = 0; i < x.length; i++) {
+      max = Math.max(max, x[i]);
+    }
+    return max;
+  }
+
+  //
+  // Min/Max, Abs, Multiply-accumulate.
+  //
+
+  /// CHECK-START-ARM64: void Main.minChar(char[], char[], char[]) loop_optimization (after)
+  /// CHECK-DAG: VecMin packed_type:Uint16 loop:<<Loop:B\d+>> outer_loop:none
+  static void minChar(char[] x, char[] y, char[] z) {
+    int min = Math.min(x.length, Math.min(y.length, z.length));
+    for (int i = 0; i < min; i++) {
+      x[i] = (char) Math.min(y[i], z[i]);
+    }
+  }
+
+  /// CHECK-START-ARM64: void Main.maxByte(byte[], byte[], byte[]) loop_optimization (after)
+  /// CHECK-DAG: VecMax packed_type:Int8 loop:<<Loop:B\d+>> outer_loop:none
+  static void maxByte(byte[] x, byte[] y, byte[] z) {
+    int min = Math.min(x.length, Math.min(y.length, z.length));
+    for (int i = 0; i < min; i++) {
+      x[i] = (byte) Math.max(y[i], z[i]);
+    }
+  }
+
+  /// CHECK-START-ARM64: void Main.minFloat(float[], float[], float[]) loop_optimization (after)
+  /// CHECK-DAG: VecMin packed_type:Float32 loop:<<Loop:B\d+>> outer_loop:none
+  static void minFloat(float[] x, float[] y, float[] z) {
+    int min = Math.min(x.length, Math.min(y.length, z.length));
+    for (int i = 0; i < min; i++) {
+      x[i] = Math.min(y[i], z[i]);
+    }
+  }
+
+  /// CHECK-START-ARM64: void Main.absShort(short[]) loop_optimization (after)
+  /// CHECK-DAG: VecAbs loop:<<Loop:B\d+>> outer_loop:none
+  static void absShort(short[] x) {
+    for (int i = 0; i < x.length; i++) {
+      x[i] = (short) Math.abs(x[i]);
+    }
+  }
+
+  /// CHECK-START-ARM64: void Main.mulAdd(int[], int[]) instruction_simplifier_arm64 (after)
+  /// CHECK-DAG: VecMultiplyAccumulate kind:Add loop:<<Loop:B\d+>> outer_loop:none
+  static void mulAdd(int[] array1, int[] array2) {
+    for (int j = 0; j < array1.length; j++) {
+      array1[j] += array1[j] * array2[j];
+    }
+  }
+
+  /// CHECK-START-ARM64: void Main.mulSub(int[], int[]) instruction_simplifier_arm64 (after)
+  /// CHECK-DAG: VecMultiplyAccumulate kind:Sub loop:<<Loop:B\d+>> outer_loop:none
+  static void mulSub(int[] array1, int[] array2) {
+    for (int j = 0; j < array1.length; j++) {
+      array1[j] -= array1[j] * array2[j];
+    }
+  }
+
+  //
+  // Test Driver.
+  //
+
+  public static void main(String[] args) {
+    byte[] b1 = new byte[N], b2 = new byte[N], bo = new byte[N];
+    short[] s1 = new short[N], s2 = new short[N], so = new short[N];
+    char[] c1 = new char[N], c2 = new char[N], co = new char[N];
+    int[] i1 = new int[N], i2 = new int[N];
+    long[] l1 = new long[N];
+    float[] f1 = new float[N], f2 = new float[N], fo = new float[N];
+
+    // Edge values: overflow in the lanes, sign, NaN and signed zeros.
+    int k = 0;
+    for (int i = 0; i < N; i++) {
+      k = k * 1103515245 + 12345;
+      b1[i] = (byte) k;
+      b2[i] = (byte) (k >> 8);
+      s1[i] = (short) k;
+      s2[i] = (short) (k >> 16);
+      c1[i] = (char) k;
+      c2[i] = (char) (k >> 16);
+      i1[i] = (i % 7 == 0) ? Integer.MIN_VALUE + i : k;
+      i2[i] = k >> 3;
+      l1[i] = ((long) k << 20) + i;
+      f1[i] = (i % 11 == 0) ? Float.NaN : (i % 13 == 0) ? -0.0f : k / 1000.0f;
+      f2[i] = (i % 17 == 0) ? 0.0f : (k >> 4) / 1000.0f;
+    }
+
+    halving_add_signed(b1, b2, bo);
+    for (int i = 0; i < N; i++) {
+      expectEquals((byte) ((b1[i] + b2[i]) >> 1), bo[i], "halving_add_signed");
+    }
+    halving_add_unsigned(b1, b2, bo);
+    for (int i = 0; i < N; i++) {
+      expectEquals((byte) (((b1[i] & 0xff) + (b2[i] & 0xff)) >> 1), bo[i],
+          "halving_add_unsigned");
+    }
+    rounding_halving_add_signed(s1, s2, so);
+    for (int i = 0; i < N; i++) {
+      expectEquals((short) ((s1[i] + s2[i] + 1) >> 1), so[i],
+          "rounding_halving_add_signed");
+    }
+    rounding_halving_add_unsigned(c1, c2, co);
+    for (int i = 0; i < N; i++) {
+      expectEquals((char) ((c1[i] + c2[i] + 1) >> 1), co[i],
+          "rounding_halving_add_unsigned");
+    }
+
+    int isad = 0;
+    long lsad = 0;
+    int isad2 = 0;
+    for (int i = 0; i < N; i++) {
+      isad += Math.abs(b1[i] - b2[i]);
+      lsad += Math.abs((long) s1[i] - (long) s2[i]);
+      isad2 += Math.abs(i1[i] - i2[i]);
+    }
+    expectEquals(isad, sadByte2Int(b1, b2), "sadByte2Int");
+    expectEquals(lsad, sadShort2Long(s1, s2), "sadShort2Long");
+    expectEquals(isad2, sadInt2Int(i1, i2), "sadInt2Int");
+
+    int dot = 0, udot = 0, sdot = 0;
+    for (int i = 0; i < N; i++) {
+      dot += b1[i] * b2[i];
+      udot += (b1[i] & 0xff) * (b2[i] & 0xff);
+      sdot += s1[i] * s2[i];
+    }
+    expectEquals(dot, dotProdByte(b1, b2), "dotProdByte");
+    expectEquals(udot, dotProdByteUnsigned(b1, b2), "dotProdByteUnsigned");
+    expectEquals(sdot, dotProdShort(s1, s2), "dotProdShort");
+
+    int isum = 0, imin = Integer.MAX_VALUE, imax = Integer.MIN_VALUE;
+    long lsum = 0;
+    for (int i = 0; i < N; i++) {
+      isum += i1[i];
+      imin = Math.min(imin, i1[i]);
+      imax = Math.max(imax, i1[i]);
+      lsum += l1[i];
+    }
+    expectEquals(isum, reductionInt(i1), "reductionInt");
+    expectEquals(lsum, reductionLong(l1), "reductionLong");
+    expectEquals(imin, reductionMinInt(i1), "reductionMinInt");
+    expectEquals(imax, reductionMaxInt(i1), "reductionMaxInt");
+
+    minChar(co, c1, c2);
+    for (int i = 0; i < N; i++) {
+      expectEquals((char) Math.min(c1[i], c2[i]), co[i], "minChar");
+    }
+    maxByte(bo, b1, b2);
+    for (int i = 0; i < N; i++) {
+      expectEquals((byte) Math.max(b1[i], b2[i]), bo[i], "maxByte");
+    }
+    minFloat(fo, f1, f2);
+    for (int i = 0; i < N; i++) {
+      expectEquals(Math.min(f1[i], f2[i]), fo[i], "minFloat");
+    }
+    System.arraycopy(s1, 0, so, 0, N);
+    absShort(so);
+    for (int i = 0; i < N; i++) {
+      expectEquals((short) Math.abs(s1[i]), so[i], "absShort");
+    }
+
+    int[] acc = new int[N];
+    System.arraycopy(i1, 0, acc, 0, N);
+    mulAdd(acc, i2);
+    for (int i = 0; i < N; i++) {
+      expectEquals(i1[i] + i1[i] * i2[i], acc[i], "mulAdd");
+    }
+    System.arraycopy(i1, 0, acc, 0, N);
+    mulSub(acc, i2);
+    for (int i = 0; i < N; i++) {
+      expectEquals(i1[i] - i1[i] * i2[i], acc[i], "mulSub");
+    }
+
+    // Done.
+    System.out.println("passed");
+  }
+
+  private static void expectEquals(long expected, long result, String action) {
+    check(expected == result, "Expected: " + expected + ", found: " + result
+        + " for " + action);
+  }
+
+  private static void expectEquals(float expected, float result, String action) {
+    // bit-exact: NaN and signed zeros
+    check(Float.floatToIntBits(expected) == Float.floatToIntBits(result),
+        "Expected: " + expected + ", found: " + result + " for " + action);
+  }
+
+  private static void check(boolean passed, String msg) {
+    Class thisClass = new Object(){}.getClass();
+    String className = thisClass.getEnclosingClass().getSimpleName();
+    msg = className + ": " + msg;
+    if (!passed) {
+      CheckTest.RunAndroidTestFailed(msg);
+    } else {
+      CheckTest.RunAndroidTestPassedSilent(msg);
+    }
+  }
+}
@@ -102,6 +102,7 @@
 #ifdef ART_MCR_TARGET
 #include "mcr_cc/clang_interface.h"
 #include "mcr_cc/invoke_histogram.h"
+#include "mcr_cc/iterative_search.h"
 #include "mcr_cc/llc_interface.h"
 #ifdef ART_MCR_COMPILE_OS_METHODS
 #include "mcr_cc/os_comp.h"
@@ -109,6 +110,7 @@
 #include "mcr_cc/llvm/debug.h"
 #include "mcr_cc/analyser.h"
 #include "mcr_cc/llvm/llvm_compiler.h"
+#include "mcr_cc/llvm/llvm_region.h"
 #include "mcr_cc/pass_manager.h"
 #include "mcr_rt/invoke_info.h"
 #endif
@@ -2916,7 +2918,7 @@ class Dex2Oat final {
       }
 
       DLOG(INFO) << "Methods compiled with the optimizing backend: " 
-        << mcr::McrCC::compiled_optimizing_;
+        << mcr::McrCC::compiled_optimizing_.load();
 
       McrDebug::PrintOptions();
     }
@@ -3199,6 +3201,10 @@ static void McrPostCompilation(Dex2Oat& dex2oat) {
   // and it might cause several cascarding recompilations.
   // This approach is quite slow. It should be implemented differently.
   if (dex2oat.IsCompilingForLlvm()) {
+    if (!LLVM::LlvmRegion::StoreAll()) {
+      mcr::McrCC::AddRecompilationReason("Failed to store a region module.");
+    }
+
     if (mcr::InvokeInfo::ShouldUpdateHistogram()) {
       mcr::InvokeInfo::UpdateHistogram();
       mcr::McrCC::AddRecompilationReason("Updated Histogram.");
@@ -3335,10 +3341,22 @@ void art::Dex2Oat::McrInitialization() {
 
       DLOG(INFO) << "Assembling LLVM bitcode";
       mcr::PassManager::LoadLlvmCompilationFlags();
-
-      // generate shared object file (hf.so) from the bitcode
-      if (!mcr::LlcInterface::Compile(emit_llvm_, emit_asm_,
-            compiler_options_->GetMcrGetExtraFlags())) {
+      McrDebug::ReadLlvmExternalTools();
+      McrDebug::ReadRegionModule();
+      McrDebug::ReadCompilationCache();
+
+      // generate a shared object file (hf.so) per region from the bitcode
+      bool success;
+      if (mcr::IterativeSearch::IsEnabled()) {
+        success = mcr::IterativeSearch::Run(
+            compiler_options_->GetInstructionSet(), emit_llvm_, emit_asm_,
+            compiler_options_->GetMcrGetExtraFlags(), thread_count_);
+      } else {
+        success = mcr::LlcInterface::CompileRegions(
+            compiler_options_->GetInstructionSet(), emit_llvm_, emit_asm_,
+            compiler_options_->GetMcrGetExtraFlags(), thread_count_);
+      }
+      if (!success) {
         DLOG(FATAL) << "dex2oat: LLVM compilation: FAILED!";
         exit(EXIT_FAILURE);
       } else {
@@ -31,13 +31,16 @@
 
 #include "ti_dump.h"
 
+#include <algorithm>
 #include <limits>
 #include <sstream>
+#include <vector>
 
 #include "art_jvmti.h"
 #include "base/mutex.h"
 #include "deopt_manager.h"
 #include "events-inl.h"
+#include "jni/jni_internal.h"
 #include "runtime_callbacks.h"
 #include "scoped_thread_state_change-inl.h"
 #include "thread-current-inl.h"
@@ -90,4 +93,58 @@ jvmtiError DumpUtil::DumpInternalState(jvmtiEnv *jvmti, char **data) {
   return err;
 }
 
+#ifdef ART_MCR
+// counts_ptr has kNumKinds values per method (quick, entrypoint, jni).
+// A null method holds the transitions that have no callee method.
+jvmtiError DumpUtil::GetLlvmTransitions(jvmtiEnv* jvmti,
+                                        jint* count_ptr,
+                                        jmethodID** methods_ptr,
+                                        jlong** counts_ptr) {
+  using art::mcr::LlvmTransitions;
+  art::Thread* self = art::Thread::Current();
+  if (jvmti == nullptr || self == nullptr) {
+    return ERR(INVALID_ENVIRONMENT);
+  } else if (count_ptr == nullptr || methods_ptr == nullptr || counts_ptr == nullptr) {
+    return ERR(NULL_POINTER);
+  }
+
+  std::vector<LlvmTransitions::Entry> entries;
+  uint64_t totals[LlvmTransitions::kNumKinds] = {};
+  LlvmTransitions::CollectAll(&entries, totals);
+
+  // Totals that were not attributed to a method
+  LlvmTransitions::Entry other = {};
+  for (size_t k = 0; k < LlvmTransitions::kNumKinds; k++) {
+    uint64_t attributed = 0;
+    for (const LlvmTransitions::Entry& e : entries) attributed += e.counts[k];
+    other.counts[k] = totals[k] - std::min(totals[k], attributed);
+  }
+  entries.push_back(other);
+
+  jvmtiError err = OK;
+  JvmtiUniquePtr<jmethodID[]> methods =
+      AllocJvmtiUniquePtr<jmethodID[]>(jvmti, entries.size(), &err);
+  if (methods == nullptr) {
+    return err;
+  }
+  JvmtiUniquePtr<jlong[]> counts = AllocJvmtiUniquePtr<jlong[]>(
+      jvmti, entries.size() * LlvmTransitions::kNumKinds, &err);
+  if (counts == nullptr) {
+    return err;
+  }
+  for (size_t i = 0; i < entries.size(); i++) {
+    methods[i] = entries[i].method == nullptr
+        ? nullptr : art::jni::EncodeArtMethod(entries[i].method);
+    for (size_t k = 0; k < LlvmTransitions::kNumKinds; k++) {
+      counts[i * LlvmTransitions::kNumKinds + k] =
+          static_cast<jlong>(entries[i].counts[k]);
+    }
+  }
+  *count_ptr = static_cast<jint>(entries.size());
+  *methods_ptr = methods.release();
+  *counts_ptr = counts.release();
+  return OK;
+}
+#endif
+
 }  // namespace openjdkjvmti
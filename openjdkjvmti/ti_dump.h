@@ -45,6 +45,14 @@ class DumpUtil {
   static void Unregister();
 
   static jvmtiError DumpInternalState(jvmtiEnv* jvmti, char** data);
+
+#ifdef ART_MCR
+  // Transitions out of LLVM code, per callee method (mcr_rt/llvm_transitions.h)
+  static jvmtiError GetLlvmTransitions(jvmtiEnv* jvmti,
+                                       jint* count_ptr,
+                                       jmethodID** methods_ptr,
+                                       jlong** counts_ptr);
+#endif
 };
 
 }  // namespace openjdkjvmti
@@ -327,6 +327,26 @@ jvmtiError ExtensionUtil::GetExtensionFunctions(jvmtiEnv* env,
     return error;
   }
 
+#ifdef ART_MCR
+  // LLVM backend: transitions out of LLVM code
+  error = add_extension(
+      reinterpret_cast<jvmtiExtensionFunction>(DumpUtil::GetLlvmTransitions),
+      "com.android.art.llvm.get_transitions",
+      "Retrieves the number of transitions out of LLVM code of all threads, per callee method."
+      " For each method there are three counts in counts_out: to quick code, to runtime"
+      " entrypoints, and to JNI. The last method is null, and holds the transitions that were"
+      " not attributed to a method. Both lists must be deallocated by the caller.",
+      {
+        { "count_out", JVMTI_KIND_OUT, JVMTI_TYPE_JINT, false },
+        { "methods_out", JVMTI_KIND_ALLOC_BUF, JVMTI_TYPE_JMETHODID, false },
+        { "counts_out", JVMTI_KIND_ALLOC_BUF, JVMTI_TYPE_JLONG, false },
+      },
+      { ERR(NULL_POINTER), ERR(OUT_OF_MEMORY) });
+  if (error != ERR(NONE)) {
+    return error;
+  }
+#endif
+
   // Copy into output buffer.
 
   *extension_count_ptr = ext_vector.size();
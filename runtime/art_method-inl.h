@@ -48,6 +48,7 @@
 
 #include "mcr_rt/mcr_rt.h"
 #ifdef ART_MCR_TARGET_RT
+#include "entrypoints/quick/quick_default_externs.h"
 #include "entrypoints/runtime_asm_entrypoints.h"
 #include "mcr_rt/oat_aux.h"
 #include "mcr_rt/opt_interface.h"
@@ -65,14 +66,21 @@ inline bool ArtMethod::IsIchfFAST() {
   return HasOverridenQuickEntrypoint();
 }
 
-inline void ArtMethod::SetQuickToLlvm(
-    const void* quick_code, const void* llvm_code) {
-  if(quick_code == nullptr) {
-    quick_code = GetEntryPointFromQuickCompiledCode();
-  }
+/**
+ * @brief Stores the LLVM code to the jni entrypoint (the aux data of a
+ *        linked method), and sets the quick entrypoint to the bridge.
+ *        The bridge reads it back with GetLlvmCode.
+ *
+ * @param llvm_code
+ */
+inline void ArtMethod::SetQuickToLlvm(void* llvm_code) {
+  SetEntryPointFromJniPtrSize(llvm_code, kRuntimePointerSize);
+  SetEntryPointFromQuickCompiledCode(
+      reinterpret_cast<const void*>(art_quick_to_llvm_bridge));
+}
 
-  SetEntryPointFromJni(quick_code);
-  SetEntryPointFromQuickCompiledCode(llvm_code);
+inline void* ArtMethod::GetLlvmCode() {
+  return GetEntryPointFromJniPtrSize(kRuntimePointerSize);
 }
 
 /**
@@ -93,6 +101,8 @@ inline void ArtMethod::SetQuickToInterpreter(const void* quick_code) {
 /**
  * @brief Gets the quick entrypoint from JNI, and sets it to quick.
  *        Then resets jni entrypoint to null.
+ *        Only after SetQuickToInterpreter: SetQuickToLlvm does not keep
+ *        the quick code.
  */
 inline void ArtMethod::ResetQuickEntrypoint() {
   SetEntryPointFromQuickCompiledCode(GetEntryPointFromJni());
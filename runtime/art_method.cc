@@ -25,7 +25,6 @@
 
 #include "mcr_rt/art_impl.h"
 #ifdef ART_MCR_TARGET
-#include "mcr_rt/invoke_info.h"
 #include "mcr_rt/mcr_dbg.h"
 #include "mcr_rt/opt_interface.h"
 #include "mcr_rt/utils.h"
@@ -114,12 +113,6 @@ void ArtMethod::McrInvokeLLVM(Thread* self, ShadowFrame* shadow_frame,
     UNREACHABLE();
   }
 #endif
-  
-#ifdef CRDEBUG1
-  if(UNLIKELY(mcr::InvokeInfo::ShouldUpdateHistogram())) {
-    mcr::InvokeInfo::UpdateHistogram();
-  }
-#endif
 }
 
 /**
@@ -742,8 +742,8 @@ class ArtMethod final {
 #ifdef ART_MCR_TARGET_RT
   ALWAYS_INLINE bool HasOverridenQuickEntrypoint();
   ALWAYS_INLINE bool IsIchfFAST();
-  ALWAYS_INLINE void SetQuickToLlvm(const void* quick_code,
-      const void* llvm_code);
+  ALWAYS_INLINE void SetQuickToLlvm(void* llvm_code);
+  ALWAYS_INLINE void* GetLlvmCode();
   ALWAYS_INLINE void SetQuickToInterpreter(const void* quick_code = nullptr);
   ALWAYS_INLINE void ResetQuickEntrypoint();
 
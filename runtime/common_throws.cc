@@ -582,38 +582,46 @@ void ThrowNullPointerExceptionFromDexPC(bool check_address, uintptr_t addr) {
                << " in "
                << method->PrettyMethod();
   }
+  ThrowNullPointerExceptionFromDexPC(method, throw_dex_pc);
+}
+
+void ThrowNullPointerExceptionFromDexPC(ArtMethod* method, uint32_t throw_dex_pc) {
+  const DexFile& dex_file = *method->GetDexFile();
+  CodeItemInstructionAccessor accessor(method->DexInstructions());
+  CHECK_LT(throw_dex_pc, accessor.InsnsSizeInCodeUnits());
+  const Instruction& instr = accessor.InstructionAt(throw_dex_pc);
 
   switch (instr.Opcode()) {
     case Instruction::INVOKE_DIRECT:
-      ThrowNullPointerExceptionForMethodAccess(instr.VRegB_35c(), kDirect);
+      ThrowNullPointerExceptionForMethodAccessImpl(instr.VRegB_35c(), dex_file, kDirect);
       break;
     case Instruction::INVOKE_DIRECT_RANGE:
-      ThrowNullPointerExceptionForMethodAccess(instr.VRegB_3rc(), kDirect);
+      ThrowNullPointerExceptionForMethodAccessImpl(instr.VRegB_3rc(), dex_file, kDirect);
       break;
     case Instruction::INVOKE_VIRTUAL:
-      ThrowNullPointerExceptionForMethodAccess(instr.VRegB_35c(), kVirtual);
+      ThrowNullPointerExceptionForMethodAccessImpl(instr.VRegB_35c(), dex_file, kVirtual);
       break;
     case Instruction::INVOKE_VIRTUAL_RANGE:
-      ThrowNullPointerExceptionForMethodAccess(instr.VRegB_3rc(), kVirtual);
+      ThrowNullPointerExceptionForMethodAccessImpl(instr.VRegB_3rc(), dex_file, kVirtual);
       break;
     case Instruction::INVOKE_INTERFACE:
-      ThrowNullPointerExceptionForMethodAccess(instr.VRegB_35c(), kInterface);
+      ThrowNullPointerExceptionForMethodAccessImpl(instr.VRegB_35c(), dex_file, kInterface);
       break;
     case Instruction::INVOKE_INTERFACE_RANGE:
-      ThrowNullPointerExceptionForMethodAccess(instr.VRegB_3rc(), kInterface);
+      ThrowNullPointerExceptionForMethodAccessImpl(instr.VRegB_3rc(), dex_file, kInterface);
       break;
     case Instruction::INVOKE_POLYMORPHIC:
-      ThrowNullPointerExceptionForMethodAccess(instr.VRegB_45cc(), kVirtual);
+      ThrowNullPointerExceptionForMethodAccessImpl(instr.VRegB_45cc(), dex_file, kVirtual);
       break;
     case Instruction::INVOKE_POLYMORPHIC_RANGE:
-      ThrowNullPointerExceptionForMethodAccess(instr.VRegB_4rcc(), kVirtual);
+      ThrowNullPointerExceptionForMethodAccessImpl(instr.VRegB_4rcc(), dex_file, kVirtual);
       break;
     case Instruction::INVOKE_VIRTUAL_QUICK:
     case Instruction::INVOKE_VIRTUAL_RANGE_QUICK: {
       uint16_t method_idx = method->GetIndexFromQuickening(throw_dex_pc);
       if (method_idx != DexFile::kDexNoIndex16) {
         // NPE with precise message.
-        ThrowNullPointerExceptionForMethodAccess(method_idx, kVirtual);
+        ThrowNullPointerExceptionForMethodAccessImpl(method_idx, dex_file, kVirtual);
       } else {
         // NPE with imprecise message.
         ThrowNullPointerException("Attempt to invoke a virtual method on a null object reference");
@@ -714,9 +722,8 @@ void ThrowNullPointerExceptionFromDexPC(bool check_address, uintptr_t addr) {
       break;
     }
     default: {
-      const DexFile* dex_file = method->GetDexFile();
       LOG(FATAL) << "NullPointerException at an unexpected instruction: "
-                 << instr.DumpString(dex_file)
+                 << instr.DumpString(&dex_file)
                  << " in "
                  << method->PrettyMethod();
       UNREACHABLE();
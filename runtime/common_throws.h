@@ -231,6 +231,11 @@ void ThrowNullPointerExceptionForMethodAccess(ArtMethod* method,
 void ThrowNullPointerExceptionFromDexPC(bool check_address = false, uintptr_t addr = 0)
     REQUIRES_SHARED(Locks::mutator_lock_) COLD_ATTR;
 
+// Same as above, for the instruction at `throw_dex_pc` of `method`, which does
+// not have to be the current method of the stack (e.g., LLVM code).
+void ThrowNullPointerExceptionFromDexPC(ArtMethod* method, uint32_t throw_dex_pc)
+    REQUIRES_SHARED(Locks::mutator_lock_) COLD_ATTR;
+
 void ThrowNullPointerException(const char* msg)
     REQUIRES_SHARED(Locks::mutator_lock_) COLD_ATTR;
 
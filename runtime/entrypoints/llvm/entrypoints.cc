@@ -16,10 +16,12 @@
  */
 #include "mcr_rt/mcr_rt.h"
 
+#include "android-base/stringprintf.h"
 #include "art_method-inl.h"
 #include "base/callee_save_type.h"
 #include "class_linker-inl.h"
 #include "class_table-inl.h"
+#include "common_throws.h"
 #include "dex/dex_file-inl.h"
 #include "dex/dex_file_types.h"
 #include "entrypoints/entrypoint_utils-inl.h"
@@ -28,12 +30,15 @@
 #include "mirror/class_loader.h"
 #include "mirror/object-inl.h"
 #include "mirror/object_array-inl.h"
+#include "mirror/throwable.h"
 #include "oat_file.h"
 #include "runtime.h"
 
 #ifdef ART_MCR
 #include "jvalue-inl.h"
 #include "mcr_rt/art_impl-inl.h"
+#include "mcr_rt/branch_profile.h"
+#include "mcr_rt/llvm_inline_cache.h"
 
 namespace art {
 
@@ -50,6 +55,8 @@ REQUIRES_SHARED(Locks::mutator_lock_) {
   LLVM_FRAME_FIXUP(self);
   void* vresolved_method=
     LLVM::_ResolveInternalMethod(referrer, dex_method_idx, iinvoke_type, self);
+  LLVM_COUNT_TRANSITION(self, kToEntrypoint,
+      static_cast<ArtMethod*>(vresolved_method));
   LOGLLVM4(INFO) << __func__ << ": resolved_method: "
     << static_cast<ArtMethod*>(vresolved_method)->PrettyMethod()
     << " (" << std::hex << vresolved_method << ")";
@@ -66,6 +73,8 @@ REQUIRES_SHARED(Locks::mutator_lock_) {
     LLVM::_ResolveExternalMethod(referrer,
         dex_filename, dex_location,
         dex_method_idx, iinvoke_type, self);
+  LLVM_COUNT_TRANSITION(self, kToEntrypoint,
+      static_cast<ArtMethod*>(vresolved_method));
   LOGLLVM3(INFO) << __func__ << ": resolved_method: "
     << static_cast<ArtMethod*>(vresolved_method)->PrettyMethod()
     << " (" << std::hex << vresolved_method << ")";
@@ -86,6 +95,8 @@ REQUIRES_SHARED(Locks::mutator_lock_) {
 
   void* vresolved_method=
     LLVM::_ResolveVirtualMethod(receiver, referrer);
+  LLVM_COUNT_TRANSITION(self, kToEntrypoint,
+      static_cast<ArtMethod*>(vresolved_method));
 #ifdef CRDEBUG3
   ArtMethod* method= static_cast<ArtMethod*>(vresolved_method);
   D2LOG(WARNING) << __func__ << ": "
@@ -114,6 +125,8 @@ REQUIRES_SHARED(Locks::mutator_lock_) {
   ImTable* imt = cls->GetImt(kRuntimePointerSize);
   uint32_t imt_index = interface_method->GetImtIndex();
   D5LOG(INFO) << __func__ << ": imt idx: " << imt_index;
+  // by the interface method: the target is not always resolved here
+  LLVM_COUNT_TRANSITION(self, kToEntrypoint, interface_method);
   ArtMethod* conflict_method = imt->Get(imt_index, kRuntimePointerSize);
   D2LOG(WARNING) << __func__ << ": conflict method: "
     << std::hex << conflict_method
@@ -167,10 +180,144 @@ REQUIRES_SHARED(Locks::mutator_lock_) {
   return (void*) method;
 }
 
+/**
+ * @brief Interface dispatch of LLVM code that missed the IMT, the inline
+ *        cache, and the conflict table. Resolves as above (it also adds
+ *        the target to the conflict table), and fills the inline cache.
+ */
+extern "C" void* artInlineCacheMissFromLLVM(
+    mirror::Object* raw_this_object, ArtMethod* interface_method,
+    void* inline_cache, Thread* self)
+REQUIRES_SHARED(Locks::mutator_lock_) {
+  StackHandleScope<1> hs(self);
+  Handle<mirror::Object> this_object = hs.NewHandle(raw_this_object);
+  void* method = artResolveInterfaceMethodFromLLVM(
+      this_object.Get(), interface_method, self);
+  if (method != nullptr) {
+    mcr::LlvmInlineCache::Update(
+        static_cast<mcr::LlvmInlineCache*>(inline_cache),
+        this_object->GetClass(), static_cast<ArtMethod*>(method));
+  }
+  return method;
+}
+
+/**
+ * @brief Finds the catch block of an LLVM try block, with the same lookup
+ *        as QuickExceptionHandler (ArtMethod::FindCatchBlock).
+ *        A thrown exception (HThrow) becomes the pending one. Otherwise the
+ *        exception is already pending (a call returned with it).
+ *
+ * The exception stays pending: the catch block loads and clears it.
+ *
+ * @return the dex pc of the handler plus one, or 0 (no handler), and then
+ *         the stub delivers the exception to the callers.
+ */
+extern "C" size_t artFindCatchBlockFromLLVM(
+    ArtMethod* method, uint32_t dex_pc, mirror::Object* exception,
+    Thread* self)
+REQUIRES_SHARED(Locks::mutator_lock_) {
+  LLVM_FRAME_FIXUP(self);
+  LLVM_COUNT_TRANSITION(self, kToEntrypoint, method);
+  if (exception != nullptr) {
+    self->SetException(ObjPtr<mirror::Throwable>::DownCast(exception));
+  }
+  DCHECK(self->IsExceptionPending());
+
+  StackHandleScope<1> hs(self);
+  Handle<mirror::Class> exception_class(
+      hs.NewHandle(self->GetException()->GetClass()));
+  bool clear_exception = false;
+  const uint32_t handler_dex_pc =
+    method->FindCatchBlock(exception_class, dex_pc, &clear_exception);
+  D3LOG(INFO) << __func__ << ": " << method->PrettyMethod()
+    << ": dex_pc: " << dex_pc << ": handler: " << handler_dex_pc;
+  if (handler_dex_pc == dex::kDexNoIndex) return 0u;
+  return handler_dex_pc + 1u;
+}
+
+/**
+ * @brief Resolves the class of a speculation (its type index is in the dex
+ *        file of the class: it can be another dex file of the apk, or one of
+ *        the boot classpath), and stores it to the guard of LLVM code.
+ *
+ * A class that does not resolve leaves the guard null: it never matches.
+ * Returns the slot, as the downcall delivers an exception on null.
+ */
+extern "C" void* artResolveSpecClassFromLLVM(
+    ArtMethod* referrer, const char* dex_filename, const char* dex_location,
+    uint32_t type_idx, void* slot, Thread* self)
+REQUIRES_SHARED(Locks::mutator_lock_) {
+  LLVM_FRAME_FIXUP(self);
+  LLVM_COUNT_TRANSITION(self, kToEntrypoint, referrer);
+  ClassLinker* linker = Runtime::Current()->GetClassLinker();
+  const DexFile* dex_file =
+    mcr::McrRT::OpenDexFileANY(dex_filename, dex_location);
+  ObjPtr<mirror::Class> klass = nullptr;
+  if (dex_file != nullptr && type_idx < dex_file->NumTypeIds()) {
+    StackHandleScope<2> hs(self);
+    Handle<mirror::DexCache> dex_cache(
+        hs.NewHandle(linker->FindDexCache(self, *dex_file)));
+    Handle<mirror::ClassLoader> class_loader(
+        hs.NewHandle(referrer->GetClassLoader()));
+    klass = linker->ResolveType(dex::TypeIndex(type_idx), dex_cache, class_loader);
+  }
+  if (klass == nullptr) {
+    self->ClearException();
+    DLOG(WARNING) << __func__ << ": unresolved: " << type_idx
+      << ": " << dex_location;
+  } else {
+    mcr::LlvmSpecClass::Set(
+        static_cast<std::atomic<uint32_t>*>(slot), klass.Ptr());
+    D3LOG(INFO) << __func__ << ": " << klass->PrettyDescriptor();
+  }
+  return slot;
+}
+
+/**
+ * @brief Registers the branch counters of an LLVM method (its InitInner
+ *        calls it once). Returns them, as the downcall delivers an
+ *        exception on null.
+ */
+extern "C" void* artRegisterBranchProfileFromLLVM(
+    ArtMethod* method, void* counters, const void* sites, uint32_t num_sites,
+    Thread* self)
+REQUIRES_SHARED(Locks::mutator_lock_) {
+  LLVM_FRAME_FIXUP(self);
+  LLVM_COUNT_TRANSITION(self, kToEntrypoint, method);
+  mcr::BranchProfile::Register(method, static_cast<uint32_t*>(counters),
+      static_cast<const mcr::BranchProfile::Site*>(sites), num_sites);
+  return counters;
+}
+
+/**
+ * @brief The NullPointerException of a null check of LLVM code (its null
+ *        branch, which is also the handler of a faulting load). LLVM code
+ *        throws it: either at a catch block or with DeliverException.
+ */
+extern "C" mirror::Object* artNewNullPointerFromLLVM(
+    ArtMethod* method, uint32_t dex_pc, Thread* self)
+REQUIRES_SHARED(Locks::mutator_lock_) {
+  LLVM_FRAME_FIXUP(self);
+  LLVM_COUNT_TRANSITION(self, kToEntrypoint, method);
+  // the message of the quick code, from the instruction at dex_pc
+  if (dex_pc < method->DexInstructions().InsnsSizeInCodeUnits()) {
+    ThrowNullPointerExceptionFromDexPC(method, dex_pc);
+  } else {
+    ThrowNullPointerException(android::base::StringPrintf(
+          "Attempt to use a null object reference (dex pc: 0x%x in %s)",
+          dex_pc, method->PrettyMethod().c_str()).c_str());
+  }
+  ObjPtr<mirror::Throwable> exception = self->GetException();
+  self->ClearException();
+  D3LOG(INFO) << __func__ << ": " << method->PrettyMethod()
+    << ": dex pc: " << dex_pc;
+  return exception.Ptr();
+}
+
 extern "C" void artJValueSetLFromLLVM(
   JValue* jvalue, mirror::Object* obj, Thread* self)
 REQUIRES_SHARED(Locks::mutator_lock_) {
-  UNUSED(self);
+  LLVM_COUNT_TRANSITION(self, kToEntrypoint, nullptr);
   LOGLLVM4(INFO) << __func__ << ": obj: " << std::hex << obj;
   LOGLLVM4(INFO) << __func__ << ": jvalue: " << std::hex << jvalue;
 
@@ -181,12 +328,21 @@ REQUIRES_SHARED(Locks::mutator_lock_) {
   return;
 }
 
-extern "C" void llvmPushQuickFrame(ManagedStack *fragment, Thread* self) {
+/**
+ * @brief Called before LLVM invokes quick or JNI code (callee).
+ */
+extern "C" void llvmPushQuickFrame(ManagedStack *fragment, ArtMethod* callee,
+                                   Thread* self) {
   // Push a transition back into managed code onto the linked list in thread.
   self->PushManagedStackFragment(fragment);
   // LLVM will be calling quick code, so while in quick,
   // do not apply operations like the frame fixup
-  SET_LLVM_CALLED_QUICK();
+  SET_LLVM_CALLED_QUICK(self);
+  if (callee->IsNative()) {
+    LLVM_COUNT_TRANSITION(self, kToJni, callee);
+  } else {
+    LLVM_COUNT_TRANSITION(self, kToQuick, callee);
+  }
   D4LOG(INFO) << __func__ << ": old Fragment: "
     << LLVM::GetManagedStackInfo(self, fragment);
 }
@@ -195,7 +351,7 @@ extern "C" void llvmPopQuickFrame(ManagedStack *old_fragment, Thread* self) {
   D4LOG(INFO) << __func__;
   // Pop transition.
   self->PopManagedStackFragment(*old_fragment);
-  UNSET_LLVM_CALLED_QUICK();
+  UNSET_LLVM_CALLED_QUICK(self);
 }
 
 // This was a workaround for LLVM but it doesn't affect anything
@@ -225,6 +225,12 @@ void SetQuickAllocEntryPointsInstrumented(bool instrumented) {
   entry_points_instrumented = instrumented;
 }
 
+bool IsQuickAllocTlabFastPathEnabled() {
+  return !entry_points_instrumented &&
+      (entry_points_allocator == gc::kAllocatorTypeTLAB ||
+       entry_points_allocator == gc::kAllocatorTypeRegionTLAB);
+}
+
 void ResetQuickAllocEntryPoints(QuickEntryPoints* qpoints, bool is_marking) {
 #if !defined(__APPLE__) || !defined(__LP64__)
   switch (entry_points_allocator) {
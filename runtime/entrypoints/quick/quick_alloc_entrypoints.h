@@ -38,6 +38,10 @@ void SetQuickAllocEntryPointsAllocator(gc::AllocatorType allocator)
 void SetQuickAllocEntryPointsInstrumented(bool instrumented)
     REQUIRES(Locks::mutator_lock_, Locks::runtime_shutdown_lock_);
 
+// Whether compiled code may bump-allocate in the thread-local buffer
+// without calling the entrypoints: a TLAB allocator, not instrumented.
+bool IsQuickAllocTlabFastPathEnabled();
+
 }  // namespace art
 
 #endif  // ART_RUNTIME_ENTRYPOINTS_QUICK_QUICK_ALLOC_ENTRYPOINTS_H_
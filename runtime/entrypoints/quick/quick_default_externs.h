@@ -91,6 +91,16 @@ extern "C" void art_llvm_verify_art_method(art::ArtMethod*);
 extern "C" void art_llvm_verify_art_class(art::mirror::Class*);
 extern "C" void art_llvm_verify_art_object(art::mirror::Object*);
 extern "C" void llvm_verify_stack_frame_current();
+
+// Direct call to quick code (args in the registers of the quick ABI)
+extern "C" void art_llvm_call_quick(art::ArtMethod*);
+// Interface dispatch that missed the inline cache (and the conflict table)
+extern "C" void* art_llvm_inline_cache_miss(art::mirror::Object*, art::ArtMethod*, void*);
+// Catch block of an exception in an LLVM try block
+extern "C" size_t art_llvm_find_catch_block(art::ArtMethod*, uint32_t, art::mirror::Object*);
+extern "C" void* art_llvm_resolve_spec_class(art::ArtMethod*, const char*, const char*, uint32_t, void*);
+extern "C" void* art_llvm_register_branch_profile(art::ArtMethod*, void*, const void*, uint32_t);
+extern "C" art::mirror::Object* art_llvm_new_null_pointer(art::ArtMethod*, uint32_t);
 #endif
 
 // Field entrypoints.
@@ -166,6 +166,14 @@ static void DefaultInitEntryPoints(JniEntryPoints* jpoints, QuickEntryPoints* qp
   qpoints->pLLVMVerifyArtClass= art_llvm_verify_art_class;
   qpoints->pLLVMVerifyArtObject= art_llvm_verify_art_object;
   qpoints->pLLVMVerifyStackFrameCurrent= llvm_verify_stack_frame_current;
+
+  // Direct calls to quick code
+  qpoints->pLLVMCallQuick= art_llvm_call_quick;
+  qpoints->pLLVMInlineCacheMiss= art_llvm_inline_cache_miss;
+  qpoints->pLLVMFindCatchBlock= art_llvm_find_catch_block;
+  qpoints->pLLVMResolveSpecClass= art_llvm_resolve_spec_class;
+  qpoints->pLLVMRegisterBranchProfile= art_llvm_register_branch_profile;
+  qpoints->pLLVMNewNullPointer= art_llvm_new_null_pointer;
   // mcr::OptimizingInterface::qpoints_=qpoints;
 #endif
 }
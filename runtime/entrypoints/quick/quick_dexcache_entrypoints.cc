@@ -241,6 +241,7 @@ extern "C" mirror::Class* artResolveTypeFromLLVM(
 REQUIRES_SHARED(Locks::mutator_lock_) {
   LOGLLVMDRT(WARNING) << __func__ << ": " << std::to_string(type_idx);
   LLVM_FRAME_FIXUP(self);
+  LLVM_COUNT_TRANSITION(self, kToEntrypoint, caller);
 
   // on nested calls we might have issues otherwise,
   // so use just the caller..
@@ -266,6 +267,7 @@ extern "C" mirror::Class* artResolveTypeAndVerifyAccessFromLLVM(
 REQUIRES_SHARED(Locks::mutator_lock_) {
   UNUSED(llvm_bss_slot);
   LLVM_FRAME_FIXUP(self);
+  LLVM_COUNT_TRANSITION(self, kToEntrypoint, caller);
 
   // Called when caller isn't guaranteed to have access to a type.
   ScopedQuickEntrypointChecks sqec(self);
@@ -285,6 +287,7 @@ extern "C" mirror::Class* artResolveTypeInternalLLVM(
 REQUIRES_SHARED(Locks::mutator_lock_) {
   UNUSED(llvm_bss_slot);
   LLVM_FRAME_FIXUP(self);
+  LLVM_COUNT_TRANSITION(self, kToEntrypoint, caller);
 
   // Called when caller isn't guaranteed to have access to a type.
   ScopedQuickEntrypointChecks sqec(self);
@@ -307,6 +310,7 @@ extern "C" mirror::String* artResolveStringFromLLVM(
     REQUIRES_SHARED(Locks::mutator_lock_) {
   LOGLLVM4(INFO) << __func__ << ": String Idx: " << string_idx;
   LLVM_FRAME_FIXUP(self);
+  LLVM_COUNT_TRANSITION(self, kToEntrypoint, caller);
 
   // if we use the LLVM::ShadowFrame ArtMethod we might have
   // issues with nested calls (it will be the wrong outer)
@@ -228,6 +228,12 @@
   V(LLVMVerifyArtClass, void, mirror::Class*) \
   V(LLVMVerifyArtObject, void, mirror::Object*) \
   V(LLVMVerifyStackFrameCurrent, void) \
+  V(LLVMCallQuick, void, ArtMethod*) \
+  V(LLVMInlineCacheMiss, void*, mirror::Object*, ArtMethod*, void*) \
+  V(LLVMFindCatchBlock, size_t, ArtMethod*, uint32_t, mirror::Object*) \
+  V(LLVMResolveSpecClass, void*, ArtMethod*, const char*, const char*, uint32_t, void*) \
+  V(LLVMRegisterBranchProfile, void*, ArtMethod*, void*, const void*, uint32_t) \
+  V(LLVMNewNullPointer, mirror::Object*, ArtMethod*, uint32_t) \
 
 #endif  // ART_RUNTIME_ENTRYPOINTS_QUICK_QUICK_ENTRYPOINTS_LIST_H_
 #undef ART_RUNTIME_ENTRYPOINTS_QUICK_QUICK_ENTRYPOINTS_LIST_H_   // #define is only for lint.
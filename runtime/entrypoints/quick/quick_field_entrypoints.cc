@@ -457,6 +457,7 @@ extern "C" mirror::Object* artLLVMReadBarrierSlow(
   UNUSED(ref);
   Thread* self = Thread::Current();
   LLVM_FRAME_FIXUP(self);
+  LLVM_COUNT_TRANSITION(self, kToEntrypoint, nullptr);
   LOGLLVM3(WARNING) << __func__ << ": offset: " << offset
     << "(" << std::hex<< offset<<")";
 
@@ -48,6 +48,11 @@
 #include "thread-inl.h"
 #include "thread_list.h"
 
+#ifdef ART_MCR_RT
+#include "mcr_rt/mcr_rt.h"
+#include "mcr_rt/opt_interface.h"
+#endif
+
 namespace art {
 namespace jit {
 
@@ -64,6 +69,9 @@ void* Jit::jit_compiler_handle_ = nullptr;
 void* (*Jit::jit_load_)(void) = nullptr;
 void (*Jit::jit_unload_)(void*) = nullptr;
 bool (*Jit::jit_compile_method_)(void*, ArtMethod*, Thread*, bool, bool) = nullptr;
+#ifdef ART_MCR_RT
+void* (*Jit::jit_compile_method_llvm_)(void*, ArtMethod*, Thread*) = nullptr;
+#endif
 void (*Jit::jit_types_loaded_)(void*, mirror::Class**, size_t count) = nullptr;
 bool (*Jit::jit_generate_debug_info_)(void*) = nullptr;
 void (*Jit::jit_update_options_)(void*) = nullptr;
@@ -243,6 +251,10 @@ bool Jit::LoadCompilerLibrary(std::string* error_msg) {
     dlclose(jit_library_handle_);
     return false;
   }
+#ifdef ART_MCR_RT
+  jit_compile_method_llvm_ = reinterpret_cast<void* (*)(void*, ArtMethod*, Thread*)>(
+      dlsym(jit_library_handle_, "jit_compile_method_llvm"));
+#endif
   return true;
 }
 
@@ -295,6 +307,59 @@ bool Jit::CompileMethod(ArtMethod* method, Thread* self, bool baseline, bool osr
   return success;
 }
 
+#ifdef ART_MCR_RT
+/**
+ * @brief Compiles the method with LLVM (in the JIT thread pool, like the
+ *        rest), and makes its entrypoint the bridge to the LLVM code.
+ */
+bool Jit::CompileMethodLlvm(ArtMethod* method, Thread* self) {
+  DCHECK(jit_compile_method_llvm_ != nullptr);
+  instrumentation::Instrumentation* instrumentation = Runtime::Current()->GetInstrumentation();
+  if (instrumentation->AreAllMethodsDeoptimized() || instrumentation->IsDeoptimized(method) ||
+      instrumentation->AreExitStubsInstalled()) {
+    VLOG(jit) << "JIT not compiling " << method->PrettyMethod() << " to LLVM: instrumented";
+    return false;
+  }
+
+  VLOG(jit) << "Compiling method to LLVM " << ArtMethod::PrettyMethod(method);
+  void* code = jit_compile_method_llvm_(jit_compiler_handle_, method, self);
+  if (code == nullptr) {
+    VLOG(jit) << "Failed to compile method to LLVM " << ArtMethod::PrettyMethod(method);
+    return false;
+  }
+  return mcr::OptimizingInterface::InstallJitCode(self, method, code);
+}
+
+uint16_t Jit::LlvmMethodThreshold() const {
+  // Past the OSR threshold: the method stays hot with optimizing JIT code
+  size_t threshold = OSRMethodThreshold() * 2;
+  if (threshold > std::numeric_limits<uint16_t>::max()) {
+    threshold = RoundDown(std::numeric_limits<uint16_t>::max(), kJitSamplesBatchSize);
+  }
+  return static_cast<uint16_t>(threshold);
+}
+
+void Jit::MaybeCompileMethodLlvm(Thread* self,
+                                 ArtMethod* method,
+                                 uint32_t old_count,
+                                 uint32_t new_count) {
+  if (!mcr::McrRT::IsLlvmJit() || jit_compile_method_llvm_ == nullptr || method->IsNative()) {
+    return;
+  }
+  const bool hot = old_count < HotMethodThreshold() && new_count >= HotMethodThreshold();
+  const bool very_hot = old_count < LlvmMethodThreshold() && new_count >= LlvmMethodThreshold();
+  if (!hot && !very_hot) {
+    return;
+  }
+  // The task runs after the optimizing one (a single worker): the LLVM code replaces it
+  const bool listed = mcr::McrRT::IsLlvmJitMethod(method->PrettyMethod());
+  if (listed ? hot : very_hot) {
+    DCHECK(thread_pool_ != nullptr);
+    thread_pool_->AddTask(self, new JitCompileTask(method, JitCompileTask::TaskKind::kCompileLlvm));
+  }
+}
+#endif
+
 void Jit::WaitForWorkersToBeCreated() {
   if (thread_pool_ != nullptr) {
     thread_pool_->WaitForWorkersToBeCreated();
@@ -561,6 +626,9 @@ class JitCompileTask final : public Task {
     kCompile,
     kCompileBaseline,
     kCompileOsr,
+#ifdef ART_MCR_RT
+    kCompileLlvm,
+#endif
   };
 
   JitCompileTask(ArtMethod* method, TaskKind kind) : method_(method), kind_(kind), klass_(nullptr) {
@@ -593,6 +661,12 @@ class JitCompileTask final : public Task {
             /* osr= */ (kind_ == TaskKind::kCompileOsr));
         break;
       }
+#ifdef ART_MCR_RT
+      case TaskKind::kCompileLlvm: {
+        Runtime::Current()->GetJit()->CompileMethodLlvm(method_, self);
+        break;
+      }
+#endif
       case TaskKind::kAllocateProfile: {
         if (ProfilingInfo::Create(self, method_, /* retry_allocation= */ true)) {
           VLOG(jit) << "Start profiling " << ArtMethod::PrettyMethod(method_);
@@ -910,6 +984,9 @@ bool Jit::MaybeCompileMethod(Thread* self,
             self, new JitCompileTask(method, JitCompileTask::TaskKind::kCompileOsr));
       }
     }
+#ifdef ART_MCR_RT
+    MaybeCompileMethodLlvm(self, method, old_count, new_count);
+#endif
   }
   return true;
 }
@@ -173,6 +173,11 @@ class Jit {
   bool CompileMethod(ArtMethod* method, Thread* self, bool baseline, bool osr)
       REQUIRES_SHARED(Locks::mutator_lock_);
 
+#ifdef ART_MCR_RT
+  bool CompileMethodLlvm(ArtMethod* method, Thread* self)
+      REQUIRES_SHARED(Locks::mutator_lock_);
+#endif
+
   const JitCodeCache* GetCodeCache() const {
     return code_cache_;
   }
@@ -335,12 +340,27 @@ class Jit {
 
   static bool BindCompilerMethods(std::string* error_msg);
 
+#ifdef ART_MCR_RT
+  // LLVM JIT tier (mcr::McrRT::IsLlvmJit): queues the methods of the LLVM
+  // profile once hot, and the rest once past LlvmMethodThreshold.
+  void MaybeCompileMethodLlvm(Thread* self,
+                              ArtMethod* method,
+                              uint32_t old_count,
+                              uint32_t new_count)
+      REQUIRES_SHARED(Locks::mutator_lock_);
+  uint16_t LlvmMethodThreshold() const;
+#endif
+
   // JIT compiler
   static void* jit_library_handle_;
   static void* jit_compiler_handle_;
   static void* (*jit_load_)(void);
   static void (*jit_unload_)(void*);
   static bool (*jit_compile_method_)(void*, ArtMethod*, Thread*, bool, bool);
+#ifdef ART_MCR_RT
+  // optional: libart-compiler may be built without the LLVM backend
+  static void* (*jit_compile_method_llvm_)(void*, ArtMethod*, Thread*);
+#endif
   static void (*jit_types_loaded_)(void*, mirror::Class**, size_t count);
   static void (*jit_update_options_)(void*);
   static bool (*jit_generate_debug_info_)(void*);
@@ -1686,7 +1686,13 @@ void JitCodeCache::DoCollection(Thread* self, bool collect_profiling_info) {
       // Also remove the saved entry point from the ProfilingInfo objects.
       for (ProfilingInfo* info : profiling_infos_) {
         const void* ptr = info->GetMethod()->GetEntryPointFromQuickCompiledCode();
-        if (!ContainsPc(ptr) && !info->IsInUseByCompiler() && !IsInZygoteDataSpace(info)) {
+        bool keep_info = false;
+#ifdef ART_MCR_RT
+        // The bridge to the LLVM code reads it from the ProfilingInfo.
+        keep_info = info->GetLlvmCode() != nullptr;
+#endif
+        if (!keep_info && !ContainsPc(ptr) && !info->IsInUseByCompiler() &&
+            !IsInZygoteDataSpace(info)) {
           info->GetMethod()->SetProfilingInfo(nullptr);
         }
 
@@ -1905,6 +1911,18 @@ ProfilingInfo* JitCodeCache::AddProfilingInfo(Thread* self,
   return info;
 }
 
+#ifdef ART_MCR_RT
+bool JitCodeCache::SetLlvmCode(ArtMethod* method, void* code, Thread* self) {
+  MutexLock mu(self, lock_);
+  ProfilingInfo* info = method->GetProfilingInfo(kRuntimePointerSize);
+  if (info == nullptr) {
+    return false;
+  }
+  info->SetLlvmCode(code);
+  return true;
+}
+#endif
+
 ProfilingInfo* JitCodeCache::AddProfilingInfoInternal(Thread* self ATTRIBUTE_UNUSED,
                                                       ArtMethod* method,
                                                       const std::vector<uint32_t>& entries) {
@@ -215,6 +215,14 @@ class JitCodeCache {
       REQUIRES(!lock_)
       REQUIRES_SHARED(Locks::mutator_lock_);
 
+#ifdef ART_MCR_RT
+  // Stores the LLVM code of 'method' in its 'ProfilingInfo', which is then
+  // not collected. Returns false if the method has no 'ProfilingInfo'.
+  bool SetLlvmCode(ArtMethod* method, void* code, Thread* self)
+      REQUIRES(!lock_)
+      REQUIRES_SHARED(Locks::mutator_lock_);
+#endif
+
   bool OwnsSpace(const void* mspace) const NO_THREAD_SAFETY_ANALYSIS {
     return mspace == data_mspace_ || mspace == exec_mspace_;
   }
@@ -28,6 +28,9 @@ namespace art {
 ProfilingInfo::ProfilingInfo(ArtMethod* method, const std::vector<uint32_t>& entries)
       : method_(method),
         saved_entry_point_(nullptr),
+#ifdef ART_MCR_RT
+        llvm_code_(nullptr),
+#endif
         number_of_inline_caches_(entries.size()),
         current_inline_uses_(0),
         is_method_being_compiled_(false),
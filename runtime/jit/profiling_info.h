@@ -99,6 +99,18 @@ class ProfilingInfo {
     return saved_entry_point_;
   }
 
+#ifdef ART_MCR_RT
+  // Code of the LLVM JIT tier: the JIT code cache keeps this object
+  // while it is set (see JitCodeCache::SetLlvmCode).
+  void SetLlvmCode(void* code) {
+    llvm_code_ = code;
+  }
+
+  void* GetLlvmCode() const {
+    return llvm_code_;
+  }
+#endif
+
   void ClearGcRootsInInlineCaches() {
     for (size_t i = 0; i < number_of_inline_caches_; ++i) {
       InlineCache* cache = &cache_[i];
@@ -141,6 +153,11 @@ class ProfilingInfo {
   // is poking for the liveness of compiled code.
   const void* saved_entry_point_;
 
+#ifdef ART_MCR_RT
+  // Entry of the LLVM code of the method, read by the quick to LLVM bridge.
+  void* llvm_code_;
+#endif
+
   // Number of instructions we are profiling in the ArtMethod.
   const uint32_t number_of_inline_caches_;
 
@@ -43,8 +43,10 @@
 #include "mcr_rt/art_impl_arch-inl.h"
 #include "mcr_rt/invoke.h"
 #include "mcr_rt/invoke_info.h"
+#include "mcr_rt/invoke_profile.h"
 #include "mcr_rt/mcr_dbg.h"
 #include "mcr_rt/utils.h"
+#include "mirror/class-inl.h"
 #include "mirror/class_loader.h"
 #include "mirror/object-inl.h"
 #include "nativehelper/scoped_local_ref.h"
@@ -210,9 +212,6 @@ void AddToInvokeHistogram(mirror::Object* receiver, ArtMethod* caller,
   D3CHECK(dex_file != nullptr) << ": DexFile from method is null: " << method_resolved->PrettyMethod();
   D3CHECK(receiver->GetClass() != nullptr) << ": class of receiver is null";
   D3CHECK(caller->GetDeclaringClass() != nullptr) << ": caller declaring class is null";
-  std::string dex_location = dex_file->GetLocation();
-  std::string dex_base_location = DexFileLoader::GetBaseLocation(dex_location);
-  std::string dex_location_caller = caller->GetDexFile()->GetLocation();
 
 #ifdef CRDEBUG3
   prtDebug = true;
@@ -248,19 +247,27 @@ void AddToInvokeHistogram(mirror::Object* receiver, ArtMethod* caller,
       // << "\nSpec: " << method_resolved->PrettyMethod() << extra
       << "\nClass:" << LLVM::PrettyClass(receiver->GetClass())
       << "\nInvokeType: " << method_resolved->GetInvokeType()
-      << "\nDexLocation: " << dex_location
-      << "\nDexLocation:Base: " << dex_base_location;
+      << "\nDexLocation: " << dex_file->GetLocation()
+      << "\nDexLocation:Base: "
+      << DexFileLoader::GetBaseLocation(dex_file->GetLocation());
   }
 
-  mcr::InvokeInfo info(caller->GetDexMethodIndex(),
+  // The type index of the receiver class is in its own dex file, which is
+  // not the callee's when it inherits the method (multi-dex, boot classpath).
+  // Proxies and arrays have none, so they are never speculated.
+  ObjPtr<mirror::Class> klass = receiver->GetClass();
+  const bool has_dex_type = !klass->IsProxyClass() && !klass->IsArrayClass();
+  const DexFile* class_dex = has_dex_type ? &klass->GetDexFile() : dex_file;
+  const uint32_t class_idx = has_dex_type ?
+    klass->GetDexTypeIndex().index_ : dex::kDexNoIndex16;
+
+  // No strings here: the dex locations are resolved when flushing
+  mcr::InvokeProfile::Add(caller->GetDexFile(), dex_file, class_dex,
+      caller->GetDexMethodIndex(),
       dex_pc,
-      receiver->GetClass()->GetDexTypeIndex().index_,
+      class_idx,
       method_resolved->GetDexMethodIndex(),
-      method_resolved->GetInvokeType(),
-      dex_location_caller,
-      dex_base_location,
-      dex_location);
-  mcr::InvokeInfo::AddToCache(info);
+      method_resolved->GetInvokeType());
 }
 
 #ifdef MCR_LLVM_GEN_INVOKE_HIST_ON_CACHE_MISS
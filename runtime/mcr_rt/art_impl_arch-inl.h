@@ -19,12 +19,18 @@
 
 #include "mcr_rt/art_impl_arch_arm-inl.h"
 #include "mcr_rt/mcr_rt.h"
+#include "thread.h"
 
 namespace art {
 namespace LLVM {
 
 static inline Thread* GetLLVMThreadPointer() {
+#if defined(__x86_64__)
+  // No reserved register: LLVM code reads self through gs, like the runtime
+  return Thread::Current();
+#else
   return reinterpret_cast<Thread*>(Arm::GetLLVMThreadPointer());
+#endif
 }
 
 }  // namespace LLVM
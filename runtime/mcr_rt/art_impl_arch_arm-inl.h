@@ -70,7 +70,7 @@ namespace Arm {
 #define __LLVM_MR_REG LLVM_MR_REG_ARM64
 #endif
 
-#ifdef ART_MCR_RT
+#if defined(ART_MCR_RT) && (defined(__arm__) || defined(__aarch64__))
 static inline void* GetLLVMThreadPointer() {
   uintptr_t thread_pointer;
   REG_GET("mov", __LLVM_THREAD_REG, thread_pointer);
@@ -0,0 +1,216 @@
+/**
+ * Runtime side of the branch profile: the counters of the LLVM code, that
+ * the compiler turns into branch weights (see branch_profile.h).
+ *
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "mcr_rt/branch_profile.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+
+#include "art_method-inl.h"
+#include "base/bit_utils.h"
+#include "dex/dex_file.h"
+#include "mcr_rt/flush_task.h"
+#include "mcr_rt/mcr_rt.h"
+#include "mcr_rt/utils.h"
+
+namespace art {
+namespace mcr {
+
+constexpr uint8_t BranchProfile::kMagic[];
+
+std::vector<BranchProfile::Method> BranchProfile::methods_;
+
+namespace {
+
+// Guards BranchProfile::methods_, and serializes the appends
+std::mutex methods_lock_;
+// counters of the registered methods
+std::set<uint32_t*> registered_;
+
+}  // namespace
+
+std::string BranchProfile::GetDeltaFilename() {
+  return GetFileApp(FILE_BRANCH_PROFILE_DELTA);
+}
+
+void BranchProfile::Register(ArtMethod* method, uint32_t* counters,
+                             const Site* sites, uint32_t num_sites) {
+  bool first_method;
+  {
+    std::lock_guard<std::mutex> lock(methods_lock_);
+    // the counters are a global of the code of the method
+    if (!registered_.insert(counters).second) return;
+    first_method = methods_.empty();
+    methods_.push_back(Method { method->GetDexFile()->GetLocation(),
+        method->GetDexMethodIndex(), counters, sites, num_sites });
+  }
+  D2LOG(INFO) << "BranchProfile: " << num_sites << " counters: "
+    << method->PrettyMethod();
+
+  if (first_method) {
+    FlushTask::Add(Flush);
+  }
+}
+
+void BranchProfile::Unload() {
+  Flush();
+  std::lock_guard<std::mutex> lock(methods_lock_);
+  methods_.clear();
+  registered_.clear();
+}
+
+bool BranchProfile::Flush() {
+  std::lock_guard<std::mutex> lock(methods_lock_);
+  if (methods_.empty()) return true;
+
+  // Chunk-local string table
+  std::vector<std::string> strings;
+  std::unordered_map<std::string, uint32_t> ids;
+  auto intern = [&](const std::string& str) -> uint32_t {
+    auto it = ids.find(str);
+    if (it != ids.end()) return it->second;
+    uint32_t id = strings.size();
+    strings.push_back(str);
+    ids.emplace(str, id);
+    return id;
+  };
+
+  std::vector<ChunkRecord> records;
+  for (const Method& m : methods_) {
+    auto* counters = reinterpret_cast<std::atomic<uint32_t>*>(m.counters_);
+    for (uint32_t i = 0; i < m.num_sites_; i++) {
+      uint32_t count = counters[i].exchange(0, std::memory_order_relaxed);
+      if (count == 0) continue;
+      ChunkRecord record;
+      record.dex_location_ = intern(m.dex_location_);
+      record.method_idx_ = m.method_idx_;
+      record.block_id_ = m.sites_[i].block_id_;
+      record.dex_pc_ = m.sites_[i].dex_pc_;
+      record.successor_ = m.sites_[i].successor_;
+      record.count_ = count;
+      records.push_back(record);
+    }
+  }
+  if (records.empty()) return true;
+
+  std::string string_data;
+  for (const std::string& str : strings) {
+    string_data.append(str);
+    string_data.push_back('\0');
+  }
+  string_data.resize(RoundUp(string_data.size(), sizeof(uint32_t)), '\0');
+
+  ChunkHeader header;
+  memcpy(header.magic_, kMagic, sizeof(kMagic));
+  header.num_strings_ = strings.size();
+  header.strings_size_ = string_data.size();
+  header.num_records_ = records.size();
+
+  std::vector<uint8_t> chunk;
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&header);
+  chunk.insert(chunk.end(), bytes, bytes + sizeof(header));
+  chunk.insert(chunk.end(), string_data.begin(), string_data.end());
+  bytes = reinterpret_cast<const uint8_t*>(records.data());
+  chunk.insert(chunk.end(), bytes, bytes + sizeof(ChunkRecord) * records.size());
+
+  std::string filename = GetDeltaFilename();
+  int fd = open(filename.c_str(), O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0666);
+  if (fd < 0) {
+    DLOG(ERROR) << "BranchProfile: can't open: " << filename;
+    return false;
+  }
+  ssize_t written = TEMP_FAILURE_RETRY(write(fd, chunk.data(), chunk.size()));
+  close(fd);
+  chmod(filename.c_str(), 0666);
+  if (written != static_cast<ssize_t>(chunk.size())) {
+    DLOG(ERROR) << "BranchProfile: failed to append to: " << filename;
+    return false;
+  }
+
+  D2LOG(INFO) << "BranchProfile: flushed: " << records.size() << " counters";
+  return true;
+}
+
+/**
+ * @brief Used by the compiler (BranchProfileIndex).
+ *        A truncated trailing chunk is ignored.
+ */
+bool BranchProfile::ReadDeltas(std::string filename, std::vector<Record>* records) {
+  std::ifstream in(filename, std::ifstream::binary);
+  if (!in) return false;
+  std::vector<char> data((std::istreambuf_iterator<char>(in)),
+                         std::istreambuf_iterator<char>());
+
+  size_t pos = 0;
+  int chunks = 0;
+  while (pos + sizeof(ChunkHeader) <= data.size()) {
+    ChunkHeader header;
+    memcpy(&header, data.data() + pos, sizeof(header));
+    if (memcmp(header.magic_, kMagic, sizeof(kMagic)) != 0) {
+      DLOG(ERROR) << "BranchProfile: corrupted delta at: " << pos;
+      return false;
+    }
+    const size_t records_size = sizeof(ChunkRecord) * header.num_records_;
+    const size_t chunk_size = sizeof(header) + header.strings_size_ + records_size;
+    if (pos + chunk_size > data.size()) {
+      DLOG(WARNING) << "BranchProfile: truncated delta at: " << pos;
+      break;
+    }
+
+    const char* str = data.data() + pos + sizeof(header);
+    const char* str_end = str + header.strings_size_;
+    std::vector<std::string> strings;
+    while (str < str_end && strings.size() < header.num_strings_) {
+      strings.push_back(str);
+      str += strings.back().size() + 1;
+    }
+    if (strings.size() != header.num_strings_) {
+      DLOG(ERROR) << "BranchProfile: corrupted strings at: " << pos;
+      return false;
+    }
+
+    const char* rec = data.data() + pos + sizeof(header) + header.strings_size_;
+    for (uint32_t i = 0; i < header.num_records_; i++) {
+      ChunkRecord r;
+      memcpy(&r, rec + i * sizeof(ChunkRecord), sizeof(r));
+      if (r.dex_location_ >= strings.size()) {
+        DLOG(ERROR) << "BranchProfile: corrupted record at: " << pos;
+        return false;
+      }
+      records->push_back(Record { strings[r.dex_location_], r.method_idx_,
+          Site { r.block_id_, r.dex_pc_, r.successor_ }, r.count_ });
+    }
+    pos += chunk_size;
+    chunks++;
+  }
+
+  D3LOG(INFO) << "BranchProfile: read " << chunks << " delta chunks";
+  return true;
+}
+
+}  // namespace mcr
+}  // namespace art
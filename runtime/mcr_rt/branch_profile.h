@@ -0,0 +1,122 @@
+/**
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef ART_RUNTIME_MCR_RT_BRANCH_PROFILE_H_
+#define ART_RUNTIME_MCR_RT_BRANCH_PROFILE_H_
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "base/locks.h"
+#include "base/macros.h"
+
+#define FILE_BRANCH_PROFILE_DELTA "branch.prof.delta"
+
+namespace art {
+
+class ArtMethod;
+class DexFile;
+
+namespace mcr {
+
+/**
+ * @brief Branch counters of LLVM code that was generated with
+ *        opt.profile_branches.
+ *
+ * Each method has a counter for its entry, and one for each successor of
+ * its HIf and HPackedSwitch instructions, that the LLVM code increments
+ * (without synchronization: counts are approximate). A constant table has
+ * the site of each counter. The InitInner methods register both
+ * (art_llvm_register_branch_profile), and the FlushTask periodically
+ * appends the non-zero counts to branch.prof.delta, and clears them.
+ *
+ * A site is the HBasicBlock id of the branch (unique in the HGraph, even
+ * with inlined code), its dex pc (to discard counts of a different HGraph),
+ * and the index of the successor.
+ *
+ * Delta file: a sequence of chunks, one per flush:
+ *   ChunkHeader
+ *   char strings[strings_size]      (NUL terminated, padded to 4 bytes)
+ *   ChunkRecord records[num_records]
+ */
+class BranchProfile final {
+ public:
+  struct Site {
+    uint32_t block_id_;
+    uint32_t dex_pc_;
+    uint32_t successor_;
+  };
+
+  struct Record {
+    std::string dex_location_;
+    uint32_t method_idx_;
+    Site site_;
+    uint32_t count_;
+  };
+
+  // block_id_ of the entry counter
+  static constexpr uint32_t kMethodEntry = 0xFFFFFFFF;
+
+  // Once per method: both of its InitInner methods call it
+  static void Register(ArtMethod* method, uint32_t* counters,
+                       const Site* sites, uint32_t num_sites)
+    REQUIRES_SHARED(Locks::mutator_lock_);
+  // Flushes the counters of the code that is about to be unloaded
+  static void Unload();
+  // Appends a delta chunk. Returns false on I/O errors.
+  static bool Flush();
+
+  static bool ReadDeltas(std::string filename, std::vector<Record>* records);
+  static std::string GetDeltaFilename();
+
+ private:
+  static constexpr uint8_t kMagic[] = { 'b', 'p', 'd', '1' };
+
+  struct Method {
+    // not the DexFile: it may be unloaded before a flush
+    std::string dex_location_;
+    uint32_t method_idx_;
+    uint32_t* counters_;
+    const Site* sites_;
+    uint32_t num_sites_;
+  };
+
+  struct ChunkHeader {
+    uint8_t magic_[4];
+    uint32_t num_strings_;
+    uint32_t strings_size_;
+    uint32_t num_records_;
+  };
+
+  struct ChunkRecord {
+    uint32_t dex_location_;  // string id of the chunk
+    uint32_t method_idx_;
+    uint32_t block_id_;
+    uint32_t dex_pc_;
+    uint32_t successor_;
+    uint32_t count_;
+  };
+
+  static std::vector<Method> methods_;
+
+  DISALLOW_IMPLICIT_CONSTRUCTORS(BranchProfile);
+};
+
+}  // namespace mcr
+}  // namespace art
+
+#endif  // ART_RUNTIME_MCR_RT_BRANCH_PROFILE_H_
@@ -0,0 +1,85 @@
+/**
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "mcr_rt/flush_task.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "mcr_rt/mcr_rt.h"
+
+namespace art {
+namespace mcr {
+
+std::mutex FlushTask::lock_;
+std::condition_variable FlushTask::cond_;
+std::vector<FlushTask::FlushFn> FlushTask::flushes_;
+std::thread FlushTask::thread_;
+bool FlushTask::shutdown_ = false;
+
+void FlushTask::Add(FlushFn fn) {
+  std::lock_guard<std::mutex> lock(lock_);
+  if (shutdown_) return;
+  if (std::find(flushes_.begin(), flushes_.end(), fn) != flushes_.end()) {
+    return;
+  }
+  flushes_.push_back(fn);
+  if (!thread_.joinable()) {
+    thread_ = std::thread(Run);
+  }
+}
+
+void FlushTask::Shutdown() {
+  {
+    std::lock_guard<std::mutex> lock(lock_);
+    if (shutdown_) return;
+    shutdown_ = true;
+  }
+  cond_.notify_all();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+  FlushAll();
+  D2LOG(INFO) << "FlushTask: stopped";
+}
+
+void FlushTask::Run() {
+  std::unique_lock<std::mutex> lock(lock_);
+  while (!cond_.wait_for(lock, std::chrono::seconds(kIntervalSec),
+                         []() { return shutdown_; })) {
+    lock.unlock();
+    FlushAll();
+    lock.lock();
+  }
+}
+
+/**
+ * @brief Not under lock_: a flush may take a while, and Add may be called
+ *        meanwhile (e.g. by a thread that enters LLVM code).
+ */
+void FlushTask::FlushAll() {
+  std::vector<FlushFn> flushes;
+  {
+    std::lock_guard<std::mutex> lock(lock_);
+    flushes = flushes_;
+  }
+  for (FlushFn fn : flushes) {
+    fn();
+  }
+}
+
+}  // namespace mcr
+}  // namespace art
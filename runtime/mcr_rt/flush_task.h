@@ -0,0 +1,65 @@
+/**
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef ART_RUNTIME_MCR_RT_FLUSH_TASK_H_
+#define ART_RUNTIME_MCR_RT_FLUSH_TASK_H_
+
+#include <stdint.h>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "base/macros.h"
+
+namespace art {
+namespace mcr {
+
+/**
+ * @brief The one thread that periodically flushes the profiles of the
+ *        runtime (e.g. InvokeProfile::Flush), started by the first of them.
+ *
+ * Runtime::~Runtime stops it (Shutdown), before anything it flushes goes
+ * away, and then flushes each profile a last time.
+ */
+class FlushTask {
+ public:
+  typedef bool (*FlushFn)();
+
+  // Flushes fn periodically (once per fn)
+  static void Add(FlushFn fn);
+  // Joins the thread, and flushes a last time. No flushes after this.
+  static void Shutdown();
+
+ private:
+  static constexpr uint32_t kIntervalSec = 5;
+
+  static void Run();
+  static void FlushAll();
+
+  static std::mutex lock_;
+  static std::condition_variable cond_;
+  static std::vector<FlushFn> flushes_;
+  static std::thread thread_;
+  static bool shutdown_;
+
+  DISALLOW_IMPLICIT_CONSTRUCTORS(FlushTask);
+};
+
+}  // namespace mcr
+}  // namespace art
+
+#endif  // ART_RUNTIME_MCR_RT_FLUSH_TASK_H_
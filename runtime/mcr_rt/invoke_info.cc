@@ -38,7 +38,8 @@ std::string InvokeInfo::GetFilename() {
 InvokeInfo InvokeInfo::ParseLine(std::string line) {
   D3LOG(INFO) << "line: " << line;
   size_t n = std::count(line.begin(), line.end(), InvokeInfo::sep_);
-  CHECK(n == 8) << "InvokeInfo: problem parsing line: '" << line
+  // 9: with the dex location of the speculated class
+  CHECK(n == 8 || n == 9) << "InvokeInfo: problem parsing line: '" << line
     << "' Tokens: " << n;
 
   size_t p = line.find(InvokeInfo::sep_);
@@ -86,6 +87,15 @@ InvokeInfo InvokeInfo::ParseLine(std::string line) {
   CHECK(p != std::string::npos);
   std::string sspec_iinvoke_type = line.substr(0, p);
 
+  // dex location of the speculated class
+  std::string spec_class_dex_location;
+  if (n == 9) {
+    line = line.substr(p + 1, line.size() - p + 1);
+    p = line.find(InvokeInfo::sep_);
+    CHECK(p != std::string::npos);
+    spec_class_dex_location = line.substr(0, p);
+  }
+
   // Invoke times
   line = line.substr(p + 1, line.size() - p + 1);
   std::string sinvoke_times(line);
@@ -102,7 +112,8 @@ InvokeInfo InvokeInfo::ParseLine(std::string line) {
                     spec_dex_class_idx, spec_dex_method_idx,
                     spec_invoke_type,
                     dex_location_caller,
-                    dex_filename, dex_location, invoke_times);
+                    dex_filename, dex_location, invoke_times,
+                    spec_class_dex_location);
 }
 
 void InvokeInfo::AddToCache(InvokeInfo newinfo) {
@@ -185,6 +196,9 @@ std::string InvokeInfo::str() const {
            InvokeInfo::sep_ + std::to_string(GetSpecClassIdx()) +
            InvokeInfo::sep_ + std::to_string(GetSpecMethodIdx()) +
            InvokeInfo::sep_ + std::to_string(GetSpecInvokeTypeInt());
+  if (HasSpecClassDexLocation()) {
+    result += InvokeInfo::sep_ + spec_class_dex_location_;
+  }
   return result;
 }
 
@@ -196,6 +210,7 @@ std::string InvokeInfo::str_detailed() const {
            "\nDexLoc:" + GetDexLocation() +
            "\nDexPC:" + std::to_string(GetDexPC()) +
            "\nSpecClassIDX:" + std::to_string(GetSpecClassIdx()) +
+           "\nSpecClassDexLoc:" + GetSpecClassDexLocation() +
            "\nSpecMethodIDX:" + std::to_string(GetSpecMethodIdx()) +
            "\nSpecInvokeType:" + std::to_string(GetSpecInvokeTypeInt());
   return result;
@@ -216,6 +231,10 @@ bool operator<(InvokeInfo const& lhs, InvokeInfo const& rhs) {
       // classes.dex file inside of an apk or jar
       if (cmp_dex_location == 0) {
         // speculative class
+        if (lhs.GetSpecClassIdx() == rhs.GetSpecClassIdx() &&
+            lhs.GetSpecClassDexLocation() != rhs.GetSpecClassDexLocation()) {
+          return lhs.GetSpecClassDexLocation() < rhs.GetSpecClassDexLocation();
+        }
         if (lhs.GetSpecClassIdx() == rhs.GetSpecClassIdx()) {
           // speculative method idx (it's declaring method might
           // not be in the speculative class)
@@ -39,7 +39,8 @@ class InvokeInfo final {
              InvokeType spec_invoke_type,
              std::string dex_location_caller,
              std::string dex_filename, std::string dex_location,
-             uint32_t invoke_times)
+             uint32_t invoke_times,
+             std::string spec_class_dex_location = "")
       : caller_method_idx_(caller_method_idx),
         dex_pc_(dex_pc),
         spec_class_idx_(spec_class_idx),
@@ -48,6 +49,7 @@ class InvokeInfo final {
         dex_location_caller_(dex_location_caller),
         dex_filename_(dex_filename),
         dex_location_(dex_location),
+        spec_class_dex_location_(spec_class_dex_location),
         invoke_times_(invoke_times) {
   }
   InvokeInfo(uint16_t caller_method_idx, uint32_t dex_pc,
@@ -62,6 +64,7 @@ class InvokeInfo final {
                    dex_filename, dex_location, 1) {
   }
 
+  // Compile-time additions only (dex2oat). The runtime uses InvokeProfile.
   static std::map<std::string, uint32_t> shistogram_;
 
   static std::string GetFilename();
@@ -82,6 +85,16 @@ class InvokeInfo final {
     return spec_class_idx_;
   }
 
+  // Dex file of the receiver class, where GetSpecClassIdx is a type index.
+  // Histograms of older versions have none: the callee's dex file.
+  std::string GetSpecClassDexLocation() const {
+    return HasSpecClassDexLocation() ? spec_class_dex_location_ : dex_location_;
+  }
+
+  bool HasSpecClassDexLocation() const {
+    return !spec_class_dex_location_.empty();
+  }
+
   uint32_t GetSpecMethodIdx() const {
     return spec_method_idx_;
   }
@@ -131,6 +144,7 @@ class InvokeInfo final {
   const std::string dex_location_caller_;
   const std::string dex_filename_;  // base location
   const std::string dex_location_;
+  const std::string spec_class_dex_location_;
   uint32_t invoke_times_;
 };
 
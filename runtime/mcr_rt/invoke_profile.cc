@@ -0,0 +1,386 @@
+/**
+ * Runtime collection of the invoke histogram.
+ *
+ * Previously every resolved virtual/interface call built an InvokeInfo
+ * (three std::string), formatted it, and bumped an unsynchronized
+ * std::map. The whole text histogram was then re-read and rewritten.
+ *
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "mcr_rt/invoke_profile.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <unordered_map>
+
+#include "base/bit_utils.h"
+#include "dex/dex_file.h"
+#include "dex/dex_file_loader.h"
+#include "mcr_rt/flush_task.h"
+#include "mcr_rt/mcr_rt.h"
+#include "mcr_rt/utils.h"
+
+namespace art {
+namespace mcr {
+
+constexpr uint8_t InvokeProfile::kMagic[];
+
+std::atomic<const DexFile*> InvokeProfile::dex_files_[kMaxDexFiles];
+InvokeProfile::Table* InvokeProfile::tables_ = nullptr;
+std::atomic<uint64_t> InvokeProfile::dropped_samples_(0);
+thread_local InvokeProfile::TableHolder InvokeProfile::thread_table_;
+
+namespace {
+
+// Guards InvokeProfile::tables_
+std::mutex tables_lock_;
+
+// Counts merged from the thread tables, not flushed yet
+std::mutex merged_lock_;
+std::unordered_map<InvokeProfile::Key, uint32_t, InvokeProfile::KeyHash> merged_;
+
+// Serializes the merges and the appends to the delta file
+std::mutex flush_lock_;
+
+inline uint32_t SaturatingAdd(uint32_t a, uint32_t b) {
+  return (a > UINT32_MAX - b) ? UINT32_MAX : a + b;
+}
+
+}  // namespace
+
+size_t InvokeProfile::KeyHash::operator()(const Key& key) const {
+  size_t hash = key.caller_dex_;
+  hash = hash * 31 + key.callee_dex_;
+  hash = hash * 31 + key.class_dex_;
+  hash = hash * 31 + key.caller_method_idx_;
+  hash = hash * 31 + key.dex_pc_;
+  hash = hash * 31 + key.spec_class_idx_;
+  hash = hash * 31 + key.spec_method_idx_;
+  hash = hash * 31 + key.spec_invoke_type_;
+  return hash;
+}
+
+std::string InvokeProfile::GetDeltaFilename() {
+  return GetFileApp(FILE_INVOKE_HISTOGRAM_DELTA);
+}
+
+/**
+ * @brief Lock-free: slots are only ever claimed, never released,
+ *        as DexFiles live as long as the runtime.
+ *
+ * @return kMaxDexFiles when the table is full.
+ */
+uint32_t InvokeProfile::InternDexFile(const DexFile* dex_file) {
+  for (uint32_t i = 0; i < kMaxDexFiles; i++) {
+    const DexFile* cur = dex_files_[i].load(std::memory_order_acquire);
+    if (cur == dex_file) return i;
+    if (cur == nullptr) {
+      if (dex_files_[i].compare_exchange_strong(cur, dex_file,
+            std::memory_order_acq_rel) || cur == dex_file) {
+        return i;
+      }
+    }
+  }
+  return kMaxDexFiles;
+}
+
+InvokeProfile::TableHolder::~TableHolder() {
+  if (table_ != nullptr) {
+    table_->state_.store(TableState::kOrphan, std::memory_order_release);
+  }
+}
+
+InvokeProfile::Table* InvokeProfile::AcquireTable() {
+  bool first_table = false;
+  Table* table = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(tables_lock_);
+    for (Table* t = tables_; t != nullptr; t = t->next_) {
+      if (t->state_.load(std::memory_order_acquire) == TableState::kFree) {
+        table = t;
+        ClearTable(table);
+        break;
+      }
+    }
+
+    if (table == nullptr) {
+      first_table = (tables_ == nullptr);
+      // Zero-initialized: all slots unused
+      table = new Table();
+      table->next_ = tables_;
+      tables_ = table;
+    }
+    table->state_.store(TableState::kLive, std::memory_order_release);
+  }
+
+  if (first_table) {
+    FlushTask::Add(Flush);
+  }
+  return table;
+}
+
+/**
+ * @brief The keys of a recycled table belong to the call sites of its
+ *        previous (exited) thread, and its counts were already merged.
+ *        Called with tables_lock_ held, so no merge reads it meanwhile.
+ */
+void InvokeProfile::ClearTable(Table* table) {
+  for (uint32_t i = 0; i < kTableSize; i++) {
+    Slot& slot = table->slots_[i];
+    slot.used_.store(0, std::memory_order_relaxed);
+    slot.count_.store(0, std::memory_order_relaxed);
+    slot.key_ = Key();
+  }
+}
+
+inline InvokeProfile::Table* InvokeProfile::GetThreadTable() {
+  Table* table = thread_table_.table_;
+  if (UNLIKELY(table == nullptr)) {
+    table = AcquireTable();
+    thread_table_.table_ = table;
+  }
+  return table;
+}
+
+/**
+ * @brief Hot path. Only the owning thread claims slots, so a slot is
+ *        published with a release store of used_ once its key is set.
+ */
+void InvokeProfile::Add(const DexFile* caller_dex, const DexFile* callee_dex,
+                        const DexFile* class_dex,
+                        uint32_t caller_method_idx, uint32_t dex_pc,
+                        uint32_t spec_class_idx, uint32_t spec_method_idx,
+                        InvokeType spec_invoke_type) {
+  Key key;
+  key.caller_dex_ = InternDexFile(caller_dex);
+  key.callee_dex_ = InternDexFile(callee_dex);
+  key.class_dex_ = InternDexFile(class_dex);
+  if (UNLIKELY(key.caller_dex_ == kMaxDexFiles || key.callee_dex_ == kMaxDexFiles ||
+               key.class_dex_ == kMaxDexFiles)) {
+    dropped_samples_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  key.caller_method_idx_ = caller_method_idx;
+  key.dex_pc_ = dex_pc;
+  key.spec_class_idx_ = spec_class_idx;
+  key.spec_method_idx_ = spec_method_idx;
+  key.spec_invoke_type_ = static_cast<uint32_t>(spec_invoke_type);
+
+  Table* table = GetThreadTable();
+  size_t hash = KeyHash()(key);
+  for (uint32_t probe = 0; probe < kMaxProbes; probe++) {
+    Slot& slot = table->slots_[(hash + probe) & (kTableSize - 1)];
+    if (slot.used_.load(std::memory_order_relaxed) == 0) {
+      slot.key_ = key;
+      slot.count_.store(1, std::memory_order_relaxed);
+      slot.used_.store(1, std::memory_order_release);
+      return;
+    }
+    if (slot.key_ == key) {
+      slot.count_.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+  }
+  dropped_samples_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void InvokeProfile::MergeTable(Table* table) {
+  // An orphan will not be written again, so after this merge it is free
+  const bool orphan =
+    table->state_.load(std::memory_order_acquire) == TableState::kOrphan;
+
+  std::lock_guard<std::mutex> lock(merged_lock_);
+  for (uint32_t i = 0; i < kTableSize; i++) {
+    Slot& slot = table->slots_[i];
+    if (slot.used_.load(std::memory_order_acquire) == 0) continue;
+    uint32_t count = slot.count_.exchange(0, std::memory_order_relaxed);
+    if (count == 0) continue;
+    uint32_t& merged = merged_[slot.key_];
+    merged = SaturatingAdd(merged, count);
+  }
+
+  if (orphan) {
+    table->state_.store(TableState::kFree, std::memory_order_release);
+  }
+}
+
+void InvokeProfile::Merge() {
+  std::lock_guard<std::mutex> lock(tables_lock_);
+  for (Table* t = tables_; t != nullptr; t = t->next_) {
+    if (t->state_.load(std::memory_order_acquire) != TableState::kFree) {
+      MergeTable(t);
+    }
+  }
+}
+
+bool InvokeProfile::Flush() {
+  std::lock_guard<std::mutex> flush_lock(flush_lock_);
+  Merge();
+
+  std::unordered_map<Key, uint32_t, KeyHash> counts;
+  {
+    std::lock_guard<std::mutex> lock(merged_lock_);
+    counts.swap(merged_);
+  }
+  if (counts.empty()) return true;
+
+  // Chunk-local string table
+  std::vector<std::string> strings;
+  std::unordered_map<std::string, uint32_t> ids;
+  auto intern = [&](const std::string& str) -> uint32_t {
+    auto it = ids.find(str);
+    if (it != ids.end()) return it->second;
+    uint32_t id = strings.size();
+    strings.push_back(str);
+    ids.emplace(str, id);
+    return id;
+  };
+
+  std::vector<ChunkRecord> records;
+  for (const auto& pair : counts) {
+    const Key& key = pair.first;
+    const DexFile* caller_dex = dex_files_[key.caller_dex_].load(std::memory_order_acquire);
+    const DexFile* callee_dex = dex_files_[key.callee_dex_].load(std::memory_order_acquire);
+    const DexFile* class_dex = dex_files_[key.class_dex_].load(std::memory_order_acquire);
+    const std::string& dex_location = callee_dex->GetLocation();
+
+    ChunkRecord record;
+    record.dex_location_caller_ = intern(caller_dex->GetLocation());
+    record.dex_filename_ = intern(DexFileLoader::GetBaseLocation(dex_location));
+    record.dex_location_ = intern(dex_location);
+    record.dex_location_class_ = intern(class_dex->GetLocation());
+    record.caller_method_idx_ = key.caller_method_idx_;
+    record.dex_pc_ = key.dex_pc_;
+    record.spec_class_idx_ = key.spec_class_idx_;
+    record.spec_method_idx_ = key.spec_method_idx_;
+    record.spec_invoke_type_ = key.spec_invoke_type_;
+    record.count_ = pair.second;
+    records.push_back(record);
+  }
+
+  std::string string_data;
+  for (const std::string& str : strings) {
+    string_data.append(str);
+    string_data.push_back('\0');
+  }
+  string_data.resize(RoundUp(string_data.size(), sizeof(uint32_t)), '\0');
+
+  ChunkHeader header;
+  memcpy(header.magic_, kMagic, sizeof(kMagic));
+  header.num_strings_ = strings.size();
+  header.strings_size_ = string_data.size();
+  header.num_records_ = records.size();
+
+  std::vector<uint8_t> chunk;
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&header);
+  chunk.insert(chunk.end(), bytes, bytes + sizeof(header));
+  chunk.insert(chunk.end(), string_data.begin(), string_data.end());
+  bytes = reinterpret_cast<const uint8_t*>(records.data());
+  chunk.insert(chunk.end(), bytes, bytes + sizeof(ChunkRecord) * records.size());
+
+  // A single append: readers never see a partial chunk from this process
+  std::string filename = GetDeltaFilename();
+  int fd = open(filename.c_str(), O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0666);
+  if (fd < 0) {
+    DLOG(ERROR) << "InvokeProfile: can't open: " << filename;
+    return false;
+  }
+  ssize_t written = TEMP_FAILURE_RETRY(write(fd, chunk.data(), chunk.size()));
+  close(fd);
+  chmod(filename.c_str(), 0666);
+  if (written != static_cast<ssize_t>(chunk.size())) {
+    DLOG(ERROR) << "InvokeProfile: failed to append to: " << filename;
+    return false;
+  }
+
+  D2LOG(INFO) << "InvokeProfile: flushed: " << records.size() << " entries"
+    << " (dropped samples: " << GetDroppedSamples() << ")";
+  return true;
+}
+
+/**
+ * @brief Used by the compiler to fold the deltas into the histogram.
+ *        A truncated trailing chunk is ignored.
+ */
+bool InvokeProfile::ReadDeltas(std::string filename, std::vector<InvokeInfo>* entries) {
+  std::ifstream in(filename, std::ifstream::binary);
+  if (!in) return false;
+  std::vector<char> data((std::istreambuf_iterator<char>(in)),
+                         std::istreambuf_iterator<char>());
+
+  size_t pos = 0;
+  int chunks = 0;
+  while (pos + sizeof(ChunkHeader) <= data.size()) {
+    ChunkHeader header;
+    memcpy(&header, data.data() + pos, sizeof(header));
+    if (memcmp(header.magic_, kMagic, sizeof(kMagic)) != 0) {
+      DLOG(ERROR) << "InvokeProfile: corrupted delta at: " << pos;
+      return false;
+    }
+    const size_t records_size = sizeof(ChunkRecord) * header.num_records_;
+    const size_t chunk_size = sizeof(header) + header.strings_size_ + records_size;
+    if (pos + chunk_size > data.size()) {
+      DLOG(WARNING) << "InvokeProfile: truncated delta at: " << pos;
+      break;
+    }
+
+    const char* str = data.data() + pos + sizeof(header);
+    const char* str_end = str + header.strings_size_;
+    std::vector<std::string> strings;
+    while (str < str_end && strings.size() < header.num_strings_) {
+      strings.push_back(str);
+      str += strings.back().size() + 1;
+    }
+    if (strings.size() != header.num_strings_) {
+      DLOG(ERROR) << "InvokeProfile: corrupted strings at: " << pos;
+      return false;
+    }
+
+    const char* rec = data.data() + pos + sizeof(header) + header.strings_size_;
+    for (uint32_t i = 0; i < header.num_records_; i++) {
+      ChunkRecord r;
+      memcpy(&r, rec + i * sizeof(ChunkRecord), sizeof(r));
+      if (r.dex_location_caller_ >= strings.size() ||
+          r.dex_filename_ >= strings.size() ||
+          r.dex_location_ >= strings.size() ||
+          r.dex_location_class_ >= strings.size()) {
+        DLOG(ERROR) << "InvokeProfile: corrupted record at: " << pos;
+        return false;
+      }
+      entries->push_back(InvokeInfo(r.caller_method_idx_, r.dex_pc_,
+            r.spec_class_idx_, r.spec_method_idx_,
+            static_cast<InvokeType>(r.spec_invoke_type_),
+            strings[r.dex_location_caller_],
+            strings[r.dex_filename_],
+            strings[r.dex_location_],
+            r.count_,
+            strings[r.dex_location_class_]));
+    }
+    pos += chunk_size;
+    chunks++;
+  }
+
+  D3LOG(INFO) << "InvokeProfile: read " << chunks << " delta chunks";
+  return true;
+}
+
+}  // namespace mcr
+}  // namespace art
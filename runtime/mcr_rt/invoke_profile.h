@@ -0,0 +1,166 @@
+/**
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef ART_RUNTIME_MCR_INVOKE_PROFILE_H_
+#define ART_RUNTIME_MCR_INVOKE_PROFILE_H_
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "base/macros.h"
+#include "dex/invoke_type.h"
+#include "mcr_rt/invoke_info.h"
+
+#define FILE_INVOKE_HISTOGRAM_DELTA "invoke.hist.delta"
+
+namespace art {
+class DexFile;
+
+namespace mcr {
+
+/**
+ * @brief Collects the invoke histogram at runtime, without locks or
+ *        allocations on the hot path.
+ *
+ * Each thread counts into its own fixed-size table, keyed by integers
+ * (dex files are interned). A background task periodically merges the
+ * tables and appends the counts as a binary delta to invoke.hist.delta.
+ * The text histogram is never rewritten by the runtime: the compiler
+ * (InvokeHistogramIndex) folds the deltas in.
+ *
+ * Delta file: a sequence of chunks, one per flush:
+ *   ChunkHeader
+ *   char strings[strings_size]      (NUL terminated, padded to 4 bytes)
+ *   ChunkRecord records[num_records]
+ */
+class InvokeProfile final {
+ public:
+  struct Key {
+    uint32_t caller_dex_;  // interned
+    uint32_t callee_dex_;  // interned
+    uint32_t class_dex_;   // interned: of the receiver class
+    uint32_t caller_method_idx_;
+    uint32_t dex_pc_;
+    uint32_t spec_class_idx_;
+    uint32_t spec_method_idx_;
+    uint32_t spec_invoke_type_;
+
+    bool operator==(const Key& rhs) const {
+      return caller_dex_ == rhs.caller_dex_ &&
+        callee_dex_ == rhs.callee_dex_ &&
+        class_dex_ == rhs.class_dex_ &&
+        caller_method_idx_ == rhs.caller_method_idx_ &&
+        dex_pc_ == rhs.dex_pc_ &&
+        spec_class_idx_ == rhs.spec_class_idx_ &&
+        spec_method_idx_ == rhs.spec_method_idx_ &&
+        spec_invoke_type_ == rhs.spec_invoke_type_;
+    }
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+
+  static void Add(const DexFile* caller_dex, const DexFile* callee_dex,
+                  const DexFile* class_dex,
+                  uint32_t caller_method_idx, uint32_t dex_pc,
+                  uint32_t spec_class_idx, uint32_t spec_method_idx,
+                  InvokeType spec_invoke_type);
+
+  // Moves the counts of all thread tables to the merged counts
+  static void Merge();
+  // Merges and appends a delta chunk. Returns false on I/O errors.
+  static bool Flush();
+
+  static bool ReadDeltas(std::string filename, std::vector<InvokeInfo>* entries);
+  static std::string GetDeltaFilename();
+
+  static uint64_t GetDroppedSamples() {
+    return dropped_samples_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  static constexpr uint32_t kMaxDexFiles = 256;
+  static constexpr uint32_t kTableSize = 1024;  // power of 2
+  static constexpr uint32_t kMaxProbes = 16;
+  static constexpr uint8_t kMagic[] = { 'i', 'h', 'd', '2' };
+
+  struct Slot {
+    std::atomic<uint32_t> used_;
+    Key key_;
+    std::atomic<uint32_t> count_;
+  };
+
+  enum class TableState : uint32_t {
+    kLive,     // owned by a thread
+    kOrphan,   // its thread exited, it needs one more merge
+    kFree,     // merged, can be adopted by a new thread
+  };
+
+  struct Table {
+    Slot slots_[kTableSize];
+    std::atomic<TableState> state_;
+    Table* next_;
+  };
+
+  // Releases the table of a thread when that thread exits
+  struct TableHolder {
+    ~TableHolder();
+    Table* table_ = nullptr;
+  };
+
+  struct ChunkHeader {
+    uint8_t magic_[4];
+    uint32_t num_strings_;
+    uint32_t strings_size_;
+    uint32_t num_records_;
+  };
+
+  struct ChunkRecord {
+    // string ids of the chunk
+    uint32_t dex_location_caller_;
+    uint32_t dex_filename_;
+    uint32_t dex_location_;
+    uint32_t dex_location_class_;
+
+    uint32_t caller_method_idx_;
+    uint32_t dex_pc_;
+    uint32_t spec_class_idx_;
+    uint32_t spec_method_idx_;
+    uint32_t spec_invoke_type_;
+    uint32_t count_;
+  };
+
+  static uint32_t InternDexFile(const DexFile* dex_file);
+  static Table* GetThreadTable();
+  static Table* AcquireTable();
+  static void ClearTable(Table* table);
+  static void MergeTable(Table* table);
+
+  static std::atomic<const DexFile*> dex_files_[kMaxDexFiles];
+  // All thread tables (never freed: they are recycled)
+  static Table* tables_;
+  static std::atomic<uint64_t> dropped_samples_;
+  static thread_local TableHolder thread_table_;
+
+  DISALLOW_IMPLICIT_CONSTRUCTORS(InvokeProfile);
+};
+
+}  // namespace mcr
+}  // namespace art
+
+#endif  // ART_RUNTIME_MCR_INVOKE_PROFILE_H_
@@ -0,0 +1,204 @@
+/**
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "mcr_rt/llvm_fault_handler.h"
+
+#include <dlfcn.h>
+#include <link.h>
+#include <string.h>
+#include <sys/ucontext.h>
+#include <algorithm>
+#include <fstream>
+
+#include "arch/instruction_set.h"
+#include "base/os.h"
+#include "mcr_rt/mcr_rt.h"
+
+extern "C" void art_quick_throw_stack_overflow();
+
+namespace art {
+namespace mcr {
+
+std::mutex LlvmFaultHandler::lock_;
+std::unique_ptr<LlvmFaultHandler::Table> LlvmFaultHandler::owner_;
+std::atomic<const LlvmFaultHandler::Table*> LlvmFaultHandler::table_(nullptr);
+
+template <typename T>
+static bool Read(const uint8_t* data, size_t size, size_t* pos, T* value) {
+  if (*pos + sizeof(T) > size) return false;
+  memcpy(value, data + *pos, sizeof(T));
+  *pos += sizeof(T);
+  return true;
+}
+
+LlvmFaultHandler::LlvmFaultHandler(FaultManager* manager)
+    : FaultHandler(manager) {
+  manager_->AddHandler(this, false);
+}
+
+bool LlvmFaultHandler::Table::InCode(uintptr_t pc) const {
+  for (const auto& range : code) {
+    if (pc >= range.first && pc < range.second) return true;
+  }
+  return false;
+}
+
+uintptr_t LlvmFaultHandler::Table::FindHandler(uintptr_t pc) const {
+  auto it = std::lower_bound(loads.begin(), loads.end(), pc,
+      [](const FaultingLoad& load, uintptr_t v) { return load.faulting_pc < v; });
+  if (it == loads.end() || it->faulting_pc != pc) return 0;
+  return it->handler_pc;
+}
+
+static bool GetPcAndSp(void* context, uintptr_t* pc, uintptr_t* sp) {
+  ucontext_t* uc = reinterpret_cast<ucontext_t*>(context);
+#if defined(__aarch64__)
+  *pc = static_cast<uintptr_t>(uc->uc_mcontext.pc);
+  *sp = static_cast<uintptr_t>(uc->uc_mcontext.sp);
+  return true;
+#elif defined(__x86_64__)
+  *pc = static_cast<uintptr_t>(uc->uc_mcontext.gregs[REG_RIP]);
+  *sp = static_cast<uintptr_t>(uc->uc_mcontext.gregs[REG_RSP]);
+  return true;
+#else
+  UNUSED(uc, pc, sp);
+  return false;
+#endif
+}
+
+static void SetPc(void* context, uintptr_t pc) {
+  ucontext_t* uc = reinterpret_cast<ucontext_t*>(context);
+#if defined(__aarch64__)
+  uc->uc_mcontext.pc = pc;
+#elif defined(__x86_64__)
+  uc->uc_mcontext.gregs[REG_RIP] = pc;
+#else
+  UNUSED(uc, pc);
+#endif
+}
+
+/**
+ * @brief Runs in the signal handler: no locks and no allocations.
+ */
+bool LlvmFaultHandler::Action(int sig ATTRIBUTE_UNUSED, siginfo_t* info,
+                              void* context) {
+  const Table* table = table_.load(std::memory_order_acquire);
+  uintptr_t pc, sp;
+  if (table == nullptr || !GetPcAndSp(context, &pc, &sp) ||
+      !table->InCode(pc)) {
+    return false;
+  }
+
+  const uintptr_t fault_addr = reinterpret_cast<uintptr_t>(info->si_addr);
+  if (fault_addr == sp - GetStackOverflowReservedBytes(kRuntimeISA)) {
+    // LR (arm64) still has the return address of the LLVM method, as the
+    // probe is at its entry. The LLVM frames are hidden by the entrypoint,
+    // so the error skips their catch blocks (see llvm_fault_handler.h).
+    SetPc(context, reinterpret_cast<uintptr_t>(art_quick_throw_stack_overflow));
+    return true;
+  }
+
+  if (!NullPointerHandler::IsValidImplicitCheck(info)) return false;
+  const uintptr_t handler_pc = table->FindHandler(pc);
+  if (handler_pc == 0) return false;
+  SetPc(context, handler_pc);
+  return true;
+}
+
+struct CodeRanges {
+  uintptr_t base;
+  std::vector<std::pair<uintptr_t, uintptr_t>>* code;
+};
+
+static int AddCodeRanges(struct dl_phdr_info* info, size_t, void* data) {
+  CodeRanges* ranges = reinterpret_cast<CodeRanges*>(data);
+  if (info->dlpi_addr != ranges->base) return 0;
+  for (size_t i = 0; i < info->dlpi_phnum; i++) {
+    const ElfW(Phdr)& phdr = info->dlpi_phdr[i];
+    if (phdr.p_type == PT_LOAD && (phdr.p_flags & PF_X) != 0) {
+      const uintptr_t begin = info->dlpi_addr + phdr.p_vaddr;
+      ranges->code->emplace_back(begin, begin + phdr.p_memsz);
+    }
+  }
+  return 1;
+}
+
+void LlvmFaultHandler::Load(const std::string& file_so, void* code) {
+  std::string file =
+    file_so.substr(0, file_so.find_last_of('/') + 1) + HFfaults;
+  if (!OS::FileExists(file.c_str())) return;
+
+  Dl_info info;
+  if (code == nullptr || dladdr(code, &info) == 0) {
+    DLOG(ERROR) << __func__ << ": no base address: " << file_so;
+    return;
+  }
+  const uintptr_t base = reinterpret_cast<uintptr_t>(info.dli_fbase);
+
+  std::ifstream in(file, std::ios::binary | std::ios::ate);
+  const size_t size = static_cast<size_t>(in.tellg());
+  std::unique_ptr<uint8_t[]> data(new uint8_t[size]);
+  in.seekg(0);
+  if (!in.read(reinterpret_cast<char*>(data.get()), size)) {
+    DLOG(ERROR) << __func__ << ": failed to read: " << file;
+    return;
+  }
+
+  size_t pos = 0;
+  uint32_t magic, num_loads;
+  if (!Read(data.get(), size, &pos, &magic) || magic != kMagic ||
+      !Read(data.get(), size, &pos, &num_loads)) {
+    DLOG(ERROR) << __func__ << ": not a faults file: " << file;
+    return;
+  }
+
+  std::unique_ptr<Table> table(new Table());
+  for (uint32_t i = 0; i < num_loads; i++) {
+    uint64_t faulting_pc, handler_pc;
+    if (!Read(data.get(), size, &pos, &faulting_pc) ||
+        !Read(data.get(), size, &pos, &handler_pc)) {
+      DLOG(ERROR) << __func__ << ": truncated: " << file;
+      return;
+    }
+    table->loads.push_back({ base + faulting_pc, base + handler_pc });
+  }
+  std::sort(table->loads.begin(), table->loads.end(),
+      [](const FaultingLoad& a, const FaultingLoad& b) {
+        return a.faulting_pc < b.faulting_pc; });
+
+  // the probes fault in any code of file_so
+  CodeRanges ranges { base, &table->code };
+  dl_iterate_phdr(AddCodeRanges, &ranges);
+  if (table->code.empty()) {
+    DLOG(ERROR) << __func__ << ": no code ranges: " << file_so;
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(lock_);
+  // a single hf.so is loaded at a time
+  table_.store(table.get(), std::memory_order_release);
+  owner_ = std::move(table);
+  D2LOG(INFO) << __func__ << ": " << num_loads << " faulting loads: " << file;
+}
+
+void LlvmFaultHandler::Unload() {
+  std::lock_guard<std::mutex> lock(lock_);
+  table_.store(nullptr, std::memory_order_release);
+  owner_.reset();
+}
+
+}  // namespace mcr
+}  // namespace art
@@ -0,0 +1,94 @@
+/**
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef ART_RUNTIME_MCR_RT_LLVM_FAULT_HANDLER_H_
+#define ART_RUNTIME_MCR_RT_LLVM_FAULT_HANDLER_H_
+
+#include <signal.h>
+#include <stdint.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "fault_handler.h"
+
+// Faulting loads of an hf.so, next to it. Written by the compiler
+// (LLVM::FaultMaps), with opt.implicit_checks
+#define HFfaults "hf.faults"
+
+namespace art {
+namespace mcr {
+
+/**
+ * @brief Implicit checks of LLVM code (opt.implicit_checks).
+ *
+ * hf.faults has the loads that LLVM made the null checks of:
+ *   u32 kMagic, u32 number of loads, and for each load (sorted):
+ *   u64 faulting pc (in hf.so), u64 handler pc (in hf.so).
+ *
+ * A SIGSEGV in the code of hf.so is either:
+ * - a stack overflow probe (fault address at sp - reserved bytes, like
+ *   quick code): it continues at art_quick_throw_stack_overflow. It does not
+ *   go through the catch dispatch of LLVM code (GenerateCatchDispatch), so
+ *   the StackOverflowError skips the catch blocks of the LLVM frames, and is
+ *   only caught by quick or interpreted code.
+ * - a faulting load of hf.faults: it continues at its handler, which is
+ *   the null branch of the check (it throws the NullPointerException).
+ *
+ * The fault manager only gives quick code to its generated code handlers,
+ * so this one is one of the other handlers, and it checks the pc itself.
+ * Action runs in the signal handler: the table is published with an
+ * atomic, and it is only freed by Unload (no LLVM code runs then).
+ */
+class LlvmFaultHandler final : public FaultHandler {
+ public:
+  static constexpr uint32_t kMagic = 0x31464c4c;  // LLF1
+
+  explicit LlvmFaultHandler(FaultManager* manager);
+
+  bool Action(int sig, siginfo_t* siginfo, void* context) override;
+
+  // code: any symbol of the (already loaded) file_so
+  static void Load(const std::string& file_so, void* code);
+  static void Unload();
+
+ private:
+  struct FaultingLoad {
+    uintptr_t faulting_pc;
+    uintptr_t handler_pc;
+  };
+
+  struct Table {
+    std::vector<std::pair<uintptr_t, uintptr_t>> code;  // [begin, end)
+    std::vector<FaultingLoad> loads;  // sorted by faulting_pc
+
+    bool InCode(uintptr_t pc) const;
+    uintptr_t FindHandler(uintptr_t pc) const;
+  };
+
+  static std::mutex lock_;
+  static std::unique_ptr<Table> owner_;
+  static std::atomic<const Table*> table_;
+
+  DISALLOW_COPY_AND_ASSIGN(LlvmFaultHandler);
+};
+
+}  // namespace mcr
+}  // namespace art
+
+#endif  // ART_RUNTIME_MCR_RT_LLVM_FAULT_HANDLER_H_
@@ -0,0 +1,110 @@
+/**
+ * Inline caches of the interface call sites of LLVM code.
+ * The runtime fills them in, and keeps their classes up to date with the GC.
+ *
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "mcr_rt/llvm_inline_cache.h"
+
+#include <mutex>
+#include <set>
+
+#include "base/casts.h"
+#include "mirror/class.h"
+#include "object_callbacks.h"
+
+namespace art {
+namespace mcr {
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "layout");
+static_assert(sizeof(std::atomic<ArtMethod*>) == sizeof(ArtMethod*), "layout");
+
+// Caches that have at least one entry. Guards the writes to them.
+static std::mutex caches_lock_;
+static std::set<LlvmInlineCache*> caches_;
+// Speculated classes that were set
+static std::set<std::atomic<uint32_t>*> spec_classes_;
+
+// Updates a compressed class reference that moved, or clears it
+static void SweepClass(IsMarkedVisitor* visitor, std::atomic<uint32_t>* slot) {
+  uint32_t ref = slot->load(std::memory_order_relaxed);
+  if (ref == 0u) return;
+  mirror::Object* klass = reinterpret_cast32<mirror::Object*>(ref);
+  mirror::Object* new_klass = visitor->IsMarked(klass);
+  if (new_klass == nullptr) {
+    slot->store(0u, std::memory_order_release);
+  } else if (new_klass != klass) {
+    slot->store(reinterpret_cast32<uint32_t>(new_klass),
+                std::memory_order_release);
+  }
+}
+
+void LlvmInlineCache::Update(LlvmInlineCache* cache, mirror::Class* klass,
+                             ArtMethod* method) {
+  static_assert(offsetof(LlvmInlineCache, methods_) == MethodsOffset(),
+                "LLVM code uses MethodsOffset");
+  uint32_t ref = reinterpret_cast32<uint32_t>(klass);
+  std::lock_guard<std::mutex> lock(caches_lock_);
+  for (size_t i = 0; i < kSize; i++) {
+    if (cache->classes_[i].load(std::memory_order_relaxed) == ref) return;
+  }
+  for (size_t i = 0; i < kSize; i++) {
+    if (cache->classes_[i].load(std::memory_order_relaxed) == 0u) {
+      // the method first: LLVM code reads the class (acquire) and then it
+      cache->methods_[i].store(method, std::memory_order_relaxed);
+      cache->classes_[i].store(ref, std::memory_order_release);
+      caches_.insert(cache);
+      return;
+    }
+  }
+  // megamorphic
+}
+
+void LlvmInlineCache::Sweep(IsMarkedVisitor* visitor) {
+  for (size_t i = 0; i < kSize; i++) {
+    // unloaded: no receiver can have it, so the slot can be refilled
+    SweepClass(visitor, &classes_[i]);
+  }
+}
+
+void LlvmInlineCache::SweepAll(IsMarkedVisitor* visitor) {
+  std::lock_guard<std::mutex> lock(caches_lock_);
+  for (LlvmInlineCache* cache : caches_) {
+    cache->Sweep(visitor);
+  }
+}
+
+void LlvmInlineCache::UnloadAll() {
+  std::lock_guard<std::mutex> lock(caches_lock_);
+  caches_.clear();
+  spec_classes_.clear();
+}
+
+void LlvmSpecClass::Set(std::atomic<uint32_t>* slot, mirror::Class* klass) {
+  std::lock_guard<std::mutex> lock(caches_lock_);
+  slot->store(reinterpret_cast32<uint32_t>(klass), std::memory_order_release);
+  spec_classes_.insert(slot);
+}
+
+void LlvmSpecClass::SweepAll(IsMarkedVisitor* visitor) {
+  std::lock_guard<std::mutex> lock(caches_lock_);
+  for (std::atomic<uint32_t>* slot : spec_classes_) {
+    SweepClass(visitor, slot);
+  }
+}
+
+}  // namespace mcr
+}  // namespace art
@@ -0,0 +1,95 @@
+/**
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef ART_RUNTIME_MCR_RT_LLVM_INLINE_CACHE_H_
+#define ART_RUNTIME_MCR_RT_LLVM_INLINE_CACHE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+namespace art {
+
+class ArtMethod;
+class IsMarkedVisitor;
+
+namespace mirror {
+class Class;
+}  // namespace mirror
+
+namespace mcr {
+
+/**
+ * @brief Inline cache of an interface call site of LLVM code: the targets
+ *        of receiver classes whose IMT slot is a conflict.
+ *
+ * It is a zero-initialized global of the region code (hf.so), with this
+ * layout (see FunctionHelper::InvokeWrapper). LLVM code only reads it, and
+ * the runtime fills it in on a miss (art_llvm_inline_cache_miss).
+ *
+ * Entries are never replaced, so a reader that matched a class also reads
+ * its method. Once full, the call site is megamorphic and the rest of the
+ * classes go through the conflict table (inline) or the runtime.
+ *
+ * Classes are weak, like the roots of JIT code: they are updated when
+ * they move, and cleared when they are unloaded (SweepAll).
+ */
+class LlvmInlineCache {
+ public:
+  static constexpr size_t kSize = 4;
+
+  // Offsets used by LLVM code
+  static constexpr size_t ClassesOffset() { return 0; }
+  static constexpr size_t MethodsOffset() { return kSize * sizeof(uint32_t); }
+  static constexpr size_t SizeOf(size_t pointer_size) {
+    return MethodsOffset() + kSize * pointer_size;
+  }
+
+  static void Update(LlvmInlineCache* cache, mirror::Class* klass,
+                     ArtMethod* method);
+  // Called by Runtime::SweepSystemWeaks
+  static void SweepAll(IsMarkedVisitor* visitor);
+  // The code was unloaded: its caches and speculated classes are gone
+  static void UnloadAll();
+
+ private:
+  void Sweep(IsMarkedVisitor* visitor);
+
+  // compressed references
+  std::atomic<uint32_t> classes_[kSize];
+  std::atomic<ArtMethod*> methods_[kSize];
+};
+
+/**
+ * @brief Class of a speculation of LLVM code (a devirtualization guard).
+ *
+ * It is a zero-initialized global of the region code too, that the
+ * InitInner methods fill in (art_llvm_resolve_spec_class). Until then, or
+ * when the class does not resolve, the guard never matches.
+ * It is weak like the inline caches: updated when the class moves, and
+ * cleared when it is unloaded.
+ */
+class LlvmSpecClass {
+ public:
+  static void Set(std::atomic<uint32_t>* slot, mirror::Class* klass);
+  // Called by Runtime::SweepSystemWeaks
+  static void SweepAll(IsMarkedVisitor* visitor);
+};
+
+}  // namespace mcr
+}  // namespace art
+
+#endif  // ART_RUNTIME_MCR_RT_LLVM_INLINE_CACHE_H_
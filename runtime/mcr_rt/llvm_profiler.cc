@@ -0,0 +1,249 @@
+/**
+ * Native-code sampling of the LLVM code, attributed to its dex methods
+ * and dex pcs with the line tables of hf.so (see llvm_profiler.h).
+ *
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "mcr_rt/llvm_profiler.h"
+
+#include <dlfcn.h>
+#include <errno.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include "base/macros.h"
+#include "base/os.h"
+#include "dex/dex_file_types.h"
+#include "mcr_rt/flush_task.h"
+#include "mcr_rt/mcr_rt.h"
+#include "sigchain.h"
+
+namespace art {
+namespace mcr {
+
+std::mutex LlvmProfiler::lock_;
+std::vector<LlvmProfiler::Table> LlvmProfiler::tables_;
+std::map<std::string, uint64_t> LlvmProfiler::counts_;
+uint64_t LlvmProfiler::num_samples_ = 0;
+uint64_t LlvmProfiler::num_other_samples_ = 0;
+std::atomic<uintptr_t> LlvmProfiler::samples_[kMaxSamples];
+std::atomic<size_t> LlvmProfiler::next_sample_(0);
+std::atomic<size_t> LlvmProfiler::dropped_samples_(0);
+
+template <typename T>
+static bool Read(const std::vector<char>& data, size_t* pos, T* value) {
+  if (*pos + sizeof(T) > data.size()) return false;
+  memcpy(value, data.data() + *pos, sizeof(T));
+  *pos += sizeof(T);
+  return true;
+}
+
+void LlvmProfiler::Load(const std::string& file_so, void* code) {
+  if (!McrRT::IsProfileNative()) return;
+  std::string file = file_so.substr(0, file_so.find_last_of('/') + 1) + HFlines;
+  if (!OS::FileExists(file.c_str())) {
+    DLOG(WARNING) << __func__ << ": no line table: " << file;
+    return;
+  }
+
+  Dl_info info;
+  if (code == nullptr || dladdr(code, &info) == 0) {
+    DLOG(ERROR) << __func__ << ": no base address: " << file_so;
+    return;
+  }
+
+  std::ifstream in(file, std::ios::binary);
+  std::vector<char> data((std::istreambuf_iterator<char>(in)),
+                         std::istreambuf_iterator<char>());
+  Table table;
+  table.base = reinterpret_cast<uintptr_t>(info.dli_fbase);
+  size_t pos = 0;
+  uint32_t magic, num_strings, num_rows;
+  if (!Read(data, &pos, &magic) || magic != kMagic ||
+      !Read(data, &pos, &num_strings)) {
+    DLOG(ERROR) << __func__ << ": not a line table: " << file;
+    return;
+  }
+  for (uint32_t i = 0; i < num_strings && pos < data.size(); i++) {
+    table.strings.push_back(data.data() + pos);
+    pos += table.strings.back().size() + 1;
+  }
+  pos = (pos + sizeof(uint32_t) - 1) & ~(sizeof(uint32_t) - 1);
+  if (table.strings.size() != num_strings || !Read(data, &pos, &num_rows)) {
+    DLOG(ERROR) << __func__ << ": truncated: " << file;
+    return;
+  }
+  table.rows.resize(num_rows);
+  for (uint32_t i = 0; i < num_rows; i++) {
+    if (!Read(data, &pos, &table.rows[i])) {
+      DLOG(ERROR) << __func__ << ": truncated: " << file;
+      return;
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(lock_);
+    tables_.push_back(std::move(table));
+  }
+  D2LOG(INFO) << __func__ << ": " << num_rows << " rows: " << file;
+
+  static std::once_flag start;
+  std::call_once(start, Start);
+}
+
+/**
+ * @brief The report is cumulative: it keeps the samples of unloaded code.
+ */
+void LlvmProfiler::Unload() {
+  Flush();
+  std::lock_guard<std::mutex> lock(lock_);
+  tables_.clear();
+}
+
+/**
+ * @brief Through the signal chain, like the fault handler: a sigaction
+ *        would replace the handlers of the chain (and of the app).
+ */
+void LlvmProfiler::Start() {
+  SigchainAction action;
+  action.sc_sigaction = HandleSignal;
+  sigemptyset(&action.sc_mask);
+  action.sc_flags = 0UL;
+  AddSpecialSignalHandlerFn(SIGPROF, &action);
+
+  struct itimerval timer;
+  timer.it_interval.tv_sec = 0;
+  timer.it_interval.tv_usec = kSamplingIntervalUs;
+  timer.it_value = timer.it_interval;
+  if (setitimer(ITIMER_PROF, &timer, nullptr) != 0) {
+    DLOG(ERROR) << "LlvmProfiler: setitimer: " << strerror(errno);
+    return;
+  }
+
+  FlushTask::Add(Flush);
+  DLOG(INFO) << "LlvmProfiler: sampling every " << kSamplingIntervalUs << "us";
+}
+
+/**
+ * @brief Async-signal-safe: stores the pc in the next free slot.
+ *        Samples are dropped while the buffer is full.
+ *        Always handled: SIGPROF would otherwise terminate the process.
+ */
+bool LlvmProfiler::HandleSignal(int signal ATTRIBUTE_UNUSED,
+                                siginfo_t* info ATTRIBUTE_UNUSED,
+                                void* context) {
+  const ucontext_t* uc = reinterpret_cast<const ucontext_t*>(context);
+#if defined(__aarch64__)
+  const uintptr_t pc = uc->uc_mcontext.pc;
+#elif defined(__arm__)
+  const uintptr_t pc = uc->uc_mcontext.arm_pc;
+#elif defined(__x86_64__)
+  const uintptr_t pc = uc->uc_mcontext.gregs[REG_RIP];
+#elif defined(__i386__)
+  const uintptr_t pc = uc->uc_mcontext.gregs[REG_EIP];
+#else
+  const uintptr_t pc = 0;
+  UNUSED(uc);
+#endif
+  const size_t idx = next_sample_.fetch_add(1, std::memory_order_relaxed);
+  if (idx < kMaxSamples) {
+    samples_[idx].store(pc, std::memory_order_relaxed);
+  } else {
+    dropped_samples_.fetch_add(1, std::memory_order_relaxed);
+  }
+  return true;
+}
+
+/**
+ * @brief Samples outside the line tables (the runtime, quick code, or
+ *        LLVM code without a location) are only counted.
+ */
+void LlvmProfiler::Attribute(uintptr_t pc) {
+  num_samples_++;
+  for (const Table& table : tables_) {
+    if (pc < table.base || table.rows.empty()) continue;
+    const uint64_t address = pc - table.base;
+    auto it = std::upper_bound(table.rows.begin(), table.rows.end(), address,
+        [](uint64_t a, const Row& row) { return a < row.address_; });
+    if (it == table.rows.begin()) continue;
+    const Row& row = *(--it);
+    if (row.method_ >= table.strings.size() ||
+        row.function_ >= table.strings.size()) {
+      continue;
+    }
+    std::stringstream key;
+    key << table.strings[row.function_] << "\t" << table.strings[row.method_]
+        << "\t";
+    if (row.dex_pc_ == dex::kDexNoIndex) {
+      key << "-";
+    } else {
+      key << row.dex_pc_;
+    }
+    counts_[key.str()]++;
+    return;
+  }
+  num_other_samples_++;
+}
+
+bool LlvmProfiler::Flush() {
+  std::lock_guard<std::mutex> lock(lock_);
+  const size_t num = std::min(next_sample_.load(std::memory_order_relaxed),
+                              kMaxSamples);
+  for (size_t i = 0; i < num; i++) {
+    const uintptr_t pc = samples_[i].exchange(0, std::memory_order_relaxed);
+    if (pc != 0) Attribute(pc);
+  }
+  // samples that arrive meanwhile may be overwritten (approximate)
+  next_sample_.store(0, std::memory_order_relaxed);
+  if (num_samples_ == 0) return true;
+
+  std::vector<std::pair<std::string, uint64_t>> sorted(counts_.begin(),
+                                                       counts_.end());
+  std::sort(sorted.begin(), sorted.end(),
+      [](const std::pair<std::string, uint64_t>& a,
+         const std::pair<std::string, uint64_t>& b) {
+        return a.second > b.second;
+      });
+
+  std::string filename = GetFileApp(FILE_NATIVE_PROFILE);
+  std::ofstream out(filename, std::ios::trunc);
+  if (!out) {
+    DLOG(ERROR) << "LlvmProfiler: can't open: " << filename;
+    return false;
+  }
+  out << "# samples: " << num_samples_
+      << " llvm: " << (num_samples_ - num_other_samples_)
+      << " other: " << num_other_samples_
+      << " dropped: " << dropped_samples_.load(std::memory_order_relaxed)
+      << "\n# samples\tpercent\tllvm function\tdex method\tdex_pc\n";
+  for (const auto& it : sorted) {
+    out << it.second << "\t"
+        << (100.0 * it.second / num_samples_) << "%\t" << it.first << "\n";
+  }
+  out.close();
+  chmod(filename.c_str(), 0666);
+  D2LOG(INFO) << "LlvmProfiler: " << num_samples_ << " samples: " << filename;
+  return true;
+}
+
+}  // namespace mcr
+}  // namespace art
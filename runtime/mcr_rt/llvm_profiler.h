@@ -0,0 +1,100 @@
+/**
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef ART_RUNTIME_MCR_RT_LLVM_PROFILER_H_
+#define ART_RUNTIME_MCR_RT_LLVM_PROFILER_H_
+
+#include <signal.h>
+#include <stdint.h>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Line table of an hf.so, next to it. Written by the compiler (LLVM::LineTable)
+#define HFlines "hf.lines"
+// Sampling report, next to the invoke histogram
+#define FILE_NATIVE_PROFILE "native.prof"
+
+namespace art {
+namespace mcr {
+
+/**
+ * @brief SIGPROF sampling of the LLVM code (mcr::McrRT::IsProfileNative).
+ *
+ * A process-wide ITIMER_PROF timer delivers SIGPROF to the running threads.
+ * The handler (a special handler of the signal chain) only records the
+ * interrupted pc. The FlushTask periodically attributes the samples with the line tables of the loaded
+ * hf.so files, and rewrites the report (native.prof) with the samples of
+ * each (LLVM function, dex method, dex_pc), the hottest first.
+ *
+ * hf.lines:
+ *   u32 kMagic, u32 number of strings, strings (NUL terminated,
+ *   padded to 4 bytes), u32 number of rows, Row rows[] (by address).
+ *
+ * A row covers the code from its address to the next one. The method and
+ * the function are string ids, and kNoString ends a sequence.
+ */
+class LlvmProfiler {
+ public:
+  static constexpr uint32_t kMagic = 0x314e4c4c;  // LLN1
+  static constexpr uint32_t kNoString = 0xFFFFFFFF;
+
+  struct Row {
+    uint64_t address_;   // in hf.so
+    uint32_t dex_pc_;
+    uint32_t method_;    // innermost (inlined) dex method
+    uint32_t function_;  // LLVM function that has the code
+    uint32_t padding_;
+  };
+
+  // code: any symbol of the (already loaded) file_so
+  static void Load(const std::string& file_so, void* code);
+  static void Unload();
+  // Attributes the pending samples, and rewrites the report
+  static bool Flush();
+
+ private:
+  static constexpr uint32_t kSamplingIntervalUs = 1000;
+  static constexpr size_t kMaxSamples = 1 << 16;
+
+  struct Table {
+    uintptr_t base;
+    std::vector<std::string> strings;
+    std::vector<Row> rows;
+  };
+
+  static void Start();
+  static bool HandleSignal(int signal, siginfo_t* info, void* context);
+  static void Attribute(uintptr_t pc);
+
+  static std::mutex lock_;
+  static std::vector<Table> tables_;
+  // samples by (LLVM function, dex method, dex_pc)
+  static std::map<std::string, uint64_t> counts_;
+  static uint64_t num_samples_;
+  static uint64_t num_other_samples_;
+
+  static std::atomic<uintptr_t> samples_[kMaxSamples];
+  static std::atomic<size_t> next_sample_;
+  static std::atomic<size_t> dropped_samples_;
+};
+
+}  // namespace mcr
+}  // namespace art
+
+#endif  // ART_RUNTIME_MCR_RT_LLVM_PROFILER_H_
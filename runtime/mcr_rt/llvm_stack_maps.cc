@@ -0,0 +1,282 @@
+/**
+ * GC roots of the LLVM frames of a thread, with the stack maps that the
+ * compiler translated from the statepoints of hf.so (see llvm_stack_maps.h).
+ *
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "mcr_rt/llvm_stack_maps.h"
+
+#include <dlfcn.h>
+#include <string.h>
+#include <fstream>
+
+#include "art_method-inl.h"
+#include "base/callee_save_type.h"
+#include "base/os.h"
+#include "gc/heap.h"
+#include "gc_root.h"
+#include "managed_stack.h"
+#include "mcr_rt/llvm_transitions.h"
+#include "mcr_rt/mcr_rt.h"
+#include "read_barrier_config.h"
+#include "runtime-inl.h"
+#include "stack_map.h"
+#include "thread.h"
+
+namespace art {
+namespace mcr {
+
+std::mutex LlvmStackMaps::lock_;
+std::vector<std::unique_ptr<uint8_t[]>> LlvmStackMaps::data_;
+std::vector<std::unique_ptr<LlvmStackMaps::Function>> LlvmStackMaps::functions_;
+std::map<uintptr_t, const LlvmStackMaps::Function*> LlvmStackMaps::return_pcs_;
+std::atomic<bool> LlvmStackMaps::moving_gc_disabled_(false);
+
+template <typename T>
+static bool Read(const uint8_t* data, size_t size, size_t* pos, T* value) {
+  if (*pos + sizeof(T) > size) return false;
+  memcpy(value, data + *pos, sizeof(T));
+  *pos += sizeof(T);
+  return true;
+}
+
+void LlvmStackMaps::Load(const std::string& file_so, void* code) {
+  std::string file =
+    file_so.substr(0, file_so.find_last_of('/') + 1) + HFstackmaps;
+  if (!OS::FileExists(file.c_str())) return;
+
+  Dl_info info;
+  if (code == nullptr || dladdr(code, &info) == 0) {
+    DLOG(ERROR) << __func__ << ": no base address: " << file_so;
+    return;
+  }
+  const uintptr_t base = reinterpret_cast<uintptr_t>(info.dli_fbase);
+  if (!DisableMovingGc(file)) return;
+
+  std::ifstream in(file, std::ios::binary | std::ios::ate);
+  const size_t size = static_cast<size_t>(in.tellg());
+  std::unique_ptr<uint8_t[]> data(new uint8_t[size]);
+  in.seekg(0);
+  if (!in.read(reinterpret_cast<char*>(data.get()), size)) {
+    DLOG(ERROR) << __func__ << ": failed to read: " << file;
+    return;
+  }
+
+  size_t pos = 0;
+  uint32_t magic, num_functions;
+  if (!Read(data.get(), size, &pos, &magic) || magic != kMagic ||
+      !Read(data.get(), size, &pos, &num_functions)) {
+    DLOG(ERROR) << __func__ << ": not a stack maps file: " << file;
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(lock_);
+  size_t num_stack_maps = 0;
+  for (uint32_t f = 0; f < num_functions; f++) {
+    uint64_t address;
+    uint32_t code_info_size;
+    if (!Read(data.get(), size, &pos, &address) ||
+        !Read(data.get(), size, &pos, &code_info_size) ||
+        pos + code_info_size > size) {
+      DLOG(ERROR) << __func__ << ": truncated: " << file;
+      break;
+    }
+    functions_.emplace_back(new Function { data.get() + pos, base + address });
+    const Function* fn = functions_.back().get();
+    pos += code_info_size;
+
+    CodeInfo code_info(fn->code_info, CodeInfo::DecodeFlags::GcMasksOnly);
+    for (size_t i = 0; i < code_info.GetNumberOfStackMaps(); i++) {
+      StackMap stack_map = code_info.GetStackMapAt(i);
+      return_pcs_[fn->begin + stack_map.GetNativePcOffset(kRuntimeISA)] = fn;
+      num_stack_maps++;
+    }
+  }
+  data_.push_back(std::move(data));
+  D2LOG(INFO) << __func__ << ": " << num_stack_maps << " stack maps: " << file;
+}
+
+void LlvmStackMaps::Unload() {
+  {
+    std::lock_guard<std::mutex> lock(lock_);
+    return_pcs_.clear();
+    functions_.clear();
+    data_.clear();
+  }
+  EnableMovingGc();
+}
+
+/**
+ * @brief The references that VisitRoots reports must not move: LLVM code
+ *        keeps its own copies of them. There are no stack maps with a moving
+ *        collector, and no moving GCs (e.g. a transition to a compacting
+ *        collector) once there are.
+ */
+bool LlvmStackMaps::DisableMovingGc(const std::string& file) {
+  gc::Heap* heap = Runtime::Current()->GetHeap();
+  if (kUseReadBarrier || gc::Heap::IsMovingGc(heap->CurrentCollectorType())) {
+    DLOG(ERROR) << "LlvmStackMaps: not used with a moving collector ("
+      << heap->CurrentCollectorType() << "): " << file;
+    return false;
+  }
+  if (!moving_gc_disabled_.exchange(true)) {
+    heap->IncrementDisableMovingGC(Thread::Current());
+  }
+  return true;
+}
+
+void LlvmStackMaps::EnableMovingGc() {
+  if (moving_gc_disabled_.exchange(false)) {
+    Runtime::Current()->GetHeap()->DecrementDisableMovingGC(Thread::Current());
+  }
+}
+
+const LlvmStackMaps::Function* LlvmStackMaps::Find(uintptr_t pc) {
+  auto it = return_pcs_.find(pc);
+  return it == return_pcs_.end() ? nullptr : it->second;
+}
+
+static bool IsCalleeSaveMethod(Runtime* runtime, ArtMethod* method) {
+  for (uint32_t i = 0;
+       i < static_cast<uint32_t>(CalleeSaveType::kLastCalleeSaveType); i++) {
+    if (method == runtime->GetCalleeSaveMethodUnchecked(
+          static_cast<CalleeSaveType>(i))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Visits the references of the LLVM frames from sp, until a return
+ *        address without a stack map (e.g. OptimizingInterface::ExecuteLLVM,
+ *        or quick code).
+ *
+ * pc is the return address into the first LLVM frame, and sp its bottom.
+ * On x86_64 the return address of each frame is at its top.
+ * On arm64 LLVM frames keep a frame pointer (frame-pointer=all), and the
+ * return addresses are found through the frame records (fp, lr).
+ */
+size_t LlvmStackMaps::VisitFrames(uintptr_t sp, uintptr_t pc, uintptr_t fp,
+                                  RootVisitor* visitor,
+                                  const RootInfo& root_info) {
+  size_t frames = 0;
+  for (const Function* fn = Find(pc); fn != nullptr; fn = Find(pc)) {
+    CodeInfo code_info(fn->code_info, CodeInfo::DecodeFlags::GcMasksOnly);
+    StackMap stack_map = code_info.GetStackMapForNativePcOffset(pc - fn->begin);
+    if (!stack_map.IsValid()) break;
+
+    BitMemoryRegion stack_mask = code_info.GetStackMaskOf(stack_map);
+    auto* slots = reinterpret_cast<StackReference<mirror::Object>*>(sp);
+    for (size_t i = 0; i < stack_mask.size_in_bits(); i++) {
+      if (!stack_mask.LoadBit(i)) continue;
+      mirror::Object* ref = slots[i].AsMirrorPtr();
+      if (ref == nullptr) continue;
+      mirror::Object* new_ref = ref;
+      visitor->VisitRoot(&new_ref, root_info);
+      // moving GCs are disabled (DisableMovingGc)
+      DCHECK_EQ(new_ref, ref) << "LlvmStackMaps: moved a reference of LLVM code";
+    }
+
+    const size_t frame_size =
+      CodeInfo::DecodeFrameInfo(fn->code_info).FrameSizeInBytes();
+    if (kRuntimeISA == InstructionSet::kArm64) {
+      pc = reinterpret_cast<uintptr_t*>(fp)[1];
+      fp = reinterpret_cast<uintptr_t*>(fp)[0];
+    } else {
+      pc = reinterpret_cast<uintptr_t*>(sp + frame_size)[-1];
+    }
+    sp += frame_size;
+    frames++;
+  }
+  return frames;
+}
+
+/**
+ * @brief The LLVM frame that called art_llvm_call_quick, from the
+ *        ManagedStack fragment that the stub keeps in its frame
+ *        (see the frame layout in quick_entrypoints_*.S).
+ *        Other fragments (e.g. of ArtMethod::Invoke) have no null
+ *        ArtMethod* below them, or no stack map at their return address.
+ */
+bool LlvmStackMaps::GetCallQuickCaller(const ManagedStack* fragment,
+                                       uintptr_t* sp, uintptr_t* pc,
+                                       uintptr_t* fp) {
+  const uintptr_t ms = reinterpret_cast<uintptr_t>(fragment);
+  uintptr_t base;
+  if (kRuntimeISA == InstructionSet::kArm64) {
+    base = ms - 16;
+    *fp = reinterpret_cast<uintptr_t*>(base)[6];
+    *pc = reinterpret_cast<uintptr_t*>(base)[7];
+    *sp = base + 64;
+  } else if (kRuntimeISA == InstructionSet::kX86_64) {
+    base = ms - 8;
+    *fp = 0;
+    *pc = reinterpret_cast<uintptr_t*>(base)[5];
+    *sp = base + 48;
+  } else {
+    return false;
+  }
+  return *reinterpret_cast<ArtMethod**>(base) == nullptr && Find(*pc) != nullptr;
+}
+
+/**
+ * @brief Visits the references of the LLVM frames of thread.
+ *
+ * LLVM code that calls the runtime directly: the first LLVM frame is right
+ * above the callee-save frame of the runtime method (which LLVM_FRAME_FIXUP
+ * hid). Callee-save frames keep x29 right below lr.
+ *
+ * LLVM code that called quick code (art_llvm_call_quick), which then called
+ * the runtime: the stack walker stops at the fragment that the stub pushed,
+ * and the LLVM frames are right above the frame of the stub. The fragments
+ * of the thread are walked for these, at any depth.
+ */
+void LlvmStackMaps::VisitRoots(Thread* thread, RootVisitor* visitor) {
+  LlvmThreadState* state = thread->GetLlvmState();
+  if (state->llvm_depth == 0) return;
+
+  std::lock_guard<std::mutex> lock(lock_);
+  if (return_pcs_.empty()) return;
+  Runtime* runtime = Runtime::Current();
+  const RootInfo root_info(kRootNativeStack, thread->GetThreadId());
+  size_t frames = 0;
+
+  ArtMethod** frame = state->top_quick_frame;
+  if (state->in_llvm && !thread->IsLlvmCalledQuick() && frame != nullptr &&
+      thread->GetManagedStack()->GetTopQuickFrame() == nullptr &&
+      IsCalleeSaveMethod(runtime, *frame)) {
+    const size_t runtime_frame_size =
+      runtime->GetRuntimeMethodFrameInfo(*frame).FrameSizeInBytes();
+    uintptr_t sp = reinterpret_cast<uintptr_t>(frame) + runtime_frame_size;
+    uintptr_t pc = reinterpret_cast<uintptr_t*>(sp)[-1];
+    uintptr_t fp = reinterpret_cast<uintptr_t*>(sp)[-2];
+    frames += VisitFrames(sp, pc, fp, visitor, root_info);
+  }
+
+  // The top fragment is in the Thread: the pushed ones are on its stack
+  for (const ManagedStack* fragment = thread->GetManagedStack()->GetLink();
+       fragment != nullptr; fragment = fragment->GetLink()) {
+    uintptr_t sp, pc, fp;
+    if (GetCallQuickCaller(fragment, &sp, &pc, &fp)) {
+      frames += VisitFrames(sp, pc, fp, visitor, root_info);
+    }
+  }
+  D5LOG(INFO) << __func__ << ": " << frames << " LLVM frames: " << *thread;
+}
+
+}  // namespace mcr
+}  // namespace art
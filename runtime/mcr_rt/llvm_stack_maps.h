@@ -0,0 +1,106 @@
+/**
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef ART_RUNTIME_MCR_RT_LLVM_STACK_MAPS_H_
+#define ART_RUNTIME_MCR_RT_LLVM_STACK_MAPS_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "base/locks.h"
+
+// Stack maps of an hf.so, next to it. Written by the compiler (LLVM::StackMaps)
+#define HFstackmaps "hf.stackmaps"
+
+namespace art {
+
+class ManagedStack;
+class RootInfo;
+class RootVisitor;
+class Thread;
+
+namespace mcr {
+
+/**
+ * @brief GC roots of LLVM frames, from the statepoints of hf.so.
+ *
+ * hf.stackmaps has a CodeInfo (ART's stack maps) for each function:
+ *   u32 kMagic, u32 number of functions, and for each function:
+ *   u64 address (in hf.so), u32 size of CodeInfo, CodeInfo.
+ *
+ * Each stack map is at the return address of a call (statepoint), and
+ * its stack mask has the stack slots (4 bytes each) of the references
+ * that live across the call. There are no register masks: LLVM spills
+ * them all.
+ *
+ * The stack walker does not see LLVM frames: LLVM_FRAME_FIXUP hides them,
+ * and keeps the top quick frame in LlvmThreadState::top_quick_frame.
+ * VisitRoots starts from there (the frame of the runtime method that LLVM
+ * called), and goes through the LLVM frames until a return address without
+ * a stack map (e.g. OptimizingInterface::ExecuteLLVM). It also starts from
+ * each ManagedStack fragment of art_llvm_call_quick, for the LLVM frames
+ * below quick code.
+ *
+ * INFO the references are only reported: LLVM code does not expect them
+ *      to move (they are not in a GC address space, and have no
+ *      gc.relocate). So the stack maps are not used with a moving collector
+ *      (e.g. CC, with read barriers), and while they are loaded moving GCs
+ *      are disabled (e.g. the compaction of CMS in the background).
+ */
+class LlvmStackMaps {
+ public:
+  static constexpr uint32_t kMagic = 0x314d534c;  // LSM1
+
+  // code: any symbol of the (already loaded) file_so
+  static void Load(const std::string& file_so, void* code);
+  static void Unload();
+
+  static void VisitRoots(Thread* thread, RootVisitor* visitor)
+    REQUIRES_SHARED(Locks::mutator_lock_);
+
+ private:
+  struct Function {
+    const uint8_t* code_info;
+    uintptr_t begin;
+  };
+
+  // Function with a stack map at the return address pc (or nullptr)
+  static const Function* Find(uintptr_t pc);
+  static size_t VisitFrames(uintptr_t sp, uintptr_t pc, uintptr_t fp,
+                            RootVisitor* visitor, const RootInfo& root_info)
+    REQUIRES_SHARED(Locks::mutator_lock_);
+  static bool GetCallQuickCaller(const ManagedStack* fragment,
+                                 uintptr_t* sp, uintptr_t* pc, uintptr_t* fp);
+  static bool DisableMovingGc(const std::string& file);
+  static void EnableMovingGc();
+
+  static std::mutex lock_;
+  static std::vector<std::unique_ptr<uint8_t[]>> data_;
+  static std::vector<std::unique_ptr<Function>> functions_;
+  static std::map<uintptr_t, const Function*> return_pcs_;
+  // not under lock_: the GC may wait for it (VisitRoots)
+  static std::atomic<bool> moving_gc_disabled_;
+};
+
+}  // namespace mcr
+}  // namespace art
+
+#endif  // ART_RUNTIME_MCR_RT_LLVM_STACK_MAPS_H_
@@ -0,0 +1,173 @@
+/**
+ * Per-thread counters of the transitions out of LLVM code (to quick code,
+ * to runtime entrypoints, and to JNI), attributed to the callee method.
+ * They are printed on SIGQUIT, and read by agents through the
+ * com.android.art.llvm.get_transitions JVMTI extension.
+ *
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "mcr_rt/llvm_transitions.h"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+
+#include "art_method-inl.h"
+#include "base/mutex.h"
+#include "mcr_rt/mcr_rt.h"
+#include "runtime.h"
+#include "scoped_thread_state_change-inl.h"
+#include "thread.h"
+#include "thread_list.h"
+
+namespace art {
+namespace mcr {
+
+// Dumped entries per kind (SIGQUIT)
+static constexpr size_t kDumpTopCallees = 20;
+
+// Threads that have not been attached (they never run LLVM code)
+static thread_local LlvmThreadState detached_state_;
+
+// Counters of the threads that have exited
+static std::mutex retired_lock_;
+static std::map<ArtMethod*, LlvmTransitions::Entry> retired_;
+static uint64_t retired_totals_[LlvmTransitions::kNumKinds] = {};
+
+LlvmThreadState* LlvmThreadState::Current() {
+  Thread* self = Thread::Current();
+  return self == nullptr ? &detached_state_ : self->GetLlvmState();
+}
+
+bool LlvmThreadState::CurrentCalledQuick() {
+  Thread* self = Thread::Current();
+  return self != nullptr && self->IsLlvmCalledQuick();
+}
+
+const char* LlvmTransitions::KindName(Kind kind) {
+  switch (kind) {
+    case kToQuick:
+      return "quick";
+    case kToEntrypoint:
+      return "entrypoint";
+    case kToJni:
+      return "jni";
+    default:
+      return "unknown";
+  }
+}
+
+static void Add(std::map<ArtMethod*, LlvmTransitions::Entry>* entries,
+                ArtMethod* method, size_t kind, uint64_t count) {
+  if (count == 0) return;
+  auto it = entries->find(method);
+  if (it == entries->end()) {
+    LlvmTransitions::Entry entry = {};
+    entry.method = method;
+    it = entries->insert(std::make_pair(method, entry)).first;
+  }
+  it->second.counts[kind] += count;
+}
+
+void LlvmTransitions::Collect(std::vector<Entry>* entries,
+                              uint64_t* totals) const {
+  std::map<ArtMethod*, Entry> merged;
+  for (const Entry& e : *entries) merged[e.method] = e;
+
+  for (size_t k = 0; k < kNumKinds; k++) {
+    totals[k] += totals_[k].load(std::memory_order_relaxed);
+  }
+  for (const Callee& c : callees_) {
+    ArtMethod* method = c.method.load(std::memory_order_acquire);
+    if (method == nullptr) continue;
+    for (size_t k = 0; k < kNumKinds; k++) {
+      Add(&merged, method, k, c.counts[k].load(std::memory_order_relaxed));
+    }
+  }
+
+  entries->clear();
+  for (auto& it : merged) entries->push_back(it.second);
+}
+
+void LlvmTransitions::Retire(const LlvmTransitions* transitions) {
+  std::vector<Entry> entries;
+  uint64_t totals[kNumKinds] = {};
+  transitions->Collect(&entries, totals);
+
+  std::lock_guard<std::mutex> lock(retired_lock_);
+  for (size_t k = 0; k < kNumKinds; k++) retired_totals_[k] += totals[k];
+  for (const Entry& e : entries) {
+    for (size_t k = 0; k < kNumKinds; k++) {
+      Add(&retired_, e.method, k, e.counts[k]);
+    }
+  }
+}
+
+static void CollectThread(Thread* thread, void* arg) {
+  auto* ctx = reinterpret_cast<std::pair<std::vector<LlvmTransitions::Entry>*,
+                                         uint64_t*>*>(arg);
+  LlvmTransitions* transitions =
+    thread->GetLlvmState()->transitions.load(std::memory_order_acquire);
+  if (transitions != nullptr) {
+    transitions->Collect(ctx->first, ctx->second);
+  }
+}
+
+void LlvmTransitions::CollectAll(std::vector<Entry>* entries,
+                                 uint64_t* totals) {
+  {
+    std::lock_guard<std::mutex> lock(retired_lock_);
+    for (size_t k = 0; k < kNumKinds; k++) totals[k] += retired_totals_[k];
+    for (auto& it : retired_) entries->push_back(it.second);
+  }
+
+  std::pair<std::vector<Entry>*, uint64_t*> ctx(entries, totals);
+  Thread* self = Thread::Current();
+  MutexLock mu(self, *Locks::thread_list_lock_);
+  Runtime::Current()->GetThreadList()->ForEach(CollectThread, &ctx);
+}
+
+void LlvmTransitions::DumpForSigQuit(std::ostream& os) {
+  if (!McrRT::IsLlvmEnabled()) return;
+
+  std::vector<Entry> entries;
+  uint64_t totals[kNumKinds] = {};
+  CollectAll(&entries, totals);
+
+  os << "LLVM transitions:";
+  for (size_t k = 0; k < kNumKinds; k++) {
+    os << " " << KindName(static_cast<Kind>(k)) << "=" << totals[k];
+  }
+  os << "\n";
+
+  ScopedObjectAccess soa(Thread::Current());
+  for (size_t k = 0; k < kNumKinds; k++) {
+    std::sort(entries.begin(), entries.end(),
+        [k](const Entry& a, const Entry& b) {
+          return a.counts[k] > b.counts[k];
+        });
+    for (size_t i = 0; i < std::min(entries.size(), kDumpTopCallees); i++) {
+      if (entries[i].counts[k] == 0) break;
+      os << "  " << KindName(static_cast<Kind>(k)) << ": "
+        << entries[i].counts[k] << ": "
+        << entries[i].method->PrettyMethod() << "\n";
+    }
+  }
+  os << "\n";
+}
+
+}  // namespace mcr
+}  // namespace art
@@ -0,0 +1,175 @@
+/**
+ * Copyright (C) 2021  Paschalis Mpeis (paschalis.mpeis-AT-gmail.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef ART_RUNTIME_MCR_RT_LLVM_TRANSITIONS_H_
+#define ART_RUNTIME_MCR_RT_LLVM_TRANSITIONS_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <ostream>
+#include <vector>
+
+namespace art {
+
+class ArtMethod;
+class Thread;
+
+namespace mcr {
+
+/**
+ * @brief Counters of the transitions out of LLVM code, of a single thread.
+ *
+ * Only the owner thread writes, so an increment is a relaxed load and
+ * store (no locked instruction). Other threads (SIGQUIT, JVMTI) may read
+ * them at any time: a dump is a snapshot, and can be off by a few counts.
+ *
+ * Callees are kept in a small open-addressing table. Once it is full,
+ * new callees are only added to the totals (see dropped_).
+ */
+class LlvmTransitions {
+ public:
+  enum Kind : uint8_t {
+    kToQuick = 0,
+    kToEntrypoint,
+    kToJni,
+    kNumKinds
+  };
+
+  struct Entry {
+    ArtMethod* method;
+    uint64_t counts[kNumKinds];
+  };
+
+  void Count(Kind kind, ArtMethod* callee) {
+    Inc(&totals_[kind]);
+    if (callee == nullptr) return;
+    uintptr_t hash = reinterpret_cast<uintptr_t>(callee) >> 4;
+    for (size_t i = 0; i < kMaxCallees; i++) {
+      Callee& c = callees_[(hash + i) & (kMaxCallees - 1)];
+      ArtMethod* m = c.method.load(std::memory_order_relaxed);
+      if (m == nullptr) {
+        c.method.store(callee, std::memory_order_release);
+        m = callee;
+      }
+      if (m == callee) {
+        Inc(&c.counts[kind]);
+        return;
+      }
+    }
+    Inc(&dropped_[kind]);
+  }
+
+  // Adds the counters of this thread to entries (by method)
+  void Collect(std::vector<Entry>* entries, uint64_t* totals) const;
+
+  // Transitions of all threads (alive and exited)
+  static void CollectAll(std::vector<Entry>* entries, uint64_t* totals);
+  static void DumpForSigQuit(std::ostream& os);
+  // Keeps the counters of an exiting thread
+  static void Retire(const LlvmTransitions* transitions);
+
+  static const char* KindName(Kind kind);
+
+ private:
+  static constexpr size_t kMaxCallees = 64;
+  static_assert((kMaxCallees & (kMaxCallees - 1)) == 0, "not a power of 2");
+
+  static void Inc(std::atomic<uint64_t>* counter) {
+    counter->store(counter->load(std::memory_order_relaxed) + 1,
+                   std::memory_order_relaxed);
+  }
+
+  struct Callee {
+    std::atomic<ArtMethod*> method{nullptr};
+    std::atomic<uint64_t> counts[kNumKinds] = {};
+  };
+
+  Callee callees_[kMaxCallees];
+  std::atomic<uint64_t> totals_[kNumKinds] = {};
+  // transitions whose callee did not fit in callees_
+  std::atomic<uint64_t> dropped_[kNumKinds] = {};
+};
+
+/**
+ * @brief Where a thread is (LLVM or quick code), kept in its Thread.
+ *        It used to be process-global, and was wrong once two threads
+ *        executed LLVM code.
+ *
+ * LLVM can call quick code that enters LLVM again, so Enter saves the
+ * llvm_called_quick flag of the outer LLVM frame, and Exit restores it.
+ * The flag itself is in the tls32_ of the Thread, where LLVM code writes it
+ * (Thread::LlvmCalledQuickOffset).
+ */
+struct LlvmThreadState {
+  void Enter(uint32_t* llvm_called_quick) {
+    saved_called_quick = (saved_called_quick << 1) | (*llvm_called_quick != 0 ? 1u : 0u);
+    llvm_depth++;
+    in_llvm = true;
+    *llvm_called_quick = 0;
+  }
+
+  void Exit(uint32_t* llvm_called_quick) {
+    *llvm_called_quick = saved_called_quick & 1u;
+    saved_called_quick >>= 1;
+    llvm_depth--;
+    in_llvm = llvm_depth > 0;
+  }
+
+  // Allocated on the first entry to LLVM: most threads never get there
+  LlvmTransitions* GetTransitions() {
+    LlvmTransitions* t = transitions.load(std::memory_order_relaxed);
+    if (t == nullptr) {
+      t = new LlvmTransitions();
+      transitions.store(t, std::memory_order_release);
+    }
+    return t;
+  }
+
+  void Count(LlvmTransitions::Kind kind, ArtMethod* callee) {
+    GetTransitions()->Count(kind, callee);
+  }
+
+  // Called when the Thread is destroyed
+  void Release() {
+    LlvmTransitions* t = transitions.exchange(nullptr);
+    if (t != nullptr) {
+      LlvmTransitions::Retire(t);
+      delete t;
+    }
+  }
+
+  // The state of the current thread (or of a detached one)
+  static LlvmThreadState* Current();
+  // Whether the LLVM code of the current thread called quick code
+  static bool CurrentCalledQuick();
+
+  bool in_llvm = false;
+  bool in_quick = false;
+  uint32_t llvm_depth = 0;
+  // The top quick frame that LLVM_FRAME_FIXUP hid: the frame of the runtime
+  // method that LLVM code called. Its GC roots start from there
+  // (LlvmStackMaps::VisitRoots).
+  ArtMethod** top_quick_frame = nullptr;
+  // llvm_called_quick of each outer LLVM frame (one bit each)
+  uint64_t saved_called_quick = 0;
+  // read by other threads, while they hold the thread_list_lock_
+  std::atomic<LlvmTransitions*> transitions{nullptr};
+};
+
+}  // namespace mcr
+}  // namespace art
+
+#endif  // ART_RUNTIME_MCR_RT_LLVM_TRANSITIONS_H_
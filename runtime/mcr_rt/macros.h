@@ -100,21 +100,26 @@
 
 #define LLVM_DBG() (art::dbg_llvm_code_)
 
-#define LLVM_ENTERED() __in_llvm=true
-#define LLVM_EXITED()  __in_llvm=false
+// Per-thread (see mcr_rt/llvm_transitions.h)
+#define LLVM_STATE() (::art::mcr::LlvmThreadState::Current())
 
-#define QUICK_ENTERED() __in_quick=true
-#define QUICK_EXITED()  __in_quick=false
+#define LLVM_ENTERED(THREAD) (THREAD)->EnterLlvm()
+#define LLVM_EXITED(THREAD)  (THREAD)->ExitLlvm()
 
-#define SET_LLVM_CALLED_QUICK() __llvm_called_quick=true
-#define UNSET_LLVM_CALLED_QUICK() __llvm_called_quick=false
+#define QUICK_ENTERED(THREAD) (THREAD)->GetLlvmState()->in_quick=true
+#define QUICK_EXITED(THREAD)  (THREAD)->GetLlvmState()->in_quick=false
 
-#define LLVM_CALLED_QUICK() (__llvm_called_quick)
+#define SET_LLVM_CALLED_QUICK(THREAD) (THREAD)->SetLlvmCalledQuick(true)
+#define UNSET_LLVM_CALLED_QUICK(THREAD) (THREAD)->SetLlvmCalledQuick(false)
+
+#define LLVM_CALLED_QUICK() (::art::mcr::LlvmThreadState::CurrentCalledQuick())
+#define LLVM_COUNT_TRANSITION(THREAD, KIND, METHOD) \
+  (THREAD)->GetLlvmState()->Count(::art::mcr::LlvmTransitions::KIND, (METHOD))
 
 #define LLVM_ENABLED() (mcr::McrRT::IsLlvmEnabled())
-#define IN_LLVM() (__in_llvm)
+#define IN_LLVM() (LLVM_STATE()->in_llvm)
 #define IN_LLVM_DIRECTLY() (IN_LLVM() && !LLVM_CALLED_QUICK())
-#define IN_QUICK() (__in_quick)
+#define IN_QUICK() (LLVM_STATE()->in_quick)
 #define _IN_ICHF() (IN_LLVM() || IN_QUICK())
 
 #ifdef CRDEBUG
@@ -158,10 +163,13 @@
 #define IN_QUICK() ((false && true))
 #define LLVM_ENABLED() ((false && true))
 
-#define LLVM_ENTERED()
-#define LLVM_EXITED()
-#define QUICK_ENTERED()
-#define QUICK_EXITED()
+#define LLVM_ENTERED(THREAD)
+#define LLVM_EXITED(THREAD)
+#define QUICK_ENTERED(THREAD)
+#define QUICK_EXITED(THREAD)
+#define SET_LLVM_CALLED_QUICK(THREAD)
+#define UNSET_LLVM_CALLED_QUICK(THREAD)
+#define LLVM_COUNT_TRANSITION(THREAD, KIND, METHOD)
 
 #endif
 
@@ -257,6 +265,11 @@
 
 #define LLVM_FRAME_FIXUP(THREAD) \
   if(IN_LLVM_DIRECTLY()) { \
+    ArtMethod** _top_quick_frame = \
+      (THREAD)->GetManagedStack()->GetTopQuickFrame(); \
+    if (_top_quick_frame != nullptr) { \
+      (THREAD)->GetLlvmState()->top_quick_frame = _top_quick_frame; \
+    } \
     (THREAD)->SetTopOfStack(nullptr); \
   }
 
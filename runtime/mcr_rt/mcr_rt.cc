@@ -49,12 +49,6 @@ bool dbg_llvm_code_ = false;
 const bool dbg_llvm_code_ = false;
 #endif
 
-#ifdef ART_MCR_RT
-bool __in_llvm = false;
-bool __in_quick = false;
-bool __llvm_called_quick = false;
-#endif
-
 namespace mcr {
 
 std::string McrRT::userid_;
@@ -64,6 +58,9 @@ std::set<std::string> McrRT::hot_functions_;
 bool McrRT::dbg_linker_ = false;
 bool McrRT::llvm_enabled_= false;
 bool McrRT::dbg_qres_trampoline_ = false;
+bool McrRT::profile_native_ = false;
+bool McrRT::llvm_jit_ = false;
+std::set<std::string> McrRT::llvm_jit_methods_;
 
 uint64_t McrRT::timer_start_ = 0;
 uint64_t McrRT::timer_end_ = 0;
@@ -100,6 +97,8 @@ void McrRT::ReadOptions() {
   ReadLlvmEnabled();
   ReadLOGDBG();
   ReadDBG_QuickResolutionTrampoline();
+  ReadProfileNative();
+  ReadLlvmJit();
 
   if (IsDemoApp()) {
     if(!IsLlvmEnabled()) { DLOG(WARNING) << "DEMO APP: LLVM NOT enabled!"; }
@@ -136,6 +135,46 @@ void McrRT::ReadDBG_QuickResolutionTrampoline() {
   }
 }
 
+/**
+ * @brief Samples the LLVM code (LlvmProfiler). Needs the line tables of
+ *        the compiler (opt.line_table).
+ */
+void McrRT::ReadProfileNative() {
+  std::string filename = GetFileApp(F_PROFILE_NATIVE);
+  profile_native_ = OS::FileExists(filename.c_str());
+  if (profile_native_) {
+    DLOG(WARNING) << "Native profiler enabled for: " << McrRT::GetPackage();
+  }
+}
+
+/**
+ * @brief The LLVM JIT tier (runtime/jit): very hot methods, and the
+ *        methods of the LLVM profile, are compiled in the app process.
+ *        The hot regions of dex2oat (llvm.enabled) turn off the JIT.
+ */
+void McrRT::ReadLlvmJit() {
+  std::string filename = GetFileApp(F_LLVM_JIT);
+  if (!OS::FileExists(filename.c_str())) return;
+  if (IsLlvmEnabled()) {
+    DLOG(WARNING) << "LLVM JIT: ignored: LLVM enabled for: " << GetPackage();
+    return;
+  }
+
+  FileReader fr(__func__, GetFileApp(F_LLVM_PROFILE), false, false, false);
+  if (fr.exists()) {
+    for (std::string method : fr.GetData()) {
+      if (method.size() == 0 || method.rfind("#", 0) == 0 ||
+          method.compare(REGION_SEPARATOR) == 0) {
+        continue;
+      }
+      llvm_jit_methods_.insert(method);
+    }
+  }
+  llvm_jit_ = true;
+  DLOG(WARNING) << "LLVM JIT enabled for: " << GetPackage()
+    << " (" << llvm_jit_methods_.size() << " profile methods)";
+}
+
 void McrRT::InitApp(std::string userid, std::string pkg) {
   if (!pkg.empty()) {
     userid_= userid;
@@ -26,6 +26,7 @@
 #include "base/locks.h"
 #include "dex/dex_file.h"
 #include "dex/method_reference.h"
+#include "mcr_rt/llvm_transitions.h"
 #include "mcr_rt/macros.h"
 #include "mcr_rt/mcr_log.h"
 #include "mcr_rt/utils.h"
@@ -39,6 +40,11 @@
 #define F_LLVM_ENABLED "/llvm.enabled"
 #define F_DBG_LOG "/log.dbg"
 #define F_QRES_TRAMPOLINE  "/dbg.qres_trampoline"
+#define F_PROFILE_NATIVE "/profile.native"
+#define F_LLVM_JIT "/llvm.jit"
+// hot regions: read by dex2oat (McrCC), and by the LLVM JIT tier
+#define F_LLVM_PROFILE "/profile"
+#define REGION_SEPARATOR "---"
 
 #if defined(ART_MCR_ANDROID_10)
 #define DIR_MCR "/data/misc/profiles/llvm"
@@ -55,12 +61,6 @@
 
 namespace art {
 
-#ifdef ART_MCR_RT
-extern bool __in_llvm;
-extern bool __in_quick;
-extern bool __llvm_called_quick;
-#endif
-
 #ifdef CRDEBUG2
 extern bool dbg_llvm_code_;
 #else
@@ -111,6 +111,11 @@ class McrRT final {
   static void CheckInitialized();
   
   static bool IsLlvmEnabled() { return llvm_enabled_; }
+  static bool IsProfileNative() { return profile_native_; }
+  static bool IsLlvmJit() { return llvm_jit_; }
+  static bool IsLlvmJitMethod(const std::string& pretty_method) {
+    return llvm_jit_methods_.find(pretty_method) != llvm_jit_methods_.end();
+  }
   static void DisableLlvm() { llvm_enabled_ = false; }
 
   static void ProcessApp(std::string str);
@@ -130,10 +135,16 @@ class McrRT final {
   static void ReadLOGDBG();
 
   static void ReadDBG_QuickResolutionTrampoline();
+  static void ReadProfileNative();
+  static void ReadLlvmJit();
 
   static bool dbg_qres_trampoline_;
   static bool dbg_linker_;
   static bool llvm_enabled_;
+  static bool profile_native_;
+  static bool llvm_jit_;
+  // methods of the LLVM profile: the JIT tier takes them once hot
+  static std::set<std::string> llvm_jit_methods_;
 
   static uint64_t timer_start_;
   static uint64_t timer_end_;
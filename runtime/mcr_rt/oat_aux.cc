@@ -33,8 +33,9 @@ namespace mcr {
 // compiled_methods: set and used by compiler
 // stripped_methods: set by compiler, and then used by RT
 // on initial loading of the app, to pre-load the llvm code (hf.so)
+// and keep its entrypoint, which is bound to the ArtMethod when linked
 // rt_methods: used by RT, and should be faster (map of ArtMethod pointers)
-std::map<std::string, uint32_t> OatAux::stripped_methods_;
+std::map<std::string, void*> OatAux::stripped_methods_;
 CompiledMethods OatAux::compiled_methods_;
 RtMethods OatAux::rt_methods_;
 
@@ -168,15 +169,15 @@ void OatAux::ReadOatAux() {
     CHECK(p != std::string::npos);
     std::string shf= line.substr(0, p);
     std::string sdidx = line.substr(p + 1);
-    uint32_t didx = std::stoul(sdidx);
-
-    std::pair<std::string, uint32_t> pair(shf, didx);
-    stripped_methods_.insert(pair);
+    D5LOG(INFO) << __func__ << ": " << shf << ": didx: " << sdidx;
 
+    void* llvm_code = nullptr;
     if (McrRT::IsLlvmEnabled()) {
-      mcr::OptimizingInterface::LoadCodeForMethod(shf, didx);
+      // hf.so is opened once per region
+      llvm_code = mcr::OptimizingInterface::LoadCodeForMethod(shf);
       D2LOG(WARNING) << "Loaded LLVM code for: " << shf;
     }
+    stripped_methods_.insert(std::make_pair(shf, llvm_code));
   }
 }
 
@@ -195,10 +196,24 @@ void OatAux::ReadOatAux() {
 void OatAux::SetMethodAuxData(ArtMethod* method) {
   std::string pretty_method = method->PrettyMethod();
   std::string stripped_hf = StripHf(pretty_method);
-  if (stripped_methods_.find(stripped_hf) != stripped_methods_.end()) { 
+  auto it = stripped_methods_.find(stripped_hf);
+  if (it != stripped_methods_.end()) {
+    const bool llvm_enabled = McrRT::IsLlvmEnabled();
+    if (llvm_enabled && it->second == nullptr) {
+      DLOG(ERROR) << "OatAux: no LLVM code: staying in quick: " << pretty_method;
+      return;
+    }
     D4LOG(INFO) << "OatAux: SetICHF:  " << stripped_hf;
     SetIchf(method);
 
+    if (llvm_enabled) {
+      // The LLVM code is the aux data of the method: the bridge reads it
+      // directly (OptimizingInterface::ExecuteLLVM)
+      D4LOG(WARNING) << "OatAux: ForceQtoLlvm: " << pretty_method;
+      method->SetQuickToLlvm(it->second);
+      return;
+    }
+
     JNIEnvExt* env = Thread::Current()->GetJniEnv();
     ScopedObjectAccessUnchecked soa(env);
     ClassLinker* linker = Runtime::Current()->GetClassLinker();
@@ -222,14 +237,8 @@ void OatAux::SetMethodAuxData(ArtMethod* method) {
       }
     }
 
-    if(McrRT::IsLlvmEnabled()) {
-      const void* llvm_code = reinterpret_cast<const void*>(art_quick_to_llvm_bridge);
-      D4LOG(WARNING) << "OatAux: ForceQtoLlvm: " << pretty_method;
-      method->SetQuickToLlvm(quick_code, llvm_code);
-    } else {
-      D4LOG(WARNING) << "OatAux: ForceQtoI: " << pretty_method;
-      method->SetQuickToInterpreter(quick_code);
-    }
+    D4LOG(WARNING) << "OatAux: ForceQtoI: " << pretty_method;
+    method->SetQuickToInterpreter(quick_code);
   }
 }
 
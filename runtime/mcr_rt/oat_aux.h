@@ -99,7 +99,8 @@ class OatAux {
   friend std::ostream& operator<<(std::ostream& os, const ArtMethodAux& ao);
 
  private:
-  static std::map<std::string, uint32_t> stripped_methods_;
+  // stripped hf -> LLVM code (llvm_live_ of its hf.so)
+  static std::map<std::string, void*> stripped_methods_;
   static CompiledMethods compiled_methods_;
   static RtMethods rt_methods_;
 };
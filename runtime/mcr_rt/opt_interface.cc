@@ -20,11 +20,21 @@
 
 #include "art_field-inl.h"
 #include "art_field.h"
+#include "art_method-inl.h"
 #include "base/os.h"
 #include "gc/heap.h"
 #include "gc/space/image_space.h"
+#include "instrumentation.h"
+#include "jit/jit.h"
+#include "jit/jit_code_cache.h"
+#include "jit/profiling_info.h"
 #include "mcr_rt/art_impl.h"
 #include "mcr_rt/art_impl_arch-inl.h"
+#include "mcr_rt/branch_profile.h"
+#include "mcr_rt/llvm_fault_handler.h"
+#include "mcr_rt/llvm_inline_cache.h"
+#include "mcr_rt/llvm_profiler.h"
+#include "mcr_rt/llvm_stack_maps.h"
 #include "mcr_rt/mcr_dbg.h"
 #include "mcr_rt/opt_interface.h"
 #include "mcr_rt/utils.h"
@@ -43,8 +53,8 @@ namespace mcr {
 
 // QuickEntryPoints* OptimizingInterface::qpoints_ = nullptr;
 
-std::map<uint32_t, void*> OptimizingInterface::dl_pointers_;
-std::map<uint32_t, void*> OptimizingInterface::dl_handlers_;
+std::map<std::string, void*> OptimizingInterface::dl_handlers_;
+std::map<std::string, void*> OptimizingInterface::dl_pointers_;
 
 inline void* dl_sym(void* handle, const char* symbol) {
   D3LOG(INFO) << __func__ << ": symbol: " << symbol << ": handle: " << handle;
@@ -75,26 +85,64 @@ inline  void* dl_open_llvm(const char* file_so) {
   return h;
 }
 
-void OptimizingInterface::LoadCodeForMethod(
-    std::string stripped_hf, uint32_t midx) {
+void* OptimizingInterface::LoadCodeForMethod(std::string stripped_hf) {
   std::string file_so = std::string(
       GetDirAppHfSrc(stripped_hf)) + "/hf.so";
-  LoadCode(file_so, midx);
+  return LoadCode(file_so);
 }
 
-void OptimizingInterface::LoadCode(std::string file_so, uint32_t midx) {
+void* OptimizingInterface::LoadCode(std::string file_so) {
+  auto it = dl_pointers_.find(file_so);
+  if (it != dl_pointers_.end()) {
+    D5LOG(INFO) << __func__ << ": already loaded: " << file_so;
+    return it->second;
+  }
   D5LOG(INFO) << __func__ << ": " << file_so;
 
   void* handle = dl_open_llvm(file_so.c_str());
-  std::pair<uint32_t, void*> ph(midx, handle);
-  dl_handlers_.insert(ph);
+  if (handle == nullptr) return nullptr;
+  dl_handlers_.insert(std::make_pair(file_so, handle));
 
   // only live_llvm_ symbol is used in this version
-  std::string symbol = SYMBOL_LLVM_LIVE;
+  void* s = dl_sym(handle, SYMBOL_LLVM_LIVE);
+  dl_pointers_.insert(std::make_pair(file_so, s));
+  LlvmStackMaps::Load(file_so, s);
+  LlvmProfiler::Load(file_so, s);
+  LlvmFaultHandler::Load(file_so, s);
+  return s;
+}
 
-  void* s = dl_sym(handle, symbol.c_str());
-  std::pair<uint32_t, void*> ps(midx, s);
-  dl_pointers_.insert(ps);
+void* OptimizingInterface::GetLlvmCode(ArtMethod* method) {
+  if (!McrRT::IsLlvmJit()) {
+    return method->GetLlvmCode();
+  }
+  // The JIT code cache does not collect it while the code is set
+  ProfilingInfo* info = method->GetProfilingInfo(kRuntimePointerSize);
+  DCHECK(info != nullptr) << method->PrettyMethod();
+  return info->GetLlvmCode();
+}
+
+/**
+ * @brief Unlike OatAux::SetMethodAuxData, the code is not kept in the
+ *        JNI entrypoint: on JIT methods it holds their ProfilingInfo.
+ *        The code goes in there, which the code cache then keeps.
+ *        A later JIT commit (e.g. after a deoptimization) simply replaces
+ *        the bridge.
+ */
+bool OptimizingInterface::InstallJitCode(Thread* self, ArtMethod* method, void* code) {
+  jit::JitCodeCache* code_cache = Runtime::Current()->GetJit()->GetCodeCache();
+  if (method->GetProfilingInfo(kRuntimePointerSize) == nullptr) {
+    ProfilingInfo::Create(self, method, /*retry_allocation=*/ true);
+  }
+  if (!code_cache->SetLlvmCode(method, code, self)) {
+    DLOG(ERROR) << "LLVM JIT: no ProfilingInfo: staying in quick: "
+      << method->PrettyMethod();
+    return false;
+  }
+  Runtime::Current()->GetInstrumentation()->UpdateMethodsCode(
+      method, reinterpret_cast<const void*>(art_quick_to_llvm_bridge));
+  D1LOG(INFO) << "LLVM JIT: installed: " << method->PrettyMethod();
+  return true;
 }
 
 /**
@@ -112,7 +160,7 @@ bool OptimizingInterface::ExecuteLLVM(Thread* self, ArtMethod* method,
         Runtime::Current()->GetHeap()->GetBootImageSpaces().front()->Begin()));
 
   void (*entrypoint)(void*, uint32_t*, JValue*, void*, uint32_t);
-  *(void**)(&entrypoint) = GetDlPointer(method->GetDexMethodIndex());
+  *(void**)(&entrypoint) = GetLlvmCode(method);
 
   /* EXECUTE LLVM CODE.
    *  Arguments:
@@ -122,9 +170,9 @@ bool OptimizingInterface::ExecuteLLVM(Thread* self, ArtMethod* method,
    *    x3  - self
    *    x4  - boot image begin
    */
-  LLVM_ENTERED();
+  LLVM_ENTERED(self);
   (*entrypoint)(method, args, result, self, boot_image_begin);
-  LLVM_EXITED();
+  LLVM_EXITED(self);
 
   // INFO when we jump LLVM, for some reason the TopManagedStack
   // (Quick Stack Frame) is set. Since we are creating a ShadowFrame
@@ -137,6 +185,8 @@ bool OptimizingInterface::ExecuteLLVM(Thread* self, ArtMethod* method,
   // stack and tries to access ArtMethod.
   // TODO: align native LLVM's frame to match Quick's
   LLVM_FRAME_FIXUP(self);
+  // it was not hidden from a runtime method that LLVM called
+  self->GetLlvmState()->top_quick_frame = nullptr;
 
   // INFO there are issues when calling and returning from LLVM
   // Some registers are not properly reserved.
@@ -146,29 +196,18 @@ bool OptimizingInterface::ExecuteLLVM(Thread* self, ArtMethod* method,
   return true;
 }
 
-void OptimizingInterface::UnloadCode(uint32_t midx) {
+void OptimizingInterface::UnloadCode() {
   D2LOG(INFO) << __func__;
-  dlclose(GetDlHandler(midx));
-  dl_handlers_.erase(midx);
-  dl_pointers_.erase(midx);
-}
-
-void* OptimizingInterface::GetDlHandler(uint32_t midx) {
-  std::map<uint32_t, void*>::iterator f = dl_handlers_.find(midx);
-  if (f == dl_handlers_.end()) {
-    DLOG(FATAL) << __func__ << ": " << midx;
-    return nullptr;
-  }
-  return f->second;
-}
-
-void* OptimizingInterface::GetDlPointer(uint32_t midx) {
-  std::map<uint32_t, void*>::iterator f = dl_pointers_.find(midx);
-  if (f == dl_pointers_.end()) {
-    DLOG(FATAL) << __func__ << ": " << midx;
-    return nullptr;
+  LlvmStackMaps::Unload();
+  LlvmInlineCache::UnloadAll();
+  BranchProfile::Unload();
+  LlvmProfiler::Unload();
+  LlvmFaultHandler::Unload();
+  for (auto& it : dl_handlers_) {
+    dlclose(it.second);
   }
-  return f->second;
+  dl_handlers_.clear();
+  dl_pointers_.clear();
 }
 
 }  // namespace mcr
@@ -31,20 +31,28 @@ namespace mcr {
 
 class OptimizingInterface {
  public:
-  static void LoadCodeForMethod(std::string stripped_hf, uint32_t midx);
-  static void LoadCode(std::string file_so, uint32_t midx);
-  static void UnloadCode(uint32_t midx);
+  // Returns the llvm_live_ entrypoint of the hf.so of a region
+  static void* LoadCodeForMethod(std::string stripped_hf);
+  static void* LoadCode(std::string file_so);
+  static void UnloadCode();
   static bool ExecuteLLVM(Thread* self, ArtMethod* method,
       uint32_t* args, JValue* result, const char* shorty)
       REQUIRES_SHARED(Locks::mutator_lock_);
-  static void* GetDlPointer(uint32_t midx);
-  static void* GetDlHandler(uint32_t midx);
+  // LLVM code of a method that is bound to the bridge: the aux data of a
+  // linked method (OatAux::SetMethodAuxData), or the ProfilingInfo of the
+  // LLVM JIT tier (InstallJitCode).
+  static void* GetLlvmCode(ArtMethod* method)
+      REQUIRES_SHARED(Locks::mutator_lock_);
+  // Binds a method to the LLVM code of the JIT tier (Jit::CompileMethodLlvm)
+  static bool InstallJitCode(Thread* self, ArtMethod* method, void* code)
+      REQUIRES_SHARED(Locks::mutator_lock_);
   static QuickEntryPoints* qpoints_;
-  
- private:
-  static std::map<uint32_t, void*> dl_pointers_;
-  static std::map<uint32_t, void*> dl_handlers_;
 
+ private:
+  // INFO keyed by hf.so: a region is loaded once, no matter how many
+  // methods (or dex files with the same method idx) it has.
+  static std::map<std::string, void*> dl_handlers_;
+  static std::map<std::string, void*> dl_pointers_;
 };
 
 }  // namespace mcr
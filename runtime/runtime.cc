@@ -96,6 +96,9 @@
 #include "jni/java_vm_ext.h"
 #include "jni/jni_internal.h"
 #include "linear_alloc.h"
+#include "mcr_rt/flush_task.h"
+#include "mcr_rt/llvm_fault_handler.h"
+#include "mcr_rt/llvm_inline_cache.h"
 #include "memory_representation.h"
 #include "mirror/array.h"
 #include "mirror/class-alloc-inl.h"
@@ -367,6 +370,10 @@ Runtime::~Runtime() {
         << "\n";
   }
 
+  // Joins the thread that flushes the profiles every few seconds, and
+  // flushes them a last time, while the dex files they refer to are alive.
+  mcr::FlushTask::Shutdown();
+
   // Wait for the workers of thread pools to be created since there can't be any
   // threads attaching during shutdown.
   WaitForThreadPoolWorkersToStart();
@@ -689,6 +696,11 @@ void Runtime::SweepSystemWeaks(IsMarkedVisitor* visitor) {
   for (gc::AbstractSystemWeakHolder* holder : system_weak_holders_) {
     holder->Sweep(visitor);
   }
+#ifdef ART_MCR_RT
+  // Classes of the inline caches and of the speculations of LLVM code
+  mcr::LlvmInlineCache::SweepAll(visitor);
+  mcr::LlvmSpecClass::SweepAll(visitor);
+#endif
 }
 
 bool Runtime::ParseOptions(const RuntimeOptions& raw_options,
@@ -1467,6 +1479,13 @@ bool Runtime::Init(RuntimeArgumentMap&& runtime_options_in) {
         new NullPointerHandler(&fault_manager);
       }
 
+#ifdef ART_MCR_RT
+      // implicit checks of LLVM code (hf.faults)
+      if (implicit_null_checks_ || implicit_so_checks_) {
+        new mcr::LlvmFaultHandler(&fault_manager);
+      }
+#endif
+
       if (kEnableJavaStackTraceHandler) {
         new JavaStackTraceHandler(&fault_manager);
       }
@@ -1940,6 +1959,9 @@ void Runtime::DumpForSigQuit(std::ostream& os) {
   DumpDeoptimizations(os);
   TrackedAllocators::Dump(os);
   os << "\n";
+#ifdef ART_MCR_RT
+  mcr::LlvmTransitions::DumpForSigQuit(os);
+#endif
 
   thread_list_->DumpForSigQuit(os);
   BaseMutex::DumpAll(os);
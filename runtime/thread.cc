@@ -121,6 +121,7 @@
 #endif  // ART_USE_FUTEXES
 
 #include "mcr_rt/art_impl.h"
+#include "mcr_rt/llvm_stack_maps.h"
 #include "mcr_rt/macros.h"
 
 namespace art {
@@ -183,6 +184,7 @@ void Thread::ResetQuickAllocEntryPointsForThread(bool is_marking) {
     is_marking = true;
   }
   ResetQuickAllocEntryPoints(&tlsPtr_.quick_entrypoints, is_marking);
+  tls32_.llvm_alloc_fast_path = IsQuickAllocTlabFastPathEnabled();
 }
 
 class DeoptimizationContextRecord {
@@ -2539,6 +2541,9 @@ Thread::~Thread() {
   }
   delete tlsPtr_.instrumentation_stack;
   delete tlsPtr_.name;
+#ifdef ART_MCR_RT
+  llvm_state_.Release();
+#endif
   delete tlsPtr_.deps_or_stack_trace_sample.stack_trace_sample;
 
   Runtime::Current()->GetHeap()->AssertThreadLocalBuffersAreRevoked(this);
@@ -3613,6 +3618,12 @@ void Thread::DumpThreadOffset(std::ostream& os, uint32_t offset) {
   QUICK_ENTRY_POINT_INFO(pLLVMVerifyArtClass)
   QUICK_ENTRY_POINT_INFO(pLLVMVerifyArtObject)
   QUICK_ENTRY_POINT_INFO(pLLVMVerifyStackFrameCurrent)
+  QUICK_ENTRY_POINT_INFO(pLLVMCallQuick)
+  QUICK_ENTRY_POINT_INFO(pLLVMInlineCacheMiss)
+  QUICK_ENTRY_POINT_INFO(pLLVMFindCatchBlock)
+  QUICK_ENTRY_POINT_INFO(pLLVMResolveSpecClass)
+  QUICK_ENTRY_POINT_INFO(pLLVMRegisterBranchProfile)
+  QUICK_ENTRY_POINT_INFO(pLLVMNewNullPointer)
 #undef QUICK_ENTRY_POINT_INFO
 
   os << offset;
@@ -4130,6 +4141,10 @@ void Thread::VisitRoots(RootVisitor* visitor) {
   RootCallbackVisitor visitor_to_callback(visitor, thread_id);
   ReferenceMapVisitor<RootCallbackVisitor, kPrecise> mapper(this, &context, visitor_to_callback);
   mapper.template WalkStack<StackVisitor::CountTransitions::kNo>(false);
+#ifdef ART_MCR_RT
+  // LLVM frames are hidden from the stack walker
+  mcr::LlvmStackMaps::VisitRoots(this, visitor);
+#endif
   for (instrumentation::InstrumentationStackFrame& frame : *GetInstrumentationStack()) {
     visitor->VisitRootIfNonNull(&frame.this_object_, RootInfo(kRootVMInternal, thread_id));
   }
@@ -38,6 +38,7 @@
 #include "interpreter/interpreter_cache.h"
 #include "jvalue.h"
 #include "managed_stack.h"
+#include "mcr_rt/llvm_transitions.h"
 #include "offsets.h"
 #include "read_barrier_config.h"
 #include "runtime_globals.h"
@@ -684,6 +685,20 @@ class Thread {
     return sizeof(tls32_.is_gc_marking);
   }
 
+  template<PointerSize pointer_size>
+  static constexpr ThreadOffset<pointer_size> LlvmCalledQuickOffset() {
+    return ThreadOffset<pointer_size>(
+        OFFSETOF_MEMBER(Thread, tls32_) +
+        OFFSETOF_MEMBER(tls_32bit_sized_values, llvm_called_quick));
+  }
+
+  template<PointerSize pointer_size>
+  static constexpr ThreadOffset<pointer_size> LlvmAllocFastPathOffset() {
+    return ThreadOffset<pointer_size>(
+        OFFSETOF_MEMBER(Thread, tls32_) +
+        OFFSETOF_MEMBER(tls_32bit_sized_values, llvm_alloc_fast_path));
+  }
+
   // Deoptimize the Java stack.
   void DeoptimizeWithDeoptimizationException(JValue* result) REQUIRES_SHARED(Locks::mutator_lock_);
 
@@ -1241,6 +1256,28 @@ class Thread {
   // will be run when the thread exits or when SetCustomTLS is called again with the same key.
   void SetCustomTLS(const char* key, TLSData* data) REQUIRES(!Locks::custom_tls_lock_);
 
+  // LLVM backend: where this thread is, and its transitions out of LLVM code.
+  // Not accessed by compiled code (see llvm_called_quick in tls32_).
+  mcr::LlvmThreadState* GetLlvmState() {
+    return &llvm_state_;
+  }
+
+  void EnterLlvm() {
+    llvm_state_.Enter(&tls32_.llvm_called_quick);
+  }
+
+  void ExitLlvm() {
+    llvm_state_.Exit(&tls32_.llvm_called_quick);
+  }
+
+  bool IsLlvmCalledQuick() const {
+    return tls32_.llvm_called_quick != 0;
+  }
+
+  void SetLlvmCalledQuick(bool value) {
+    tls32_.llvm_called_quick = value;
+  }
+
   // Returns true if the current thread is the jit sensitive thread.
   bool IsJitSensitiveThread() const {
     return this == jit_sensitive_thread_;
@@ -1480,7 +1517,8 @@ class Thread {
       thread_exit_check_count(0), handling_signal_(false),
       is_transitioning_to_runnable(false), ready_for_debug_invoke(false),
       debug_method_entry_(false), is_gc_marking(false), weak_ref_access_enabled(true),
-      disable_thread_flip_count(0), user_code_suspend_count(0), force_interpreter_count(0) {
+      disable_thread_flip_count(0), user_code_suspend_count(0), force_interpreter_count(0),
+      llvm_called_quick(false), llvm_alloc_fast_path(false) {
     }
 
     union StateAndFlags state_and_flags;
@@ -1571,6 +1609,15 @@ class Thread {
     // True if everything is in the ideal state for fast interpretation.
     // False if we need to switch to the C++ interpreter to handle special cases.
     std::atomic<bool32_t> use_mterp;
+
+    // LLVM backend: set by LLVM code around its direct calls to quick code
+    // (see mcr::LlvmThreadState).
+    bool32_t llvm_called_quick;
+
+    // Read by LLVM code before its inline TLAB allocations: when false they
+    // always call the entrypoint (allocator without TLABs, or instrumented
+    // allocations). Set with the alloc entrypoints of the thread.
+    bool32_t llvm_alloc_fast_path;
   } tls32_;
 
   struct PACKED(8) tls_64bit_sized_values {
@@ -1790,6 +1837,9 @@ class Thread {
   // True if the thread is some form of runtime thread (ex, GC or JIT).
   bool is_runtime_thread_;
 
+  // Last: does not move the offsets that are used by compiled code.
+  mcr::LlvmThreadState llvm_state_;
+
   friend class Dbg;  // For SetStateUnsafe.
   friend class gc::collector::SemiSpace;  // For getting stack traces.
   friend class Runtime;  // For CreatePeer.